@@ -32,6 +32,7 @@
 #include <range/v3/action/split.hpp>
 #include <range/v3/action/split_when.hpp>
 #include <range/v3/action/stable_sort.hpp>
+#include <range/v3/action/string_sort.hpp>
 #include <range/v3/action/stride.hpp>
 #include <range/v3/action/take.hpp>
 #include <range/v3/action/take_while.hpp>
@@ -25,6 +25,7 @@
 #include <range/v3/action/push_back.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -52,6 +53,22 @@ namespace ranges
                     push_back(ret, *it);
                 return ret;
             }
+
+            /// \overload
+            /// The result takes its memory from \c alloc.
+            template<typename Rng, typename Alloc>
+            auto operator()(Rng && rng, Alloc alloc) const
+                -> CPP_ret(detail::container_for_alloc_t<range_value_t<Rng>, Alloc>)( //
+                    requires InputRange<Rng> && InputRange<range_value_t<Rng>> &&
+                        detail::ContainerAllocator<Alloc>)
+            {
+                using result_t = detail::container_for_alloc_t<range_value_t<Rng>, Alloc>;
+                result_t ret{typename result_t::allocator_type(std::move(alloc))};
+                auto end = ranges::end(rng);
+                for(auto it = begin(rng); it != end; ++it)
+                    push_back(ret, *it);
+                return ret;
+            }
         };
 
         /// \ingroup group-actions
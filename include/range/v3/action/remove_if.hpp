@@ -24,6 +24,7 @@
 #include <range/v3/functional/bind_back.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -40,10 +41,17 @@ namespace ranges
             friend action_access;
             template<typename C, typename P = identity>
             static auto CPP_fun(bind)(remove_if_fn remove_if, C pred, P proj = P{})( //
-                requires(!Range<C>))
+                requires(!Range<C>) && (!Same<C, parallel_policy>))
             {
                 return bind_back(remove_if, std::move(pred), std::move(proj));
             }
+            template<typename C, typename P = identity>
+            static auto CPP_fun(bind)(remove_if_fn remove_if, parallel_policy pol,
+                                      C pred, P proj = P{})( //
+                requires(!Range<C>))
+            {
+                return bind_back(remove_if, pol, std::move(pred), std::move(proj));
+            }
 
         public:
             template<typename Rng, typename C, typename P = identity>
@@ -57,6 +65,22 @@ namespace ranges
                 ranges::erase(rng, it, ranges::end(rng));
                 return static_cast<Rng &&>(rng);
             }
+
+            /// Removes the elements with the parallel `ranges::remove_if`.
+            template<typename Rng, typename C, typename P = identity>
+            auto operator()(Rng && rng, parallel_policy pol, C pred, P proj = P{}) const
+                -> CPP_ret(Rng)( //
+                    requires RandomAccessRange<Rng> &&
+                        SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                            ErasableRange<Rng &, iterator_t<Rng>, iterator_t<Rng>> &&
+                                Permutable<iterator_t<Rng>> &&
+                                    IndirectUnaryPredicate<
+                                        C, projected<iterator_t<Rng>, P>>)
+            {
+                auto it = ranges::remove_if(pol, rng, std::move(pred), std::move(proj));
+                ranges::erase(rng, it, ranges::end(rng));
+                return static_cast<Rng &&>(rng);
+            }
         };
 
         /// \ingroup group-actions
@@ -41,6 +41,13 @@ namespace ranges
             template<typename Rng>
             using split_value_t = meta::if_c<(bool)ranges::Container<Rng>, uncvref_t<Rng>,
                                              std::vector<range_value_t<Rng>>>;
+            template<typename Rng, typename Alloc>
+            using split_alloc_value_t =
+                detail::container_for_alloc_t<uncvref_t<Rng>, Alloc>;
+            template<typename Rng, typename Alloc>
+            using split_alloc_result_t =
+                std::vector<split_alloc_value_t<Rng, Alloc>,
+                            detail::rebind_alloc_t<Alloc, split_alloc_value_t<Rng, Alloc>>>;
 
         public:
             // BUGBUG something is not right with the actions. It should be possible
@@ -65,6 +72,32 @@ namespace ranges
                 return view::split(rng, static_cast<Pattern &&>(pattern)) |
                        view::transform(to<split_value_t<Rng>>()) | to_vector;
             }
+
+            /// \overload
+            /// The result, and every piece in it, takes its memory from \c alloc.
+            template<typename Rng, typename Alloc>
+            auto operator()(Rng && rng, range_value_t<Rng> val, Alloc alloc) const
+                -> CPP_ret(split_alloc_result_t<Rng, Alloc>)( //
+                    requires InputRange<Rng> && detail::ContainerAllocator<Alloc> &&
+                        IndirectlyComparable<iterator_t<Rng>, range_value_t<Rng> const *,
+                                             ranges::equal_to>)
+            {
+                return view::split(rng, std::move(val)) |
+                       to<split_alloc_result_t<Rng, Alloc>>(std::move(alloc));
+            }
+            /// \overload
+            template<typename Rng, typename Pattern, typename Alloc>
+            auto operator()(Rng && rng, Pattern && pattern, Alloc alloc) const
+                -> CPP_ret(split_alloc_result_t<Rng, Alloc>)( //
+                    requires InputRange<Rng> && detail::ContainerAllocator<Alloc> &&
+                        ViewableRange<Pattern> && ForwardRange<Pattern> &&
+                        IndirectlyComparable<iterator_t<Rng>, iterator_t<Pattern>,
+                                             ranges::equal_to> &&
+                    (ForwardRange<Rng> || detail::tiny_range<Pattern>))
+            {
+                return view::split(rng, static_cast<Pattern &&>(pattern)) |
+                       to<split_alloc_result_t<Rng, Alloc>>(std::move(alloc));
+            }
         };
 
         /// \ingroup group-actions
@@ -0,0 +1,62 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_ACTION_STRING_SORT_HPP
+#define RANGES_V3_ACTION_STRING_SORT_HPP
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/algorithm/string_sort.hpp>
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-actions
+    /// @{
+    namespace action
+    {
+        struct string_sort_fn
+        {
+        private:
+            friend action_access;
+            template<typename P>
+            static auto CPP_fun(bind)(string_sort_fn string_sort, P proj)( //
+                requires(!Range<P>))
+            {
+                return bind_back(string_sort, std::move(proj));
+            }
+
+        public:
+            template<typename Rng, typename P = identity>
+            auto operator()(Rng && rng, P proj = P{}) const -> CPP_ret(Rng)( //
+                requires RandomAccessRange<Rng> && StringSortable<iterator_t<Rng>, P>)
+            {
+                ranges::string_sort(rng, std::move(proj));
+                return static_cast<Rng &&>(rng);
+            }
+        };
+
+        /// \ingroup group-actions
+        /// \relates string_sort_fn
+        /// \sa `action`
+        RANGES_INLINE_VARIABLE(action<string_sort_fn>, string_sort)
+    } // namespace action
+    /// @}
+} // namespace ranges
+
+#endif
@@ -24,6 +24,7 @@
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -38,10 +39,17 @@ namespace ranges
             friend action_access;
             template<typename C, typename P = identity>
             static auto CPP_fun(bind)(unique_fn unique, C pred, P proj = P{})( //
-                requires(!Range<C>))
+                requires(!Range<C>) && (!Same<C, parallel_policy>))
             {
                 return bind_back(unique, std::move(pred), std::move(proj));
             }
+            template<typename C = equal_to, typename P = identity>
+            static auto CPP_fun(bind)(unique_fn unique, parallel_policy pol,
+                                      C pred = C{}, P proj = P{})( //
+                requires(!Range<C>))
+            {
+                return bind_back(unique, pol, std::move(pred), std::move(proj));
+            }
 
         public:
             template<typename Rng, typename C = equal_to, typename P = identity>
@@ -55,6 +63,20 @@ namespace ranges
                 ranges::erase(rng, it, end(rng));
                 return static_cast<Rng &&>(rng);
             }
+
+            /// Removes the duplicates with the parallel `ranges::unique`.
+            template<typename Rng, typename C = equal_to, typename P = identity>
+            auto operator()(Rng && rng, parallel_policy pol, C pred = C{},
+                            P proj = P{}) const -> CPP_ret(Rng)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        ErasableRange<Rng &, iterator_t<Rng>, sentinel_t<Rng>> &&
+                            Sortable<iterator_t<Rng>, C, P>)
+            {
+                auto it = ranges::unique(pol, rng, std::move(pred), std::move(proj));
+                ranges::erase(rng, it, end(rng));
+                return static_cast<Rng &&>(rng);
+            }
         };
 
         /// \ingroup group-actions
@@ -31,6 +31,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/algorithm/ends_with.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/equal_range.hpp>
+#include <range/v3/algorithm/external_sort.hpp>
 #include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/fill_n.hpp>
 #include <range/v3/algorithm/find.hpp>
@@ -88,6 +89,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/algorithm/stable_partition.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
 #include <range/v3/algorithm/starts_with.hpp>
+#include <range/v3/algorithm/string_sort.hpp>
 #include <range/v3/algorithm/swap_ranges.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/algorithm/unique.hpp>
@@ -23,12 +23,18 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. The threads take chunks of the range in turn and search
+    /// them, and stop as soon as a match is found before their next chunk.
+    /// The result is the first match, as with the sequential algorithm.
     struct adjacent_find_fn
     {
         /// \brief function template \c adjacent_find_fn::operator()
@@ -61,6 +67,39 @@ namespace ranges
         {
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
+
+        /// \overload
+        template<typename I, typename S, typename C = equal_to, typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(I)( //
+            requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                IndirectRelation<C, projected<I, P>>)
+        {
+            using D = iter_difference_t<I>;
+            auto const n = static_cast<std::size_t>(end - begin);
+            if(n < 2)
+                return begin + static_cast<D>(n);
+            // Searches the pairs starting at [lo, hi).
+            auto const test = [&](std::size_t lo, std::size_t hi) {
+                for(I it = begin + static_cast<D>(lo); lo != hi; ++lo, ++it)
+                    if(invoke(pred, invoke(proj, *it), invoke(proj, *(it + 1))))
+                        break;
+                return lo;
+            };
+            auto const i = detail::parallel_find_first(pol, n - 1, test);
+            return begin + static_cast<D>(i == n - 1 ? n : i);
+        }
+
+        /// \overload
+        template<typename Rng, typename C = equal_to, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(safe_iterator_t<Rng>)( //
+            requires RandomAccessRange<Rng> &&
+                SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                    IndirectRelation<C, projected<iterator_t<Rng>, P>>)
+        {
+            return (*this)(pol, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `adjacent_find_fn`
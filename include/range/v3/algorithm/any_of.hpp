@@ -25,12 +25,17 @@
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. The threads take chunks of the range in turn and test them.
+    /// They stop as soon as any thread finds an element that satisfies \c pred.
     struct any_of_fn
     {
         template<typename I, typename S, typename F, typename P = identity>
@@ -51,6 +56,34 @@ namespace ranges
         {
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
+
+        template<typename I, typename S, typename F, typename P = identity>
+        auto operator()(parallel_policy pol, I first, S last, F pred, P proj = P{}) const
+            -> CPP_ret(bool)( //
+                requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                    IndirectUnaryPredicate<F, projected<I, P>>)
+        {
+            using D = iter_difference_t<I>;
+            auto const n = static_cast<std::size_t>(last - first);
+            auto const test = [&](std::size_t lo, std::size_t hi) {
+                for(I it = first + static_cast<D>(lo); lo != hi; ++lo, ++it)
+                    if(invoke(pred, invoke(proj, *it)))
+                        break;
+                return lo;
+            };
+            auto const i = detail::parallel_find_first(pol, n, test, true);
+            return i != n;
+        }
+
+        template<typename Rng, typename F, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, F pred, P proj = P{}) const
+            -> CPP_ret(bool)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        IndirectUnaryPredicate<F, projected<iterator_t<Rng>, P>>)
+        {
+            return (*this)(pol, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `any_of_fn`
@@ -0,0 +1,138 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_CACHED_KEY_HPP
+#define RANGES_V3_ALGORITHM_AUX_CACHED_KEY_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/concepts.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-algorithms
+    /// @{
+
+    /// Passed as the first argument of `sort`, `stable_sort`, `partial_sort`
+    /// or `nth_element`, requests that the projection be evaluated exactly
+    /// once per element. The projected keys are stored next to each element's
+    /// position, the keys are sorted, and the range is then permuted in place
+    /// to match. This pays for itself when the projection is expensive (it
+    /// parses, hashes or allocates), and costs an extra buffer of \c n keys.
+    struct cache_keys_t
+    {};
+
+    /// \sa `cache_keys_t`
+    RANGES_INLINE_VARIABLE(cache_keys_t, cache_keys)
+
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename P>
+        using cached_key_t = decay_t<indirect_result_t<P &, I>>;
+
+        template<typename K>
+        struct cached_key
+        {
+            K key;
+            std::size_t pos;
+        };
+
+        template<typename C>
+        struct cached_key_less
+        {
+            C * pred_;
+
+            template<typename K>
+            bool operator()(cached_key<K> const & a, cached_key<K> const & b) const
+            {
+                return invoke(*pred_, a.key, b.key);
+            }
+        };
+
+        // Ties are broken by position, so that an unstable sort of the keys
+        // gives the order of a stable sort of the elements.
+        template<typename C>
+        struct cached_key_stable_less
+        {
+            C * pred_;
+
+            template<typename K>
+            bool operator()(cached_key<K> const & a, cached_key<K> const & b) const
+            {
+                if(invoke(*pred_, a.key, b.key))
+                    return true;
+                return !invoke(*pred_, b.key, a.key) && a.pos < b.pos;
+            }
+        };
+
+        template<typename I, typename P>
+        std::vector<cached_key<cached_key_t<I, P>>> make_cached_keys(
+            I first, iter_difference_t<I> n, P & proj)
+        {
+            std::vector<cached_key<cached_key_t<I, P>>> keys;
+            keys.reserve(static_cast<std::size_t>(n));
+            for(std::size_t i = 0; i != static_cast<std::size_t>(n); ++i, ++first)
+                keys.push_back({invoke(proj, *first), i});
+            return keys;
+        }
+
+        // keys[i].pos is the position of the element that belongs at i. Moves
+        // each element once by walking the cycles of that permutation, and
+        // marks positions already done by pointing them at themselves.
+        template<typename I, typename K>
+        void permute_by_cached_keys(I first, std::vector<cached_key<K>> & keys)
+        {
+            using D = iter_difference_t<I>;
+            for(std::size_t i = 0; i != keys.size(); ++i)
+            {
+                if(keys[i].pos == i)
+                    continue;
+                iter_value_t<I> tmp = iter_move(first + static_cast<D>(i));
+                std::size_t j = i;
+                while(keys[j].pos != i)
+                {
+                    std::size_t const k = keys[j].pos;
+                    *(first + static_cast<D>(j)) = iter_move(first + static_cast<D>(k));
+                    keys[j].pos = j;
+                    j = k;
+                }
+                *(first + static_cast<D>(j)) = std::move(tmp);
+                keys[j].pos = j;
+            }
+        }
+    } // namespace detail
+    /// \endcond
+
+    // clang-format off
+    CPP_def
+    (
+        template(typename I, typename C, typename P)
+        concept CachedKeySortable,
+            Sortable<I, C, P> && RandomAccessIterator<I> &&
+            Movable<detail::cached_key_t<I, P>> &&
+            StrictWeakOrder<C &, detail::cached_key_t<I, P> const &,
+                            detail::cached_key_t<I, P> const &>
+    );
+    // clang-format on
+    /// @}
+} // namespace ranges
+
+#endif
@@ -13,12 +13,19 @@
 #ifndef RANGES_V3_ALGORITHM_COPY_IF_HPP
 #define RANGES_V3_ALGORITHM_COPY_IF_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
 
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/detail/simd_compact.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
@@ -27,6 +34,8 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -36,14 +45,81 @@ namespace ranges
     template<typename I, typename O>
     using copy_if_result = detail::in_out_result<I, O>;
 
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename S, typename O, typename F, typename P,
+                 typename = void>
+        struct simd_copyable_if_ : std::false_type
+        {};
+        template<typename I, typename S, typename O, typename F, typename P>
+        struct simd_copyable_if_<I, S, O, F, P, meta::if_c<ContiguousIterator<O>>>
+          : meta::bool_<simd_compactable_<I, S, F, P>::value &&
+                        Same<iter_value_t<O>, iter_value_t<I>>>
+        {};
+    } // namespace detail
+    /// \endcond
+
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. They evaluate \c pred once per element, on several threads
+    /// at once, recording the results in a bit per element; then add up the
+    /// number kept in each block to find where its output starts, and copy
+    /// the blocks in parallel. The output is in the same order as with the
+    /// sequential algorithm.
     struct copy_if_fn
     {
-        template<typename I, typename S, typename O, typename F, typename P = identity>
-        auto operator()(I begin, S end, O out, F pred, P proj = P{}) const //
-            -> CPP_ret(copy_if_result<I, O>)(                              //
-                requires InputIterator<I> && Sentinel<S, I> && WeaklyIncrementable<O> &&
-                    IndirectUnaryPredicate<F, projected<I, P>> &&
-                        IndirectlyCopyable<I, O>)
+    private:
+        template<typename I, typename O, typename F, typename P>
+        static O parallel_impl_(parallel_policy pol, I begin, iter_difference_t<I> n,
+                                O out, F & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size, detail::compact_grain);
+            if(count <= 1)
+                return copy_if_fn{}(begin, begin + n, std::move(out), std::ref(pred),
+                                    std::ref(proj))
+                    .out;
+            // A bit per element, set if it is kept.
+            std::vector<std::vector<std::uint64_t>> keep(count);
+            std::vector<std::size_t> offsets(count + 1, 0);
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                std::size_t const len = bnd.second - bnd.first;
+                auto & k = keep[b];
+                k.resize((len + 63) / 64);
+                I it = begin + static_cast<D>(bnd.first);
+                std::size_t kept = 0;
+                for(std::size_t i = 0; i < len; ++i, ++it)
+                {
+                    bool const x = invoke(pred, invoke(proj, *it));
+                    k[i / 64] |= std::uint64_t{x} << (i % 64);
+                    kept += x;
+                }
+                offsets[b + 1] = kept;
+            });
+            for(std::size_t b = 0; b < count; ++b)
+                offsets[b + 1] += offsets[b];
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                std::size_t const len = bnd.second - bnd.first;
+                auto const & k = keep[b];
+                I it = begin + static_cast<D>(bnd.first);
+                O o = out + static_cast<iter_difference_t<O>>(offsets[b]);
+                for(std::size_t i = 0; i < len; ++i, ++it)
+                    if((k[i / 64] >> (i % 64)) & 1u)
+                    {
+                        *o = *it;
+                        ++o;
+                    }
+            });
+            return out + static_cast<iter_difference_t<O>>(offsets[count]);
+        }
+
+        template<typename I, typename S, typename O, typename F, typename P>
+        static copy_if_result<I, O> impl_(I begin, S end, O out, F & pred, P & proj,
+                                          std::false_type)
         {
             for(; begin != end; ++begin)
             {
@@ -56,6 +132,43 @@ namespace ranges
             }
             return {begin, out};
         }
+        template<typename I, typename S, typename O, typename F, typename P>
+        static copy_if_result<I, O> impl_(I begin, S end, O out, F & pred, P &,
+                                          std::true_type)
+        {
+            auto const n = end - begin;
+            if(n <= 0)
+                return {begin, out};
+            std::size_t const k =
+                detail::simd_compact<true, false>(detail::addressof(*begin),
+                                                  static_cast<std::size_t>(n),
+                                                  detail::addressof(*out),
+                                                  pred);
+            return {begin + n, out + static_cast<iter_difference_t<O>>(k)};
+        }
+
+    public:
+        /// When \c I and \c O are contiguous, their elements are the same 32-
+        /// or 64-bit integers or floating-point numbers, there is no
+        /// projection, and \c pred is one of the predicates in \c ranges::pred
+        /// or its negation, the elements are tested and copied with AVX2 or
+        /// AVX-512 instructions, if the processor has them. The output must
+        /// not overlap the input.
+        template<typename I, typename S, typename O, typename F, typename P = identity>
+        auto operator()(I begin, S end, O out, F pred, P proj = P{}) const //
+            -> CPP_ret(copy_if_result<I, O>)(                              //
+                requires InputIterator<I> && Sentinel<S, I> && WeaklyIncrementable<O> &&
+                    IndirectUnaryPredicate<F, projected<I, P>> &&
+                        IndirectlyCopyable<I, O>)
+        {
+            using simd_t = detail::simd_copyable_if_<I, S, O, F, P>;
+            return copy_if_fn::impl_(std::move(begin),
+                                     std::move(end),
+                                     std::move(out),
+                                     pred,
+                                     proj,
+                                     meta::bool_<simd_t::value>{});
+        }
 
         template<typename Rng, typename O, typename F, typename P = identity>
         auto operator()(Rng && rng, O out, F pred, P proj = P{}) const
@@ -67,6 +180,36 @@ namespace ranges
             return (*this)(
                 begin(rng), end(rng), std::move(out), std::move(pred), std::move(proj));
         }
+
+        template<typename I, typename S, typename O, typename F, typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, O out, F pred,
+                        P proj = P{}) const -> CPP_ret(copy_if_result<I, O>)( //
+            requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                RandomAccessIterator<O> && IndirectUnaryPredicate<F, projected<I, P>> &&
+                    IndirectlyCopyable<I, O>)
+        {
+            auto const n = end - begin;
+            out = copy_if_fn::parallel_impl_(pol, begin, n, std::move(out), pred, proj);
+            return {begin + n, out};
+        }
+
+        template<typename Rng, typename O, typename F, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, O out, F pred,
+                        P proj = P{}) const
+            -> CPP_ret(copy_if_result<safe_iterator_t<Rng>, O>)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        RandomAccessIterator<O> &&
+                            IndirectUnaryPredicate<F, projected<iterator_t<Rng>, P>> &&
+                                IndirectlyCopyable<iterator_t<Rng>, O>)
+        {
+            return (*this)(pol,
+                           begin(rng),
+                           end(rng),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj));
+        }
     };
 
     /// \sa `copy_if_fn`
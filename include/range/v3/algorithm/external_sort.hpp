@@ -0,0 +1,516 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_EXTERNAL_SORT_HPP
+#define RANGES_V3_ALGORITHM_EXTERNAL_SORT_HPP
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/size_hint.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-algorithms
+    /// @{
+
+    /// \cond
+    namespace detail
+    {
+        // A file holding sorted runs. Named files are created exclusively in
+        // the requested directory and removed when closed; without a
+        // directory, std::tmpfile() picks the place and does the cleanup.
+        struct external_temp_file
+        {
+        private:
+            std::FILE * file_ = nullptr;
+            std::string path_;
+
+            static std::string next_name_(std::string const & dir)
+            {
+                static std::atomic<std::size_t> counter{0};
+                static std::size_t const salt = std::random_device{}();
+                char const last = dir.empty() ? '/' : dir.back();
+                return dir + (last == '/' || last == '\\' ? "" : "/") +
+                       "range-v3-external-sort-" + std::to_string(salt) + "-" +
+                       std::to_string(counter++);
+            }
+
+        public:
+            explicit external_temp_file(std::string const & dir)
+            {
+                if(dir.empty())
+                    file_ = std::tmpfile();
+                else
+                    for(int tries = 0; !file_ && tries != 100; ++tries)
+                    {
+                        path_ = next_name_(dir);
+                        file_ = std::fopen(path_.c_str(), "w+bx");
+                        if(!file_ && errno != EEXIST)
+                            break;
+                    }
+                if(!file_)
+                    throw std::system_error(
+                        errno, std::generic_category(),
+                        "external_sort: cannot create a temporary file in " +
+                            (dir.empty() ? std::string("the default directory") : dir));
+                // Reads and writes are done in large blocks already.
+                std::setvbuf(file_, nullptr, _IONBF, 0);
+            }
+            external_temp_file(external_temp_file const &) = delete;
+            external_temp_file & operator=(external_temp_file const &) = delete;
+            ~external_temp_file()
+            {
+                std::fclose(file_);
+                if(!path_.empty())
+                    std::remove(path_.c_str());
+            }
+            std::FILE * get() const noexcept
+            {
+                return file_;
+            }
+            void seek(std::uint64_t byte_offset) const
+            {
+#ifdef _WIN32
+                int const res = ::_fseeki64(file_, static_cast<__int64>(byte_offset), SEEK_SET);
+#else
+                int const res = ::fseeko(file_, static_cast<off_t>(byte_offset), SEEK_SET);
+#endif
+                if(res != 0)
+                    throw std::system_error(errno, std::generic_category(),
+                                            "external_sort: cannot seek in a temporary file");
+            }
+            void write(void const * data, std::size_t size, std::size_t n) const
+            {
+                if(n && std::fwrite(data, size, n, file_) != n)
+                    throw std::system_error(errno, std::generic_category(),
+                                            "external_sort: cannot write a temporary file");
+            }
+            void read(void * data, std::size_t size, std::size_t n) const
+            {
+                if(n && std::fread(data, size, n, file_) != n)
+                    throw std::system_error(std::ferror(file_) ? errno : EIO,
+                                            std::generic_category(),
+                                            "external_sort: cannot read a temporary file");
+            }
+        };
+
+        // A sorted run: size elements starting at element offset in file, or
+        // at data when the run never left memory.
+        template<typename T>
+        struct external_run
+        {
+            std::shared_ptr<external_temp_file> file;
+            std::size_t offset;
+            std::size_t size;
+            T const * data;
+        };
+
+        template<typename T>
+        struct external_run_reader
+        {
+        private:
+            external_run<T> run_;
+            std::size_t read_ = 0; // elements of the run read so far
+            std::vector<T> buf_;
+            T const * cur_ = nullptr;
+            T const * end_ = nullptr;
+
+        public:
+            external_run_reader(external_run<T> run, std::size_t block)
+              : run_(std::move(run))
+            {
+                if(run_.data)
+                {
+                    cur_ = run_.data;
+                    end_ = cur_ + run_.size;
+                    read_ = run_.size;
+                }
+                else
+                {
+                    buf_.resize(block < run_.size ? block : run_.size);
+                    refill();
+                }
+            }
+            bool empty() const noexcept
+            {
+                return cur_ == end_;
+            }
+            T const & front() const noexcept
+            {
+                return *cur_;
+            }
+            // Returns false once the run is exhausted.
+            bool pop()
+            {
+                return ++cur_ != end_ || refill();
+            }
+            bool refill()
+            {
+                std::size_t const n =
+                    buf_.size() < run_.size - read_ ? buf_.size() : run_.size - read_;
+                if(n == 0)
+                    return false;
+                // Several runs can share one file, so always seek.
+                run_.file->seek(std::uint64_t{run_.offset + read_} * sizeof(T));
+                run_.file->read(buf_.data(), sizeof(T), n);
+                read_ += n;
+                cur_ = buf_.data();
+                end_ = cur_ + n;
+                return true;
+            }
+        };
+
+        // A k-way merge of sorted runs using a binary heap of run indices.
+        template<typename T, typename C, typename P>
+        struct external_merger
+        {
+        private:
+            std::vector<external_run_reader<T>> readers_;
+            std::vector<std::size_t> heap_;
+            C pred_;
+            P proj_;
+
+            bool greater_(std::size_t a, std::size_t b)
+            {
+                return invoke(pred_,
+                              invoke(proj_, readers_[b].front()),
+                              invoke(proj_, readers_[a].front()));
+            }
+            void sift_down_(std::size_t i)
+            {
+                std::size_t const n = heap_.size();
+                std::size_t const top = heap_[i];
+                for(std::size_t child; (child = 2 * i + 1) < n; i = child)
+                {
+                    if(child + 1 < n && greater_(heap_[child], heap_[child + 1]))
+                        ++child;
+                    if(!greater_(top, heap_[child]))
+                        break;
+                    heap_[i] = heap_[child];
+                }
+                heap_[i] = top;
+            }
+
+        public:
+            external_merger(std::vector<external_run<T>> runs, std::size_t block, C pred,
+                            P proj)
+              : pred_(std::move(pred))
+              , proj_(std::move(proj))
+            {
+                readers_.reserve(runs.size());
+                for(auto & run : runs)
+                {
+                    readers_.emplace_back(std::move(run), block);
+                    if(!readers_.back().empty())
+                        heap_.push_back(readers_.size() - 1);
+                }
+                for(std::size_t i = heap_.size() / 2; i-- > 0;)
+                    sift_down_(i);
+            }
+            bool empty() const noexcept
+            {
+                return heap_.empty();
+            }
+            T const & front() const noexcept
+            {
+                return readers_[heap_.front()].front();
+            }
+            void pop()
+            {
+                if(!readers_[heap_.front()].pop())
+                {
+                    heap_.front() = heap_.back();
+                    heap_.pop_back();
+                }
+                if(!heap_.empty())
+                    sift_down_(0);
+            }
+        };
+
+        // At most this many runs are merged at once. Beyond it, groups of
+        // runs are merged into longer runs first, which keeps both the
+        // number of open files and the number of seeks per block in check.
+        constexpr std::size_t external_sort_max_fanin = 256;
+
+        // The sorted runs of an input range, ready to be merged. If the whole
+        // input fits in the memory budget it is sorted in place and never
+        // written out.
+        template<typename T, typename C, typename P>
+        struct external_sort_state
+        {
+        private:
+            std::vector<T> memory_;
+            std::vector<external_run<T>> runs_;
+            std::size_t budget_;
+            std::string dir_;
+            C pred_;
+            P proj_;
+
+            // Sorts memory_, in blocks on several threads if asked to, and
+            // adds the sorted blocks to runs_.
+            void sort_memory_(parallel_policy const * pol)
+            {
+                std::size_t const n = memory_.size();
+                std::size_t const blocks =
+                    pol ? detail::parallel_block_count(*pol, n, std::size_t{1} << 16) : 1;
+                T * const data = memory_.data();
+                detail::parallel_invoke_n(blocks, [&](std::size_t i) {
+                    auto const b = detail::parallel_block_bounds(n, blocks, i);
+                    ranges::sort(data + b.first, data + b.second, pred_, proj_);
+                });
+                for(std::size_t i = 0; i != blocks; ++i)
+                {
+                    auto const b = detail::parallel_block_bounds(n, blocks, i);
+                    runs_.push_back({nullptr, b.first, b.second - b.first, data + b.first});
+                }
+            }
+            // Sorts memory_ and writes it to a new file, one run per block.
+            void spill_(parallel_policy const * pol)
+            {
+                std::size_t const first = runs_.size();
+                sort_memory_(pol);
+                auto file = std::make_shared<external_temp_file>(dir_);
+                file->write(memory_.data(), sizeof(T), memory_.size());
+                for(std::size_t i = first; i != runs_.size(); ++i)
+                {
+                    runs_[i].file = file;
+                    runs_[i].data = nullptr;
+                }
+                memory_.clear();
+            }
+            std::size_t block_for_(std::size_t fanin) const noexcept
+            {
+                std::size_t const n = budget_ / (fanin * sizeof(T));
+                return n ? n : 1;
+            }
+            // Merges groups of runs until there are few enough to merge at once.
+            void reduce_runs_()
+            {
+                while(runs_.size() > external_sort_max_fanin)
+                {
+                    std::vector<external_run<T>> next;
+                    std::size_t const count = runs_.size();
+                    for(std::size_t lo = 0; lo < count; lo += external_sort_max_fanin)
+                    {
+                        std::size_t const hi = lo + external_sort_max_fanin < count
+                                                   ? lo + external_sort_max_fanin
+                                                   : count;
+                        if(hi - lo == 1)
+                        {
+                            next.push_back(std::move(runs_[lo]));
+                            continue;
+                        }
+                        std::vector<external_run<T>> group;
+                        std::size_t total = 0;
+                        for(std::size_t i = lo; i != hi; ++i)
+                        {
+                            total += runs_[i].size;
+                            group.push_back(std::move(runs_[i]));
+                        }
+                        // One block per input run, plus one for the output.
+                        std::size_t const block = block_for_(hi - lo + 1);
+                        auto file = std::make_shared<external_temp_file>(dir_);
+                        {
+                            external_merger<T, C, P> merger{
+                                std::move(group), block, pred_, proj_};
+                            std::vector<T> out;
+                            out.reserve(block);
+                            for(; !merger.empty(); merger.pop())
+                            {
+                                out.push_back(merger.front());
+                                if(out.size() == block)
+                                {
+                                    file->write(out.data(), sizeof(T), out.size());
+                                    out.clear();
+                                }
+                            }
+                            file->write(out.data(), sizeof(T), out.size());
+                        }
+                        next.push_back({std::move(file), 0, total, nullptr});
+                    }
+                    runs_ = std::move(next);
+                }
+            }
+
+        public:
+            template<typename I, typename S>
+            external_sort_state(I & first, S last, std::size_t memory_budget,
+                                std::string dir, C pred, P proj,
+                                parallel_policy const * pol, size_bounds hint)
+              : budget_(memory_budget)
+              , dir_(std::move(dir))
+              , pred_(std::move(pred))
+              , proj_(std::move(proj))
+            {
+                std::size_t const cap = memory_budget / sizeof(T) ? memory_budget / sizeof(T) : 1;
+                memory_.reserve(hint.upper < cap ? hint.upper : cap);
+                for(; first != last; ++first)
+                {
+                    memory_.push_back(*first);
+                    if(memory_.size() == cap)
+                        spill_(pol);
+                }
+                if(runs_.empty())
+                    sort_memory_(pol);
+                else
+                {
+                    if(!memory_.empty())
+                        spill_(pol);
+                    memory_.shrink_to_fit();
+                    reduce_runs_();
+                }
+            }
+            external_sort_state(external_sort_state const &) = delete;
+            external_sort_state & operator=(external_sort_state const &) = delete;
+
+            // The merger may read from memory_, so this object must outlive it.
+            external_merger<T, C, P> merge()
+            {
+                std::size_t const block = block_for_(runs_.empty() ? 1 : runs_.size());
+                return {std::move(runs_), block, pred_, proj_};
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    // clang-format off
+    CPP_def
+    (
+        template(typename I, typename C, typename P)
+        concept ExternallySortable,
+            InputIterator<I> &&
+            std::is_trivially_copyable<iter_value_t<I>>::value &&
+            DefaultConstructible<iter_value_t<I>> &&
+            IndirectlyCopyable<I, iter_value_t<I> *> &&
+            Sortable<iter_value_t<I> *, C, P>
+    );
+    // clang-format on
+
+    template<typename I, typename O>
+    using external_sort_result = detail::in_out_result<I, O>;
+
+    /// Sorts an input range that need not fit in memory, and writes the
+    /// result to \c out. The input is read in runs of at most
+    /// \c memory_budget bytes, which are sorted with `ranges::sort` and
+    /// written to temporary files in \c tmp_dir (the system's default
+    /// temporary directory if empty). The runs are then merged, at most 256
+    /// at a time, with the budget split between their read buffers. An input
+    /// that fits in the budget is sorted in memory. The value type must be
+    /// trivially copyable, since it is written to disk as raw bytes. Passing
+    /// `ranges::par` as the first argument sorts each run on several threads.
+    /// The sort is not stable. Errors creating, writing or reading the
+    /// temporary files are reported by throwing \c std::system_error.
+    struct external_sort_fn
+    {
+    private:
+        template<typename I, typename S, typename O, typename C, typename P>
+        static external_sort_result<I, O> impl_(parallel_policy const * pol, I first,
+                                                S last, O out, std::size_t memory_budget,
+                                                std::string const & tmp_dir, C pred,
+                                                P proj, size_bounds hint)
+        {
+            detail::external_sort_state<iter_value_t<I>, C, P> state{
+                first, std::move(last), memory_budget, tmp_dir,
+                std::move(pred), std::move(proj), pol, hint};
+            auto merger = state.merge();
+            for(; !merger.empty(); merger.pop(), ++out)
+                *out = merger.front();
+            return {first, out};
+        }
+
+    public:
+        template<typename I, typename S, typename O, typename C = less,
+                 typename P = identity>
+        auto operator()(I first, S last, O out, std::size_t memory_budget,
+                        std::string const & tmp_dir = {}, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(external_sort_result<I, O>)( //
+            requires ExternallySortable<I, C, P> && Sentinel<S, I> &&
+                WeaklyIncrementable<O> && IndirectlyCopyable<iter_value_t<I> const *, O>)
+        {
+            return impl_(nullptr, std::move(first), std::move(last), std::move(out),
+                         memory_budget, tmp_dir, std::move(pred), std::move(proj), size_bounds{});
+        }
+
+        template<typename Rng, typename O, typename C = less, typename P = identity>
+        auto operator()(Rng && rng, O out, std::size_t memory_budget,
+                        std::string const & tmp_dir = {}, C pred = C{}, P proj = P{}) const
+            -> CPP_ret(external_sort_result<safe_iterator_t<Rng>, O>)( //
+                requires InputRange<Rng> && ExternallySortable<iterator_t<Rng>, C, P> &&
+                    WeaklyIncrementable<O> &&
+                    IndirectlyCopyable<range_value_t<Rng> const *, O>)
+        {
+            return impl_(nullptr, begin(rng), end(rng), std::move(out), memory_budget,
+                         tmp_dir, std::move(pred), std::move(proj),
+                         ranges::size_hint(rng));
+        }
+
+        template<typename I, typename S, typename O, typename C = less,
+                 typename P = identity>
+        auto operator()(parallel_policy pol, I first, S last, O out,
+                        std::size_t memory_budget, std::string const & tmp_dir = {},
+                        C pred = C{}, P proj = P{}) const
+            -> CPP_ret(external_sort_result<I, O>)( //
+                requires ExternallySortable<I, C, P> && Sentinel<S, I> &&
+                    WeaklyIncrementable<O> &&
+                    IndirectlyCopyable<iter_value_t<I> const *, O>)
+        {
+            return impl_(&pol, std::move(first), std::move(last), std::move(out),
+                         memory_budget, tmp_dir, std::move(pred), std::move(proj), size_bounds{});
+        }
+
+        template<typename Rng, typename O, typename C = less, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, O out, std::size_t memory_budget,
+                        std::string const & tmp_dir = {}, C pred = C{}, P proj = P{}) const
+            -> CPP_ret(external_sort_result<safe_iterator_t<Rng>, O>)( //
+                requires InputRange<Rng> && ExternallySortable<iterator_t<Rng>, C, P> &&
+                    WeaklyIncrementable<O> &&
+                    IndirectlyCopyable<range_value_t<Rng> const *, O>)
+        {
+            return impl_(&pol, begin(rng), end(rng), std::move(out), memory_budget,
+                         tmp_dir, std::move(pred), std::move(proj),
+                         ranges::size_hint(rng));
+        }
+    };
+
+    /// \sa `external_sort_fn`
+    /// \ingroup group-algorithms
+    RANGES_INLINE_VARIABLE(external_sort_fn, external_sort)
+    /// @}
+} // namespace ranges
+
+#endif // include guard
@@ -25,12 +25,19 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. The threads take chunks of the range in turn and search
+    /// them, and stop as soon as a match is found before their next chunk,
+    /// so \c pred may be evaluated on some elements past the first match.
+    /// The result is the first match, as with the sequential algorithm.
     struct find_if_fn
     {
         /// \brief template function \c find_fn::operator()
@@ -64,6 +71,35 @@ namespace ranges
         {
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
+
+        /// \overload
+        template<typename I, typename S, typename F, typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, F pred, P proj = P{}) const
+            -> CPP_ret(I)( //
+                requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                    IndirectUnaryPredicate<F, projected<I, P>>)
+        {
+            using D = iter_difference_t<I>;
+            auto const n = static_cast<std::size_t>(end - begin);
+            auto const test = [&](std::size_t lo, std::size_t hi) {
+                for(I it = begin + static_cast<D>(lo); lo != hi; ++lo, ++it)
+                    if(invoke(pred, invoke(proj, *it)))
+                        break;
+                return lo;
+            };
+            return begin + static_cast<D>(detail::parallel_find_first(pol, n, test));
+        }
+
+        /// \overload
+        template<typename Rng, typename F, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, F pred, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        IndirectUnaryPredicate<F, projected<iterator_t<Rng>, P>>)
+        {
+            return (*this)(pol, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `find_if_fn`
@@ -21,6 +21,7 @@
 #ifndef RANGES_V3_ALGORITHM_INPLACE_MERGE_HPP
 #define RANGES_V3_ALGORITHM_INPLACE_MERGE_HPP
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <new>
@@ -34,6 +35,7 @@
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/algorithm/rotate.hpp>
 #include <range/v3/algorithm/upper_bound.hpp>
+#include <range/v3/detail/merge_path.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
@@ -48,6 +50,8 @@
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/scratch_buffer.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/swap.hpp>
 
@@ -242,13 +246,94 @@ namespace ranges
 
     /// \addtogroup group-algorithms
     /// @{
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators whose reference type is an lvalue reference to the value
+    /// type, and a value type that can be moved without throwing; otherwise
+    /// they merge sequentially. They move the elements into a temporary
+    /// buffer in parallel, then merge them back like the parallel `merge`.
+    /// If there is no memory for the buffer, they merge sequentially.
     struct inplace_merge_fn
     {
-        // TODO reimplement to only need forward iterators
-        template<typename I, typename S, typename C = less, typename P = identity>
-        auto operator()(I begin, I middle, S end, C pred = C{}, P proj = P{}) const
-            -> CPP_ret(I)( //
-                requires BidirectionalIterator<I> && Sortable<I, C, P>)
+    private:
+        template<typename I, typename C, typename P>
+        static void parallel_impl_(parallel_policy pol, I begin, iter_difference_t<I> n0,
+                                   iter_difference_t<I> n, C & pred, P & proj,
+                                   std::true_type)
+        {
+            using V = iter_value_t<I>;
+            using D = iter_difference_t<I>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size, detail::compact_grain);
+            std::pair<V *, std::ptrdiff_t> buf{nullptr, 0};
+            std::unique_ptr<V, detail::return_temporary_buffer> h;
+            if(count > 1)
+            {
+                buf = detail::get_temporary_buffer<V>(n);
+                h.reset(buf.first);
+            }
+            if(count <= 1 || buf.second < static_cast<std::ptrdiff_t>(n))
+            {
+                h.reset();
+                return parallel_impl_(
+                    pol, std::move(begin), n0, n, pred, proj, std::false_type{});
+            }
+            V * const tmp = buf.first;
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                I it = begin + static_cast<D>(bnd.first);
+                for(std::size_t k = bnd.first; k < bnd.second; ++k, ++it)
+                    ::new((void *)(tmp + k)) V(iter_move(it));
+            });
+            std::size_t const size0 = static_cast<std::size_t>(n0);
+            auto const splits = detail::merge_path_partition(
+                tmp, size0, tmp + size0, size - size0, count, pred, proj, proj, false);
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                V * b0 = tmp + splits[b].first;
+                V * const e0 = tmp + splits[b + 1].first;
+                V * b1 = tmp + size0 + splits[b].second;
+                V * const e1 = tmp + size0 + splits[b + 1].second;
+                I out = begin + static_cast<D>(splits[b].first + splits[b].second);
+                auto destroy = [&] {
+                    for(V * p = tmp + splits[b].first; p != e0; ++p)
+                        p->~V();
+                    for(V * p = tmp + size0 + splits[b].second; p != e1; ++p)
+                        p->~V();
+                };
+                try
+                {
+                    for(; b0 != e0 && b1 != e1; ++out)
+                    {
+                        if(invoke(pred, invoke(proj, *b1), invoke(proj, *b0)))
+                            *out = std::move(*b1++);
+                        else
+                            *out = std::move(*b0++);
+                    }
+                    for(; b0 != e0; ++b0, ++out)
+                        *out = std::move(*b0);
+                    for(; b1 != e1; ++b1, ++out)
+                        *out = std::move(*b1);
+                }
+                catch(...)
+                {
+                    destroy();
+                    throw;
+                }
+                destroy();
+            });
+        }
+        template<typename I, typename C, typename P>
+        static void parallel_impl_(parallel_policy, I begin, iter_difference_t<I> n0,
+                                   iter_difference_t<I> n, C & pred, P & proj,
+                                   std::false_type)
+        {
+            inplace_merge_fn{}(
+                begin, begin + n0, begin + n, std::ref(pred), std::ref(proj));
+        }
+
+        template<typename I, typename S, typename C, typename P>
+        static I impl_(I begin, I middle, S end, C & pred, P & proj,
+                       scratch_buffer * scratch)
         {
             using value_type = iter_value_t<I>;
             auto len1 = distance(begin, middle);
@@ -256,10 +341,12 @@ namespace ranges
             auto buf_size = ranges::min(len1, len2_and_end.first);
             std::pair<value_type *, std::ptrdiff_t> buf{nullptr, 0};
             std::unique_ptr<value_type, detail::return_temporary_buffer> h;
-            if(detail::is_trivially_copy_assignable<value_type>::value && 8 < buf_size)
+            if(detail::is_trivially_copy_assignable<value_type>::value &&
+               (scratch ? 0 : 8) < buf_size)
             {
-                buf = detail::get_temporary_buffer<value_type>(buf_size);
-                h.reset(buf.first);
+                buf = detail::get_temporary_buffer<value_type>(scratch, buf_size);
+                if(!scratch)
+                    h.reset(buf.first);
             }
             detail::merge_adaptive(std::move(begin),
                                    std::move(middle),
@@ -268,11 +355,26 @@ namespace ranges
                                    len2_and_end.first,
                                    buf.first,
                                    buf.second,
-                                   std::move(pred),
-                                   std::move(proj));
+                                   std::ref(pred),
+                                   std::ref(proj));
             return len2_and_end.second;
         }
 
+    public:
+        // TODO reimplement to only need forward iterators
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(I begin, I middle, S end, C pred = C{}, P proj = P{}) const
+            -> CPP_ret(I)( //
+                requires BidirectionalIterator<I> && Sortable<I, C, P>)
+        {
+            return inplace_merge_fn::impl_(std::move(begin),
+                                           std::move(middle),
+                                           std::move(end),
+                                           pred,
+                                           proj,
+                                           nullptr);
+        }
+
         template<typename Rng, typename C = less, typename P = identity>
         auto operator()(Rng && rng, iterator_t<Rng> middle, C pred = C{},
                         P proj = P{}) const -> CPP_ret(safe_iterator_t<Rng>)( //
@@ -284,6 +386,70 @@ namespace ranges
                            std::move(pred),
                            std::move(proj));
         }
+
+        /// \overload
+        /// Takes its temporary buffer from \c scratch, which it grows if need
+        /// be, rather than allocating one.
+        /// \sa `scratch_buffer`
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(scratch_buffer & scratch, I begin, I middle, S end,
+                        C pred = C{}, P proj = P{}) const -> CPP_ret(I)( //
+            requires BidirectionalIterator<I> && Sortable<I, C, P>)
+        {
+            return inplace_merge_fn::impl_(std::move(begin),
+                                           std::move(middle),
+                                           std::move(end),
+                                           pred,
+                                           proj,
+                                           &scratch);
+        }
+
+        /// \overload
+        template<typename Rng, typename C = less, typename P = identity>
+        auto operator()(scratch_buffer & scratch, Rng && rng, iterator_t<Rng> middle,
+                        C pred = C{}, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires BidirectionalRange<Rng> && Sortable<iterator_t<Rng>, C, P>)
+        {
+            return (*this)(scratch,
+                           begin(rng),
+                           std::move(middle),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
+
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(parallel_policy pol, I begin, I middle, S end, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(I)( //
+            requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                Sortable<I, C, P>)
+        {
+            using V = iter_value_t<I>;
+            using movable_t =
+                meta::bool_<std::is_same<iter_reference_t<I>, V &>::value &&
+                            std::is_nothrow_move_constructible<V>::value>;
+            auto const n = end - begin;
+            inplace_merge_fn::parallel_impl_(
+                pol, begin, middle - begin, n, pred, proj, movable_t{});
+            return begin + n;
+        }
+
+        template<typename Rng, typename C = less, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, iterator_t<Rng> middle,
+                        C pred = C{}, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        Sortable<iterator_t<Rng>, C, P>)
+        {
+            return (*this)(pol,
+                           begin(rng),
+                           std::move(middle),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
     };
 
     /// \sa `inplace_merge_fn`
@@ -29,12 +29,15 @@
 #ifndef RANGES_V3_ALGORITHM_MERGE_HPP
 #define RANGES_V3_ALGORITHM_MERGE_HPP
 
+#include <cstddef>
+#include <functional>
 #include <tuple>
 
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/detail/merge_path.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
@@ -43,6 +46,7 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -52,8 +56,49 @@ namespace ranges
     template<typename I0, typename I1, typename O>
     using merge_result = detail::in1_in2_out_result<I0, I1, O>;
 
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. They split the output into blocks of nearly equal size, find
+    /// where each block starts in the two inputs with a binary search (the
+    /// "merge path"), and merge the blocks in parallel. The output is the
+    /// same as with the sequential algorithm.
     struct merge_fn
     {
+    private:
+        template<typename I0, typename I1, typename O, typename C, typename P0,
+                 typename P1>
+        static O parallel_impl_(parallel_policy pol, I0 begin0, iter_difference_t<I0> n0,
+                                I1 begin1, iter_difference_t<I1> n1, O out, C & pred,
+                                P0 & proj0, P1 & proj1)
+        {
+            std::size_t const size0 = static_cast<std::size_t>(n0);
+            std::size_t const size1 = static_cast<std::size_t>(n1);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size0 + size1, detail::compact_grain);
+            if(count <= 1)
+                return merge_fn{}(begin0, begin0 + n0, begin1, begin1 + n1,
+                                  std::move(out), std::ref(pred), std::ref(proj0),
+                                  std::ref(proj1))
+                    .out;
+            auto const splits = detail::merge_path_partition(
+                begin0, size0, begin1, size1, count, pred, proj0, proj1, false);
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                using D0 = iter_difference_t<I0>;
+                using D1 = iter_difference_t<I1>;
+                auto const & lo = splits[b];
+                auto const & hi = splits[b + 1];
+                merge_fn{}(begin0 + static_cast<D0>(lo.first),
+                           begin0 + static_cast<D0>(hi.first),
+                           begin1 + static_cast<D1>(lo.second),
+                           begin1 + static_cast<D1>(hi.second),
+                           out + static_cast<iter_difference_t<O>>(lo.first + lo.second),
+                           std::ref(pred),
+                           std::ref(proj0),
+                           std::ref(proj1));
+            });
+            return out + static_cast<iter_difference_t<O>>(size0 + size1);
+        }
+
+    public:
         template<typename I0, typename S0, typename I1, typename S1, typename O,
                  typename C = less, typename P0 = identity, typename P1 = identity>
         auto operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, O out, C pred = C{},
@@ -97,6 +142,46 @@ namespace ranges
                            std::move(proj0),
                            std::move(proj1));
         }
+
+        template<typename I0, typename S0, typename I1, typename S1, typename O,
+                 typename C = less, typename P0 = identity, typename P1 = identity>
+        auto operator()(parallel_policy pol, I0 begin0, S0 end0, I1 begin1, S1 end1,
+                        O out, C pred = C{}, P0 proj0 = P0{}, P1 proj1 = P1{}) const
+            -> CPP_ret(merge_result<I0, I1, O>)( //
+                requires RandomAccessIterator<I0> && SizedSentinel<S0, I0> &&
+                    RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+                        RandomAccessIterator<O> && Mergeable<I0, I1, O, C, P0, P1>)
+        {
+            auto const n0 = end0 - begin0;
+            auto const n1 = end1 - begin1;
+            out = merge_fn::parallel_impl_(
+                pol, begin0, n0, begin1, n1, std::move(out), pred, proj0, proj1);
+            return {begin0 + n0, begin1 + n1, out};
+        }
+
+        template<typename Rng0, typename Rng1, typename O, typename C = less,
+                 typename P0 = identity, typename P1 = identity>
+        auto operator()(parallel_policy pol, Rng0 && rng0, Rng1 && rng1, O out,
+                        C pred = C{}, P0 proj0 = P0{}, P1 proj1 = P1{}) const
+            -> CPP_ret(merge_result<safe_iterator_t<Rng0>, safe_iterator_t<Rng1>, O>)( //
+                requires RandomAccessRange<Rng0> &&
+                    SizedSentinel<sentinel_t<Rng0>, iterator_t<Rng0>> &&
+                        RandomAccessRange<Rng1> &&
+                            SizedSentinel<sentinel_t<Rng1>, iterator_t<Rng1>> &&
+                                RandomAccessIterator<O> &&
+                                    Mergeable<iterator_t<Rng0>, iterator_t<Rng1>, O, C,
+                                              P0, P1>)
+        {
+            return (*this)(pol,
+                           begin(rng0),
+                           end(rng0),
+                           begin(rng1),
+                           end(rng1),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj0),
+                           std::move(proj1));
+        }
     };
 
     /// \sa `merge_fn`
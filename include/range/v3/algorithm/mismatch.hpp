@@ -29,6 +29,7 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -38,6 +39,11 @@ namespace ranges
     template<typename I1, typename I2>
     using mismatch_result = detail::in1_in2_result<I1, I2>;
 
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. The threads take chunks of the sequences in turn and
+    /// compare them, and stop as soon as a mismatch is found before their
+    /// next chunk. The result is the first mismatch, as with the sequential
+    /// algorithm.
     struct mismatch_fn
     {
         template<typename I1, typename S1, typename I2, typename C = equal_to,
@@ -112,6 +118,53 @@ namespace ranges
                            std::move(proj1),
                            std::move(proj2));
         }
+
+        template<typename I1, typename S1, typename I2, typename S2,
+                 typename C = equal_to, typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, I1 begin1, S1 end1, I2 begin2, S2 end2,
+                        C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(mismatch_result<I1, I2>)( //
+                requires RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+                    RandomAccessIterator<I2> && SizedSentinel<S2, I2> &&
+                        IndirectRelation<C, projected<I1, P1>, projected<I2, P2>>)
+        {
+            using D1 = iter_difference_t<I1>;
+            using D2 = iter_difference_t<I2>;
+            auto const n1 = static_cast<std::size_t>(end1 - begin1);
+            auto const n2 = static_cast<std::size_t>(end2 - begin2);
+            auto const test = [&](std::size_t lo, std::size_t hi) {
+                I1 it1 = begin1 + static_cast<D1>(lo);
+                I2 it2 = begin2 + static_cast<D2>(lo);
+                for(; lo != hi; ++lo, ++it1, ++it2)
+                    if(!invoke(pred, invoke(proj1, *it1), invoke(proj2, *it2)))
+                        break;
+                return lo;
+            };
+            auto const i = detail::parallel_find_first(pol, n1 < n2 ? n1 : n2, test);
+            return {begin1 + static_cast<D1>(i), begin2 + static_cast<D2>(i)};
+        }
+
+        template<typename Rng1, typename Rng2, typename C = equal_to,
+                 typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, Rng1 && rng1, Rng2 && rng2, C pred = C{},
+                        P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(mismatch_result<safe_iterator_t<Rng1>, safe_iterator_t<Rng2>>)( //
+                requires RandomAccessRange<Rng1> &&
+                    SizedSentinel<sentinel_t<Rng1>, iterator_t<Rng1>> &&
+                        RandomAccessRange<Rng2> &&
+                            SizedSentinel<sentinel_t<Rng2>, iterator_t<Rng2>> &&
+                                IndirectRelation<C, projected<iterator_t<Rng1>, P1>,
+                                                 projected<iterator_t<Rng2>, P2>>)
+        {
+            return (*this)(pol,
+                           begin(rng1),
+                           end(rng1),
+                           begin(rng2),
+                           end(rng2),
+                           std::move(pred),
+                           std::move(proj1),
+                           std::move(proj2));
+        }
     };
 
     /// \sa `mismatch_fn`
@@ -27,6 +27,7 @@
 
 #include <range/v3/range_fwd.hpp>
 
+#include <range/v3/algorithm/aux_/cached_key.hpp>
 #include <range/v3/algorithm/min_element.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
@@ -310,6 +311,36 @@ namespace ranges
             return (*this)(
                 begin(rng), std::move(nth), end(rng), std::move(pred), std::move(proj));
         }
+
+        /// \overload
+        /// Evaluates \c proj once per element. \sa `cache_keys_t`
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(cache_keys_t, I begin, I nth, S end_, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(I)( //
+            requires CachedKeySortable<I, C, P> && Sentinel<S, I>)
+        {
+            I end = ranges::next(nth, std::move(end_));
+            auto keys = detail::make_cached_keys(begin, end - begin, proj);
+            (*this)(keys,
+                    ranges::begin(keys) + (nth - begin),
+                    detail::cached_key_less<C>{&pred});
+            detail::permute_by_cached_keys(begin, keys);
+            return end;
+        }
+
+        /// \overload
+        template<typename Rng, typename C = less, typename P = identity>
+        auto operator()(cache_keys_t ck, Rng && rng, iterator_t<Rng> nth, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(safe_iterator_t<Rng>)( //
+            requires CachedKeySortable<iterator_t<Rng>, C, P> && RandomAccessRange<Rng>)
+        {
+            return (*this)(ck,
+                           begin(rng),
+                           std::move(nth),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
     };
 
     /// \sa `nth_element_fn`
@@ -17,11 +17,13 @@
 
 #include <range/v3/range_fwd.hpp>
 
+#include <range/v3/algorithm/aux_/cached_key.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/iterator/traits.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
@@ -67,6 +69,36 @@ namespace ranges
                            std::move(pred),
                            std::move(proj));
         }
+
+        /// \overload
+        /// Evaluates \c proj once per element. \sa `cache_keys_t`
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(cache_keys_t, I begin, I middle, S end_, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(I)( //
+            requires CachedKeySortable<I, C, P> && Sentinel<S, I>)
+        {
+            I end = ranges::next(middle, std::move(end_));
+            auto keys = detail::make_cached_keys(begin, end - begin, proj);
+            (*this)(keys,
+                    ranges::begin(keys) + (middle - begin),
+                    detail::cached_key_less<C>{&pred});
+            detail::permute_by_cached_keys(begin, keys);
+            return end;
+        }
+
+        /// \overload
+        template<typename Rng, typename C = less, typename P = identity>
+        auto operator()(cache_keys_t ck, Rng && rng, iterator_t<Rng> middle, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(safe_iterator_t<Rng>)( //
+            requires CachedKeySortable<iterator_t<Rng>, C, P> && RandomAccessRange<Rng>)
+        {
+            return (*this)(ck,
+                           begin(rng),
+                           std::move(middle),
+                           end(rng),
+                           std::move(pred),
+                           std::move(proj));
+        }
     };
 
     /// \sa `partial_sort_fn`
@@ -21,6 +21,12 @@
 #ifndef RANGES_V3_ALGORITHM_PARTITION_HPP
 #define RANGES_V3_ALGORITHM_PARTITION_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
 #include <meta/meta.hpp>
 
 #include <range/v3/range_fwd.hpp>
@@ -34,6 +40,7 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/swap.hpp>
 
@@ -41,9 +48,105 @@ namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. They partition blocks of the sequence on several threads
+    /// at once. Then the elements of the blocks that landed on the wrong side
+    /// of the final partition point, falses before it and trues after it,
+    /// of which there are equally many, are swapped pairwise, again in
+    /// parallel. Each element moves at most twice.
     struct partition_fn
     {
     private:
+        // Runs of positions, as [first, last) pairs, with the number of
+        // positions in the runs before each. Empty runs are not kept, so that
+        // stepping off the end of one run always lands in the next.
+        struct runs_
+        {
+            std::vector<std::pair<std::size_t, std::size_t>> runs;
+            std::vector<std::size_t> before;
+
+            void push_back(std::size_t first, std::size_t last)
+            {
+                if(first == last)
+                    return;
+                before.push_back(before.empty() ? 0
+                                                : before.back() + runs.back().second -
+                                                      runs.back().first);
+                runs.emplace_back(first, last);
+            }
+            // The run holding the k-th position, and the position.
+            std::pair<std::size_t, std::size_t> find(std::size_t k) const
+            {
+                std::size_t const r = static_cast<std::size_t>(
+                    std::upper_bound(before.begin(), before.end(), k) - before.begin() -
+                    1);
+                return {r, runs[r].first + (k - before[r])};
+            }
+        };
+
+        template<typename I, typename C, typename P>
+        static I parallel_impl_(parallel_policy pol, I begin, iter_difference_t<I> n,
+                                C & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size, detail::compact_grain);
+            if(count <= 1)
+                return partition_fn::impl(begin, begin + n, std::ref(pred),
+                                          std::ref(proj), iterator_tag_of<I>());
+            std::vector<std::size_t> mids(count);
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                mids[b] = static_cast<std::size_t>(
+                    partition_fn::impl(begin + static_cast<D>(bnd.first),
+                                       begin + static_cast<D>(bnd.second),
+                                       std::ref(pred),
+                                       std::ref(proj),
+                                       iterator_tag_of<I>()) -
+                    begin);
+            });
+            std::size_t trues = 0;
+            for(std::size_t b = 0; b < count; ++b)
+                trues += mids[b] - detail::parallel_block_bounds(size, count, b).first;
+            runs_ falses_before, trues_after;
+            std::size_t misplaced = 0;
+            for(std::size_t b = 0; b < count; ++b)
+            {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                if(mids[b] < trues)
+                {
+                    std::size_t const last = (std::min)(bnd.second, trues);
+                    falses_before.push_back(mids[b], last);
+                    misplaced += last - mids[b];
+                }
+                if(mids[b] > trues)
+                    trues_after.push_back((std::max)(bnd.first, trues), mids[b]);
+            }
+            if(misplaced == 0)
+                return begin + static_cast<D>(trues);
+            std::size_t const chunks =
+                detail::parallel_block_count(pol, misplaced, detail::compact_grain);
+            detail::parallel_invoke_n(chunks, [&](std::size_t c) {
+                auto const bnd = detail::parallel_block_bounds(misplaced, chunks, c);
+                auto f = falses_before.find(bnd.first);
+                auto t = trues_after.find(bnd.first);
+                for(std::size_t k = bnd.first; k != bnd.second; ++k)
+                {
+                    ranges::iter_swap(begin + static_cast<D>(f.second),
+                                      begin + static_cast<D>(t.second));
+                    if(++f.second == falses_before.runs[f.first].second &&
+                       ++f.first != falses_before.runs.size())
+                        f.second = falses_before.runs[f.first].first;
+                    if(++t.second == trues_after.runs[t.first].second &&
+                       ++t.first != trues_after.runs.size())
+                        t.second = trues_after.runs[t.first].first;
+                }
+            });
+            return begin + static_cast<D>(trues);
+        }
+
         template<typename I, typename S, typename C, typename P>
         static I impl(I begin, S end, C pred, P proj, detail::forward_iterator_tag_)
         {
@@ -116,6 +219,26 @@ namespace ranges
                                       std::move(proj),
                                       iterator_tag_of<iterator_t<Rng>>());
         }
+
+        template<typename I, typename S, typename C, typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, C pred, P proj = P{}) const
+            -> CPP_ret(I)( //
+                requires Permutable<I> && RandomAccessIterator<I> &&
+                    SizedSentinel<S, I> && IndirectUnaryPredicate<C, projected<I, P>>)
+        {
+            return partition_fn::parallel_impl_(pol, begin, end - begin, pred, proj);
+        }
+
+        template<typename Rng, typename C, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, C pred, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        Permutable<iterator_t<Rng>> &&
+                            IndirectUnaryPredicate<C, projected<iterator_t<Rng>, P>>)
+        {
+            return (*this)(pol, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `partition_fn`
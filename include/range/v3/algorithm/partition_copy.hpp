@@ -13,7 +13,11 @@
 #ifndef RANGES_V3_ALGORITHM_PARTITION_COPY_HPP
 #define RANGES_V3_ALGORITHM_PARTITION_COPY_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <tuple>
+#include <vector>
 
 #include <meta/meta.hpp>
 
@@ -29,6 +33,7 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -38,8 +43,76 @@ namespace ranges
     template<typename I, typename O0, typename O1>
     using partition_copy_result = detail::in_out1_out2_result<I, O0, O1>;
 
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators, and work like those of \c copy_if: \c pred is evaluated
+    /// once per element in parallel, and then each block is copied to where
+    /// its elements go in both outputs. Both outputs are in the same order
+    /// as with the sequential algorithm.
     struct partition_copy_fn
     {
+    private:
+        template<typename I, typename O0, typename O1, typename C, typename P>
+        static partition_copy_result<I, O0, O1> parallel_impl_(parallel_policy pol,
+                                                               I begin,
+                                                               iter_difference_t<I> n,
+                                                               O0 o0, O1 o1, C & pred,
+                                                               P & proj)
+        {
+            using D = iter_difference_t<I>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size, detail::compact_grain);
+            if(count <= 1)
+                return partition_copy_fn{}(begin, begin + n, std::move(o0), std::move(o1),
+                                           std::ref(pred), std::ref(proj));
+            // A bit per element, set if it goes to o0.
+            std::vector<std::vector<std::uint64_t>> which(count);
+            // The number of elements before each block that go to o0.
+            std::vector<std::size_t> offsets(count + 1, 0);
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                std::size_t const len = bnd.second - bnd.first;
+                auto & w = which[b];
+                w.resize((len + 63) / 64);
+                I it = begin + static_cast<D>(bnd.first);
+                std::size_t trues = 0;
+                for(std::size_t i = 0; i < len; ++i, ++it)
+                {
+                    bool const x = invoke(pred, invoke(proj, *it));
+                    w[i / 64] |= std::uint64_t{x} << (i % 64);
+                    trues += x;
+                }
+                offsets[b + 1] = trues;
+            });
+            for(std::size_t b = 0; b < count; ++b)
+                offsets[b + 1] += offsets[b];
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                std::size_t const len = bnd.second - bnd.first;
+                auto const & w = which[b];
+                I it = begin + static_cast<D>(bnd.first);
+                O0 t = o0 + static_cast<iter_difference_t<O0>>(offsets[b]);
+                O1 f = o1 + static_cast<iter_difference_t<O1>>(bnd.first - offsets[b]);
+                for(std::size_t i = 0; i < len; ++i, ++it)
+                {
+                    if((w[i / 64] >> (i % 64)) & 1u)
+                    {
+                        *t = *it;
+                        ++t;
+                    }
+                    else
+                    {
+                        *f = *it;
+                        ++f;
+                    }
+                }
+            });
+            return {begin + n,
+                    o0 + static_cast<iter_difference_t<O0>>(offsets[count]),
+                    o1 + static_cast<iter_difference_t<O1>>(size - offsets[count])};
+        }
+
+    public:
         template<typename I, typename S, typename O0, typename O1, typename C,
                  typename P = identity>
         auto operator()(I begin, S end, O0 o0, O1 o1, C pred, P proj = P{}) const
@@ -82,6 +155,42 @@ namespace ranges
                            std::move(pred),
                            std::move(proj));
         }
+
+        template<typename I, typename S, typename O0, typename O1, typename C,
+                 typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, O0 o0, O1 o1, C pred,
+                        P proj = P{}) const
+            -> CPP_ret(partition_copy_result<I, O0, O1>)( //
+                requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                    RandomAccessIterator<O0> && RandomAccessIterator<O1> &&
+                        IndirectlyCopyable<I, O0> && IndirectlyCopyable<I, O1> &&
+                            IndirectUnaryPredicate<C, projected<I, P>>)
+        {
+            return partition_copy_fn::parallel_impl_(
+                pol, begin, end - begin, std::move(o0), std::move(o1), pred, proj);
+        }
+
+        template<typename Rng, typename O0, typename O1, typename C,
+                 typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, O0 o0, O1 o1, C pred,
+                        P proj = P{}) const
+            -> CPP_ret(partition_copy_result<safe_iterator_t<Rng>, O0, O1>)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        RandomAccessIterator<O0> && RandomAccessIterator<O1> &&
+                            IndirectlyCopyable<iterator_t<Rng>, O0> &&
+                                IndirectlyCopyable<iterator_t<Rng>, O1> &&
+                                    IndirectUnaryPredicate<
+                                        C, projected<iterator_t<Rng>, P>>)
+        {
+            return (*this)(pol,
+                           begin(rng),
+                           end(rng),
+                           std::move(o0),
+                           std::move(o1),
+                           std::move(pred),
+                           std::move(proj));
+        }
     };
 
     /// \sa `partition_copy_fn`
@@ -13,11 +13,17 @@
 #ifndef RANGES_V3_ALGORITHM_REMOVE_IF_HPP
 #define RANGES_V3_ALGORITHM_REMOVE_IF_HPP
 
+#include <cstddef>
+#include <functional>
+#include <vector>
+
 #include <meta/meta.hpp>
 
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/detail/simd_compact.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
@@ -27,18 +33,53 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. They remove the elements from blocks of the sequence on
+    /// several threads at once, and then move the elements each block kept
+    /// down to follow those of the blocks before it, in one pass on the
+    /// calling thread. The elements kept are in their original order.
     struct remove_if_fn
     {
-        template<typename I, typename S, typename C, typename P = identity>
-        auto operator()(I begin, S end, C pred, P proj = P{}) const -> CPP_ret(I)( //
-            requires Permutable<I> && Sentinel<S, I> &&
-                IndirectUnaryPredicate<C, projected<I, P>>)
+    private:
+        template<typename I, typename C, typename P>
+        static I parallel_impl_(parallel_policy pol, I begin, iter_difference_t<I> n,
+                                C & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size, detail::compact_grain);
+            if(count <= 1)
+                return remove_if_fn{}(begin, begin + n, std::ref(pred), std::ref(proj));
+            // Where the elements kept by each block end.
+            std::vector<I> ends(count);
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                ends[b] = remove_if_fn{}(begin + static_cast<D>(bnd.first),
+                                         begin + static_cast<D>(bnd.second),
+                                         std::ref(pred),
+                                         std::ref(proj));
+            });
+            I out = ends[0];
+            for(std::size_t b = 1; b < count; ++b)
+            {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                I const first = begin + static_cast<D>(bnd.first);
+                out = first == out ? ends[b] : ranges::move(first, ends[b], out).out;
+            }
+            return out;
+        }
+
+        template<typename I, typename S, typename C, typename P>
+        static I impl_(I begin, S end, C & pred, P & proj, std::false_type)
         {
             begin = find_if(std::move(begin), end, std::ref(pred), std::ref(proj));
             if(begin != end)
@@ -54,6 +95,36 @@ namespace ranges
             }
             return begin;
         }
+        template<typename I, typename S, typename C, typename P>
+        static I impl_(I begin, S end, C & pred, P &, std::true_type)
+        {
+            auto const n = end - begin;
+            if(n <= 0)
+                return begin;
+            auto * const p = detail::addressof(*begin);
+            return begin + static_cast<iter_difference_t<I>>(
+                               detail::simd_compact<false, true>(
+                                   p, static_cast<std::size_t>(n), p, pred));
+        }
+
+    public:
+        /// When \c I is contiguous, its elements are 32- or 64-bit integers or
+        /// floating-point numbers, there is no projection, and \c pred is one
+        /// of the predicates in \c ranges::pred or its negation, the elements
+        /// are tested and moved with AVX2 or AVX-512 instructions, if the
+        /// processor has them.
+        template<typename I, typename S, typename C, typename P = identity>
+        auto operator()(I begin, S end, C pred, P proj = P{}) const -> CPP_ret(I)( //
+            requires Permutable<I> && Sentinel<S, I> &&
+                IndirectUnaryPredicate<C, projected<I, P>>)
+        {
+            return remove_if_fn::impl_(
+                std::move(begin),
+                std::move(end),
+                pred,
+                proj,
+                meta::bool_<detail::simd_compactable_<I, S, C, P>::value>{});
+        }
 
         template<typename Rng, typename C, typename P = identity>
         auto operator()(Rng && rng, C pred, P proj = P{}) const
@@ -63,6 +134,26 @@ namespace ranges
         {
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
+
+        template<typename I, typename S, typename C, typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, C pred, P proj = P{}) const
+            -> CPP_ret(I)( //
+                requires Permutable<I> && RandomAccessIterator<I> &&
+                    SizedSentinel<S, I> && IndirectUnaryPredicate<C, projected<I, P>>)
+        {
+            return remove_if_fn::parallel_impl_(pol, begin, end - begin, pred, proj);
+        }
+
+        template<typename Rng, typename C, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, C pred, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        Permutable<iterator_t<Rng>> &&
+                            IndirectUnaryPredicate<C, projected<iterator_t<Rng>, P>>)
+        {
+            return (*this)(pol, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `remove_if_fn`
@@ -35,6 +35,7 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/primitives.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/subrange.hpp>
 
@@ -42,6 +43,12 @@ namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. The threads take chunks of the positions where a match
+    /// could start in turn, and compare each with the second sequence; they
+    /// stop as soon as a match is found before their next chunk. The result
+    /// is the first match, as with the sequential algorithm.
     struct search_fn
     {
     private:
@@ -193,6 +200,64 @@ namespace ranges
                 return search_fn::impl(
                     begin(rng1), end(rng1), begin(rng2), end(rng2), pred, proj1, proj2);
         }
+
+        template<typename I1, typename S1, typename I2, typename S2,
+                 typename C = equal_to, typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, I1 begin1, S1 end1, I2 begin2, S2 end2,
+                        C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(subrange<I1>)( //
+                requires RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+                    RandomAccessIterator<I2> && SizedSentinel<S2, I2> &&
+                        IndirectlyComparable<I1, I2, C, P1, P2>)
+        {
+            using D1 = iter_difference_t<I1>;
+            auto const n1 = static_cast<std::size_t>(end1 - begin1);
+            auto const n2 = static_cast<std::size_t>(end2 - begin2);
+            if(n2 == 0)
+                return {begin1, begin1};
+            if(n1 < n2)
+                return {begin1 + static_cast<D1>(n1), begin1 + static_cast<D1>(n1)};
+            // Tries the matches starting at [lo, hi).
+            auto const test = [&](std::size_t lo, std::size_t hi) {
+                for(I1 it = begin1 + static_cast<D1>(lo); lo != hi; ++lo, ++it)
+                {
+                    I1 i1 = it;
+                    I2 i2 = begin2;
+                    for(; i2 != end2; ++i1, ++i2)
+                        if(!invoke(pred, invoke(proj1, *i1), invoke(proj2, *i2)))
+                            break;
+                    if(i2 == end2)
+                        break;
+                }
+                return lo;
+            };
+            auto const i = detail::parallel_find_first(pol, n1 - n2 + 1, test);
+            if(i == n1 - n2 + 1)
+                return {begin1 + static_cast<D1>(n1), begin1 + static_cast<D1>(n1)};
+            return {begin1 + static_cast<D1>(i), begin1 + static_cast<D1>(i + n2)};
+        }
+
+        template<typename Rng1, typename Rng2, typename C = equal_to,
+                 typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, Rng1 && rng1, Rng2 && rng2, C pred = C{},
+                        P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(safe_subrange_t<Rng1>)( //
+                requires RandomAccessRange<Rng1> &&
+                    SizedSentinel<sentinel_t<Rng1>, iterator_t<Rng1>> &&
+                        RandomAccessRange<Rng2> &&
+                            SizedSentinel<sentinel_t<Rng2>, iterator_t<Rng2>> &&
+                                IndirectlyComparable<iterator_t<Rng1>, iterator_t<Rng2>,
+                                                     C, P1, P2>)
+        {
+            return (*this)(pol,
+                           begin(rng1),
+                           end(rng1),
+                           begin(rng2),
+                           end(rng2),
+                           std::move(pred),
+                           std::move(proj1),
+                           std::move(proj2));
+        }
     };
 
     /// \sa `search_fn`
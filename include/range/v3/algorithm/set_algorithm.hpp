@@ -21,12 +21,16 @@
 #ifndef RANGES_V3_ALGORITHM_SET_ALGORITHM_HPP
 #define RANGES_V3_ALGORITHM_SET_ALGORITHM_HPP
 
+#include <cstddef>
+#include <functional>
 #include <utility>
+#include <vector>
 
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/detail/merge_path.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
@@ -36,10 +40,64 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
 {
+    /// \cond
+    namespace detail
+    {
+        // Runs a set algorithm in parallel, for the overloads of set_union,
+        // set_intersection, set_difference and set_symmetric_difference that
+        // take a parallel_policy: splits the two inputs with the merge path,
+        // the binary search of the parallel merge, into pieces with no
+        // equivalent elements in common, then calls
+        // run(begin1, end1, begin2, end2, out) on every piece twice, first with
+        // an output that counts the elements written, and then, having added up
+        // the counts to find where the pieces' output starts, with the output.
+        // Since no equivalent elements straddle two pieces, the output is that
+        // of the sequential algorithm.
+        template<typename I1, typename I2, typename O, typename C, typename P1,
+                 typename P2, typename Run>
+        O parallel_set_algorithm(parallel_policy pol, I1 begin1, iter_difference_t<I1> n1,
+                                 I2 begin2, iter_difference_t<I2> n2, O out, C & pred,
+                                 P1 & proj1, P2 & proj2, Run run)
+        {
+            using D1 = iter_difference_t<I1>;
+            using D2 = iter_difference_t<I2>;
+            std::size_t const size1 = static_cast<std::size_t>(n1);
+            std::size_t const size2 = static_cast<std::size_t>(n2);
+            std::size_t const count =
+                parallel_block_count(pol, size1 + size2, compact_grain);
+            if(count <= 1)
+                return run(begin1, begin1 + n1, begin2, begin2 + n2, std::move(out));
+            auto const splits = merge_path_partition(
+                begin1, size1, begin2, size2, count, pred, proj1, proj2, true);
+            auto piece = [&](std::size_t b, auto o) {
+                auto const & lo = splits[b];
+                auto const & hi = splits[b + 1];
+                return run(begin1 + static_cast<D1>(lo.first),
+                           begin1 + static_cast<D1>(hi.first),
+                           begin2 + static_cast<D2>(lo.second),
+                           begin2 + static_cast<D2>(hi.second),
+                           std::move(o));
+            };
+            std::vector<std::size_t> offsets(count + 1, 0);
+            parallel_invoke_n(count, [&](std::size_t b) {
+                auto const o = piece(b, counting_output{});
+                offsets[b + 1] = static_cast<std::size_t>(o.count);
+            });
+            for(std::size_t b = 0; b < count; ++b)
+                offsets[b + 1] += offsets[b];
+            parallel_invoke_n(count, [&](std::size_t b) {
+                piece(b, out + static_cast<iter_difference_t<O>>(offsets[b]));
+            });
+            return out + static_cast<iter_difference_t<O>>(offsets[count]);
+        }
+    } // namespace detail
+    /// \endcond
+
     /// \addtogroup group-algorithms
     /// @{
     struct includes_fn
@@ -92,6 +150,9 @@ namespace ranges
     template<typename I1, typename I2, typename O>
     using set_union_result = detail::in1_in2_out_result<I1, I2, O>;
 
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators, and write what the sequential algorithm does; see
+    /// `detail::parallel_set_algorithm`.
     struct set_union_fn
     {
         template<typename I1, typename S1, typename I2, typename S2, typename O,
@@ -144,6 +205,58 @@ namespace ranges
                            std::move(proj1),
                            std::move(proj2));
         }
+
+        template<typename I1, typename S1, typename I2, typename S2, typename O,
+                 typename C = less, typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, I1 begin1, S1 end1, I2 begin2, S2 end2,
+                        O out, C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(set_union_result<I1, I2, O>)( //
+                requires RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+                    RandomAccessIterator<I2> && SizedSentinel<S2, I2> &&
+                        RandomAccessIterator<O> && Mergeable<I1, I2, O, C, P1, P2>)
+        {
+            auto const n1 = end1 - begin1;
+            auto const n2 = end2 - begin2;
+            out = detail::parallel_set_algorithm(
+                pol, begin1, n1, begin2, n2, std::move(out), pred, proj1, proj2,
+                [&](I1 b1, I1 e1, I2 b2, I2 e2, auto o) {
+                    auto r = set_union_fn{}(b1,
+                                            e1,
+                                            b2,
+                                            e2,
+                                            std::move(o),
+                                            std::ref(pred),
+                                            std::ref(proj1),
+                                            std::ref(proj2));
+                    return r.out;
+                });
+            return {begin1 + n1, begin2 + n2, out};
+        }
+
+        template<typename Rng1, typename Rng2, typename O, typename C = less,
+                 typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, Rng1 && rng1, Rng2 && rng2, O out,
+                        C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(
+                set_union_result<safe_iterator_t<Rng1>, safe_iterator_t<Rng2>, O>)( //
+                requires RandomAccessRange<Rng1> &&
+                    SizedSentinel<sentinel_t<Rng1>, iterator_t<Rng1>> &&
+                        RandomAccessRange<Rng2> &&
+                            SizedSentinel<sentinel_t<Rng2>, iterator_t<Rng2>> &&
+                                RandomAccessIterator<O> &&
+                                    Mergeable<iterator_t<Rng1>, iterator_t<Rng2>, O, C,
+                                              P1, P2>)
+        {
+            return (*this)(pol,
+                           begin(rng1),
+                           end(rng1),
+                           begin(rng2),
+                           end(rng2),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj1),
+                           std::move(proj2));
+        }
     };
 
     /// \sa `set_union_fn`
@@ -156,6 +269,9 @@ namespace ranges
         using ranges::set_union_result;
     } // namespace cpp20
 
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators, and write what the sequential algorithm does; see
+    /// `detail::parallel_set_algorithm`.
     struct set_intersection_fn
     {
         template<typename I1, typename S1, typename I2, typename S2, typename O,
@@ -199,6 +315,57 @@ namespace ranges
                            std::move(proj1),
                            std::move(proj2));
         }
+
+        template<typename I1, typename S1, typename I2, typename S2, typename O,
+                 typename C = less, typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, I1 begin1, S1 end1, I2 begin2, S2 end2,
+                        O out, C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(O)( //
+                requires RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+                    RandomAccessIterator<I2> && SizedSentinel<S2, I2> &&
+                        RandomAccessIterator<O> && Mergeable<I1, I2, O, C, P1, P2>)
+        {
+            auto const n1 = end1 - begin1;
+            auto const n2 = end2 - begin2;
+            out = detail::parallel_set_algorithm(
+                pol, begin1, n1, begin2, n2, std::move(out), pred, proj1, proj2,
+                [&](I1 b1, I1 e1, I2 b2, I2 e2, auto o) {
+                    auto r = set_intersection_fn{}(b1,
+                                                   e1,
+                                                   b2,
+                                                   e2,
+                                                   std::move(o),
+                                                   std::ref(pred),
+                                                   std::ref(proj1),
+                                                   std::ref(proj2));
+                    return r;
+                });
+            return out;
+        }
+
+        template<typename Rng1, typename Rng2, typename O, typename C = less,
+                 typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, Rng1 && rng1, Rng2 && rng2, O out,
+                        C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(O)( //
+                requires RandomAccessRange<Rng1> &&
+                    SizedSentinel<sentinel_t<Rng1>, iterator_t<Rng1>> &&
+                        RandomAccessRange<Rng2> &&
+                            SizedSentinel<sentinel_t<Rng2>, iterator_t<Rng2>> &&
+                                RandomAccessIterator<O> &&
+                                    Mergeable<iterator_t<Rng1>, iterator_t<Rng2>, O, C,
+                                              P1, P2>)
+        {
+            return (*this)(pol,
+                           begin(rng1),
+                           end(rng1),
+                           begin(rng2),
+                           end(rng2),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj1),
+                           std::move(proj2));
+        }
     };
 
     /// \sa `set_intersection_fn`
@@ -213,6 +380,9 @@ namespace ranges
     template<typename I, typename O>
     using set_difference_result = detail::in1_out_result<I, O>;
 
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators, and write what the sequential algorithm does; see
+    /// `detail::parallel_set_algorithm`.
     struct set_difference_fn
     {
         template<typename I1, typename S1, typename I2, typename S2, typename O,
@@ -263,6 +433,57 @@ namespace ranges
                            std::move(proj1),
                            std::move(proj2));
         }
+
+        template<typename I1, typename S1, typename I2, typename S2, typename O,
+                 typename C = less, typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, I1 begin1, S1 end1, I2 begin2, S2 end2,
+                        O out, C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(set_difference_result<I1, O>)( //
+                requires RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+                    RandomAccessIterator<I2> && SizedSentinel<S2, I2> &&
+                        RandomAccessIterator<O> && Mergeable<I1, I2, O, C, P1, P2>)
+        {
+            auto const n1 = end1 - begin1;
+            auto const n2 = end2 - begin2;
+            out = detail::parallel_set_algorithm(
+                pol, begin1, n1, begin2, n2, std::move(out), pred, proj1, proj2,
+                [&](I1 b1, I1 e1, I2 b2, I2 e2, auto o) {
+                    auto r = set_difference_fn{}(b1,
+                                                 e1,
+                                                 b2,
+                                                 e2,
+                                                 std::move(o),
+                                                 std::ref(pred),
+                                                 std::ref(proj1),
+                                                 std::ref(proj2));
+                    return r.out;
+                });
+            return {begin1 + n1, out};
+        }
+
+        template<typename Rng1, typename Rng2, typename O, typename C = less,
+                 typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, Rng1 && rng1, Rng2 && rng2, O out,
+                        C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(set_difference_result<safe_iterator_t<Rng1>, O>)( //
+                requires RandomAccessRange<Rng1> &&
+                    SizedSentinel<sentinel_t<Rng1>, iterator_t<Rng1>> &&
+                        RandomAccessRange<Rng2> &&
+                            SizedSentinel<sentinel_t<Rng2>, iterator_t<Rng2>> &&
+                                RandomAccessIterator<O> &&
+                                    Mergeable<iterator_t<Rng1>, iterator_t<Rng2>, O, C,
+                                              P1, P2>)
+        {
+            return (*this)(pol,
+                           begin(rng1),
+                           end(rng1),
+                           begin(rng2),
+                           end(rng2),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj1),
+                           std::move(proj2));
+        }
     };
 
     /// \sa `set_difference_fn`
@@ -278,6 +499,9 @@ namespace ranges
     template<typename I1, typename I2, typename O>
     using set_symmetric_difference_result = detail::in1_in2_out_result<I1, I2, O>;
 
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators, and write what the sequential algorithm does; see
+    /// `detail::parallel_set_algorithm`.
     struct set_symmetric_difference_fn
     {
         template<typename I1, typename S1, typename I2, typename S2, typename O,
@@ -336,6 +560,59 @@ namespace ranges
                            std::move(proj1),
                            std::move(proj2));
         }
+
+        template<typename I1, typename S1, typename I2, typename S2, typename O,
+                 typename C = less, typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, I1 begin1, S1 end1, I2 begin2, S2 end2,
+                        O out, C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(set_symmetric_difference_result<I1, I2, O>)( //
+                requires RandomAccessIterator<I1> && SizedSentinel<S1, I1> &&
+                    RandomAccessIterator<I2> && SizedSentinel<S2, I2> &&
+                        RandomAccessIterator<O> && Mergeable<I1, I2, O, C, P1, P2>)
+        {
+            auto const n1 = end1 - begin1;
+            auto const n2 = end2 - begin2;
+            out = detail::parallel_set_algorithm(
+                pol, begin1, n1, begin2, n2, std::move(out), pred, proj1, proj2,
+                [&](I1 b1, I1 e1, I2 b2, I2 e2, auto o) {
+                    auto r = set_symmetric_difference_fn{}(b1,
+                                                           e1,
+                                                           b2,
+                                                           e2,
+                                                           std::move(o),
+                                                           std::ref(pred),
+                                                           std::ref(proj1),
+                                                           std::ref(proj2));
+                    return r.out;
+                });
+            return {begin1 + n1, begin2 + n2, out};
+        }
+
+        template<typename Rng1, typename Rng2, typename O, typename C = less,
+                 typename P1 = identity, typename P2 = identity>
+        auto operator()(parallel_policy pol, Rng1 && rng1, Rng2 && rng2, O out,
+                        C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            -> CPP_ret(set_symmetric_difference_result<safe_iterator_t<Rng1>,
+                                                       safe_iterator_t<Rng2>,
+                                                       O>)( //
+                requires RandomAccessRange<Rng1> &&
+                    SizedSentinel<sentinel_t<Rng1>, iterator_t<Rng1>> &&
+                        RandomAccessRange<Rng2> &&
+                            SizedSentinel<sentinel_t<Rng2>, iterator_t<Rng2>> &&
+                                RandomAccessIterator<O> &&
+                                    Mergeable<iterator_t<Rng1>, iterator_t<Rng2>, O, C,
+                                              P1, P2>)
+        {
+            return (*this)(pol,
+                           begin(rng1),
+                           end(rng1),
+                           begin(rng2),
+                           end(rng2),
+                           std::move(out),
+                           std::move(pred),
+                           std::move(proj1),
+                           std::move(proj2));
+        }
     };
 
     /// \sa `set_symmetric_difference_fn`
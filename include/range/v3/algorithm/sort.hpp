@@ -38,6 +38,7 @@
 
 #include <range/v3/range_fwd.hpp>
 
+#include <range/v3/algorithm/aux_/cached_key.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
 #include <range/v3/algorithm/move_backward.hpp>
 #include <range/v3/algorithm/partial_sort.hpp>
@@ -211,6 +212,29 @@ namespace ranges
         {
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
+
+        /// \overload
+        /// Evaluates \c proj once per element. \sa `cache_keys_t`
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(cache_keys_t, I begin, S end_, C pred = C{}, P proj = P{}) const
+            -> CPP_ret(I)( //
+                requires CachedKeySortable<I, C, P> && Sentinel<S, I>)
+        {
+            I end = ranges::next(begin, std::move(end_));
+            auto keys = detail::make_cached_keys(begin, end - begin, proj);
+            (*this)(keys, detail::cached_key_less<C>{&pred});
+            detail::permute_by_cached_keys(begin, keys);
+            return end;
+        }
+
+        /// \overload
+        template<typename Rng, typename C = less, typename P = identity>
+        auto operator()(cache_keys_t ck, Rng && rng, C pred = C{}, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires CachedKeySortable<iterator_t<Rng>, C, P> && RandomAccessRange<Rng>)
+        {
+            return (*this)(ck, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `sort_fn`
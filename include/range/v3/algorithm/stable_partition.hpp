@@ -21,9 +21,12 @@
 #ifndef RANGES_V3_ALGORITHM_STABLE_PARTITION_HPP
 #define RANGES_V3_ALGORITHM_STABLE_PARTITION_HPP
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <meta/meta.hpp>
 
@@ -43,6 +46,8 @@
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/scratch_buffer.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/swap.hpp>
 
@@ -50,9 +55,58 @@ namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. They partition blocks of the sequence stably on several
+    /// threads at once, and then join neighbouring blocks in rounds, each
+    /// pair by rotating the falses of the first past the trues of the second,
+    /// with the pairs of a round in parallel. The last round is one rotation
+    /// on one thread.
     struct stable_partition_fn
     {
     private:
+        template<typename I, typename C, typename P>
+        static I parallel_impl_(parallel_policy pol, I begin, iter_difference_t<I> n,
+                                C & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            // A partitioned stretch: trues in [first, mid), falses in [mid, last).
+            struct part
+            {
+                I first, mid, last;
+            };
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size, detail::compact_grain);
+            if(count <= 1)
+                return stable_partition_fn{}(begin, begin + n, std::ref(pred),
+                                             std::ref(proj));
+            std::vector<part> parts(count);
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                I const first = begin + static_cast<D>(bnd.first);
+                I const last = begin + static_cast<D>(bnd.second);
+                parts[b] = {
+                    first,
+                    stable_partition_fn{}(first, last, std::ref(pred), std::ref(proj)),
+                    last};
+            });
+            while(parts.size() > 1)
+            {
+                std::vector<part> joined((parts.size() + 1) / 2);
+                detail::parallel_invoke_n(parts.size() / 2, [&](std::size_t i) {
+                    part const & x = parts[2 * i];
+                    part const & y = parts[2 * i + 1];
+                    joined[i] = {x.first, ranges::rotate(x.mid, x.last, y.mid).begin(),
+                                 y.last};
+                });
+                if(parts.size() % 2)
+                    joined.back() = parts.back();
+                parts = std::move(joined);
+            }
+            return parts[0].mid;
+        }
+
         template<typename I, typename C, typename P, typename D, typename Pair>
         static I impl(I begin, I end, C pred, P proj, D len, Pair const p,
                       detail::forward_iterator_tag_ fi)
@@ -125,7 +179,8 @@ namespace ranges
         }
 
         template<typename I, typename S, typename C, typename P>
-        static I impl(I begin, S end, C pred, P proj, detail::forward_iterator_tag_ fi)
+        static I impl(I begin, S end, C pred, P proj, scratch_buffer * scratch,
+                      detail::forward_iterator_tag_ fi)
         {
             using difference_type = iter_difference_t<I>;
             difference_type const alloc_limit = 3; // might want to make this a function
@@ -143,10 +198,12 @@ namespace ranges
             // *begin is known to be false
             using value_type = iter_value_t<I>;
             auto len_end = enumerate(begin, end);
-            auto p = len_end.first >= alloc_limit
-                         ? detail::get_temporary_buffer<value_type>(len_end.first)
+            auto const len = len_end.first;
+            auto p = len >= alloc_limit
+                         ? detail::get_temporary_buffer<value_type>(scratch, len)
                          : detail::value_init{};
-            std::unique_ptr<value_type, detail::return_temporary_buffer> const h{p.first};
+            std::unique_ptr<value_type, detail::return_temporary_buffer> const h{
+                scratch ? nullptr : p.first};
             return stable_partition_fn::impl(
                 begin, len_end.second, pred, proj, len_end.first, p, fi);
         }
@@ -246,7 +303,7 @@ namespace ranges
         }
 
         template<typename I, typename S, typename C, typename P>
-        static I impl(I begin, S end_, C pred, P proj,
+        static I impl(I begin, S end_, C pred, P proj, scratch_buffer * scratch,
                       detail::bidirectional_iterator_tag_ bi)
         {
             using difference_type = iter_difference_t<I>;
@@ -276,9 +333,11 @@ namespace ranges
             // *end is known to be true
             // len >= 2
             auto len = distance(begin, end) + 1;
-            auto p = len >= alloc_limit ? detail::get_temporary_buffer<value_type>(len)
-                                        : detail::value_init{};
-            std::unique_ptr<value_type, detail::return_temporary_buffer> const h{p.first};
+            auto p = len >= alloc_limit
+                         ? detail::get_temporary_buffer<value_type>(scratch, len)
+                         : detail::value_init{};
+            std::unique_ptr<value_type, detail::return_temporary_buffer> const h{
+                scratch ? nullptr : p.first};
             return stable_partition_fn::impl(begin, end, pred, proj, len, p, bi);
         }
 
@@ -292,6 +351,7 @@ namespace ranges
                                              std::move(end),
                                              std::ref(pred),
                                              std::ref(proj),
+                                             nullptr,
                                              iterator_tag_of<I>());
         }
 
@@ -304,6 +364,56 @@ namespace ranges
         {
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
+
+        /// \overload
+        /// Takes its temporary buffer from \c scratch, which it grows if need
+        /// be, rather than allocating one.
+        /// \sa `scratch_buffer`
+        template<typename I, typename S, typename C, typename P = identity>
+        auto operator()(scratch_buffer & scratch, I begin, S end, C pred,
+                        P proj = P{}) const -> CPP_ret(I)( //
+            requires BidirectionalIterator<I> && Sentinel<S, I> &&
+                IndirectUnaryPredicate<C, projected<I, P>> && Permutable<I>)
+        {
+            return stable_partition_fn::impl(std::move(begin),
+                                             std::move(end),
+                                             std::ref(pred),
+                                             std::ref(proj),
+                                             &scratch,
+                                             iterator_tag_of<I>());
+        }
+
+        /// \overload
+        template<typename Rng, typename C, typename P = identity>
+        auto operator()(scratch_buffer & scratch, Rng && rng, C pred,
+                        P proj = P{}) const -> CPP_ret(safe_iterator_t<Rng>)( //
+            requires BidirectionalRange<Rng> && IndirectUnaryPredicate<
+                C, projected<iterator_t<Rng>, P>> && Permutable<iterator_t<Rng>>)
+        {
+            return (*this)(
+                scratch, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
+
+        template<typename I, typename S, typename C, typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, C pred, P proj = P{}) const
+            -> CPP_ret(I)( //
+                requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                    IndirectUnaryPredicate<C, projected<I, P>> && Permutable<I>)
+        {
+            return stable_partition_fn::parallel_impl_(pol, begin, end - begin, pred,
+                                                       proj);
+        }
+
+        template<typename Rng, typename C, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, C pred, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                        IndirectUnaryPredicate<C, projected<iterator_t<Rng>, P>> &&
+                            Permutable<iterator_t<Rng>>)
+        {
+            return (*this)(pol, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `stable_partition_fn`
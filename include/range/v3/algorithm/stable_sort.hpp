@@ -42,6 +42,7 @@
 
 #include <range/v3/range_fwd.hpp>
 
+#include <range/v3/algorithm/aux_/cached_key.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
 #include <range/v3/algorithm/merge.hpp>
 #include <range/v3/algorithm/min.hpp>
@@ -57,6 +58,7 @@
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/memory.hpp>
+#include <range/v3/utility/scratch_buffer.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -185,19 +187,17 @@ namespace ranges
                                    std::ref(proj));
         }
 
-    public:
-        template<typename I, typename S, typename C = less, typename P = identity>
-        auto operator()(I begin, S end_, C pred = C{}, P proj = P{}) const
-            -> CPP_ret(I)( //
-                requires Sortable<I, C, P> && RandomAccessIterator<I> && Sentinel<S, I>)
+        template<typename I, typename C, typename P>
+        static I impl_(I begin, I end, C & pred, P & proj, scratch_buffer * scratch)
         {
-            I end = ranges::next(begin, end_);
             using D = iter_difference_t<I>;
             using V = iter_value_t<I>;
             D len = end - begin;
-            auto buf =
-                len > 256 ? detail::get_temporary_buffer<V>(len) : detail::value_init{};
-            std::unique_ptr<V, detail::return_temporary_buffer> h{buf.first};
+            auto buf = len > 256 || (scratch && len > 1)
+                           ? detail::get_temporary_buffer<V>(scratch, len)
+                           : detail::value_init{};
+            std::unique_ptr<V, detail::return_temporary_buffer> h{
+                scratch ? nullptr : buf.first};
             if(buf.first == nullptr)
                 stable_sort_fn::inplace_stable_sort(begin, end, pred, proj);
             else
@@ -206,6 +206,16 @@ namespace ranges
             return end;
         }
 
+    public:
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(I begin, S end_, C pred = C{}, P proj = P{}) const
+            -> CPP_ret(I)( //
+                requires Sortable<I, C, P> && RandomAccessIterator<I> && Sentinel<S, I>)
+        {
+            I end = ranges::next(begin, end_);
+            return stable_sort_fn::impl_(begin, end, pred, proj, nullptr);
+        }
+
         template<typename Rng, typename C = less, typename P = identity>
         auto operator()(Rng && rng, C pred = C{}, P proj = P{}) const
             -> CPP_ret(safe_iterator_t<Rng>)( //
@@ -213,6 +223,54 @@ namespace ranges
         {
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
+
+        /// \overload
+        /// Takes its temporary buffer from \c scratch, which it grows if need
+        /// be, rather than allocating one.
+        /// \sa `scratch_buffer`
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(scratch_buffer & scratch, I begin, S end_, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(I)( //
+            requires Sortable<I, C, P> && RandomAccessIterator<I> && Sentinel<S, I>)
+        {
+            I end = ranges::next(begin, end_);
+            return stable_sort_fn::impl_(begin, end, pred, proj, &scratch);
+        }
+
+        /// \overload
+        template<typename Rng, typename C = less, typename P = identity>
+        auto operator()(scratch_buffer & scratch, Rng && rng, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(safe_iterator_t<Rng>)( //
+            requires Sortable<iterator_t<Rng>, C, P> && RandomAccessRange<Rng>)
+        {
+            return (*this)(
+                scratch, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
+
+        /// \overload
+        /// Evaluates \c proj once per element. The keys are ordered by key and
+        /// then by position, so no stable sort of the keys is needed.
+        /// \sa `cache_keys_t`
+        template<typename I, typename S, typename C = less, typename P = identity>
+        auto operator()(cache_keys_t, I begin, S end_, C pred = C{}, P proj = P{}) const
+            -> CPP_ret(I)( //
+                requires CachedKeySortable<I, C, P> && Sentinel<S, I>)
+        {
+            I end = ranges::next(begin, std::move(end_));
+            auto keys = detail::make_cached_keys(begin, end - begin, proj);
+            ranges::sort(keys, detail::cached_key_stable_less<C>{&pred});
+            detail::permute_by_cached_keys(begin, keys);
+            return end;
+        }
+
+        /// \overload
+        template<typename Rng, typename C = less, typename P = identity>
+        auto operator()(cache_keys_t ck, Rng && rng, C pred = C{}, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires CachedKeySortable<iterator_t<Rng>, C, P> && RandomAccessRange<Rng>)
+        {
+            return (*this)(ck, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `stable_sort_fn`
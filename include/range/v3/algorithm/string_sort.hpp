@@ -0,0 +1,335 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+// Multikey quicksort is from "Fast Algorithms for Sorting and Searching
+// Strings" by Jon L. Bentley and Robert Sedgewick, SODA 1997.
+//
+#ifndef RANGES_V3_ALGORITHM_STRING_SORT_HPP
+#define RANGES_V3_ALGORITHM_STRING_SORT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/aux_/cached_key.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/delimit.hpp>
+#include <range/v3/view/subrange.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Where the bytes of one string are; they are not copied.
+        struct string_key
+        {
+            unsigned char const * data;
+            std::size_t size;
+        };
+
+        template<typename C>
+        using is_byte_char =
+            meta::bool_<std::is_integral<C>::value && sizeof(C) == 1 &&
+                        !std::is_same<meta::_t<std::remove_cv<C>>, bool>::value>;
+
+        struct string_key_fn
+        {
+            template<typename R>
+            auto operator()(R && r) const -> CPP_ret(string_key)( //
+                requires ContiguousRange<R> && is_byte_char<range_value_t<R>>::value)
+            {
+                auto const n = static_cast<std::size_t>(ranges::end(r) - ranges::begin(r));
+                return {reinterpret_cast<unsigned char const *>(ranges::data(r)), n};
+            }
+            // What view::c_str returns for a pointer: the string's length is
+            // only found by walking it.
+            template<typename Char, typename S>
+            auto operator()(delimit_view<subrange<Char *, S>, meta::_t<std::remove_cv<Char>>>
+                                r) const -> CPP_ret(string_key)( //
+                requires is_byte_char<Char>::value)
+            {
+                auto const first = ranges::begin(r.base());
+                auto const n = static_cast<std::size_t>(ranges::distance(r));
+                return {reinterpret_cast<unsigned char const *>(first), n};
+            }
+        };
+
+        using string_record = cached_key<string_key>;
+
+        // The character at depth d, or 0 past the end so that a string sorts
+        // before its extensions.
+        inline int string_char_at(string_record const & r, std::size_t d) noexcept
+        {
+            return d < r.key.size ? r.key.data[d] + 1 : 0;
+        }
+
+        // Compares two strings known to agree on their first d characters.
+        inline bool string_less_from(string_record const & a, string_record const & b,
+                                     std::size_t d) noexcept
+        {
+            std::size_t const n = a.key.size < b.key.size ? a.key.size : b.key.size;
+            if(d < n)
+                if(int const c = std::memcmp(a.key.data + d, b.key.data + d, n - d))
+                    return c < 0;
+            return a.key.size < b.key.size;
+        }
+
+        constexpr std::size_t string_sort_insertion_threshold = 16;
+        constexpr std::size_t string_sort_radix_threshold = std::size_t{1} << 10;
+
+        inline void string_insertion_sort(string_record * a, std::size_t n,
+                                          std::size_t d) noexcept
+        {
+            for(std::size_t i = 1; i < n; ++i)
+            {
+                string_record const tmp = a[i];
+                std::size_t j = i;
+                for(; j > 0 && detail::string_less_from(tmp, a[j - 1], d); --j)
+                    a[j] = a[j - 1];
+                a[j] = tmp;
+            }
+        }
+
+        // Room for the radix passes, which are only made on subranges of at
+        // least string_sort_radix_threshold elements.
+        struct string_sort_scratch
+        {
+            std::vector<string_record> records_;
+            std::vector<std::uint16_t> chars_;
+            string_record * records;
+            std::uint16_t * chars;
+
+            explicit string_sort_scratch(std::size_t n)
+              : records_(n >= string_sort_radix_threshold ? n : 0)
+              , chars_(records_.size())
+              , records(records_.data())
+              , chars(chars_.data())
+            {}
+        };
+
+        inline void multikey_quicksort(string_record * a, std::size_t n, std::size_t d,
+                                       string_sort_scratch & scratch);
+
+        // One pass of MSD radix sort on the first character at or after depth
+        // d that tells the strings apart: distribute into the scratch records,
+        // copy back, and sort each bucket on the next character. The largest
+        // bucket is not sorted but returned in a, n and d for the caller to
+        // loop on, so that the stack stays logarithmic however long the
+        // shared prefixes are; the others have at most n / 2 strings each.
+        // Returns false if there is nothing left to sort.
+        inline bool string_radix_pass(string_record *& a, std::size_t & n,
+                                      std::size_t & d, string_sort_scratch & scratch)
+        {
+            // Skip the prefix shared by all the strings in one pass, rather
+            // than one distribution pass per shared character.
+            std::size_t lcp = a[0].key.size;
+            for(std::size_t i = 1; i < n && lcp > d; ++i)
+            {
+                std::size_t const m = a[i].key.size < lcp ? a[i].key.size : lcp;
+                std::size_t k = d;
+                while(k < m && a[i].key.data[k] == a[0].key.data[k])
+                    ++k;
+                lcp = k;
+            }
+            d = lcp;
+            // Read each string once; the distribution below uses the cached
+            // characters.
+            std::size_t count[257] = {};
+            for(std::size_t i = 0; i < n; ++i)
+                ++count[scratch.chars[i] =
+                            static_cast<std::uint16_t>(detail::string_char_at(a[i], d))];
+            if(count[0] == n)
+                return false;
+            std::size_t start[257];
+            std::size_t sum = 0;
+            for(int c = 0; c < 257; ++c)
+            {
+                start[c] = sum;
+                sum += count[c];
+            }
+            for(std::size_t i = 0; i < n; ++i)
+                scratch.records[start[scratch.chars[i]]++] = a[i];
+            std::memcpy(static_cast<void *>(a), scratch.records, n * sizeof(string_record));
+            // Bucket 0 holds the strings that end here, which are all equal.
+            int largest = 1;
+            for(int c = 2; c < 257; ++c)
+                if(count[c] > count[largest])
+                    largest = c;
+            std::size_t lo = count[0], largest_lo = 0;
+            for(int c = 1; c < 257; ++c)
+            {
+                if(c == largest)
+                    largest_lo = lo;
+                else if(count[c] > 1)
+                    detail::multikey_quicksort(a + lo, count[c], d + 1, scratch);
+                lo += count[c];
+            }
+            a += largest_lo;
+            n = count[largest];
+            d = d + 1;
+            return true;
+        }
+
+        inline void multikey_quicksort(string_record * a, std::size_t n, std::size_t d,
+                                       string_sort_scratch & scratch)
+        {
+            while(n > string_sort_insertion_threshold)
+            {
+                if(n >= string_sort_radix_threshold)
+                {
+                    if(!detail::string_radix_pass(a, n, d, scratch))
+                        return;
+                    continue;
+                }
+
+                // Median of three characters.
+                int const x = detail::string_char_at(a[0], d);
+                int const y = detail::string_char_at(a[n / 2], d);
+                int const z = detail::string_char_at(a[n - 1], d);
+                int const pivot =
+                    x < y ? (y < z ? y : (x < z ? z : x)) : (x < z ? x : (y < z ? z : y));
+
+                // Three-way partition: [0, lt) < pivot, [lt, gt) == pivot,
+                // [gt, n) > pivot.
+                std::size_t lt = 0, i = 0, gt = n;
+                while(i < gt)
+                {
+                    int const c = detail::string_char_at(a[i], d);
+                    if(c < pivot)
+                        std::swap(a[lt++], a[i++]);
+                    else if(c > pivot)
+                        std::swap(a[i], a[--gt]);
+                    else
+                        ++i;
+                }
+
+                std::size_t const eq = gt - lt;
+                if(eq == n)
+                {
+                    // Every string has the same character here; look further.
+                    if(pivot == 0)
+                        return;
+                    ++d;
+                    continue;
+                }
+                // Recurse on the two smaller parts and loop on the largest,
+                // so the stack stays logarithmic.
+                std::size_t const gtn = n - gt;
+                if(lt >= eq && lt >= gtn)
+                {
+                    if(pivot != 0)
+                        detail::multikey_quicksort(a + lt, eq, d + 1, scratch);
+                    detail::multikey_quicksort(a + gt, gtn, d, scratch);
+                    n = lt;
+                }
+                else if(gtn >= eq)
+                {
+                    detail::multikey_quicksort(a, lt, d, scratch);
+                    if(pivot != 0)
+                        detail::multikey_quicksort(a + lt, eq, d + 1, scratch);
+                    a += gt;
+                    n = gtn;
+                }
+                else
+                {
+                    detail::multikey_quicksort(a, lt, d, scratch);
+                    detail::multikey_quicksort(a + gt, gtn, d, scratch);
+                    if(pivot == 0)
+                        return;
+                    a += lt;
+                    n = eq;
+                    ++d;
+                }
+            }
+            detail::string_insertion_sort(a, n, d);
+        }
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-algorithms
+    /// @{
+
+    // clang-format off
+    CPP_def
+    (
+        template(typename I, typename P)
+        concept StringSortable,
+            RandomAccessIterator<I> && Permutable<I> &&
+            Invocable<detail::string_key_fn, indirect_result_t<P &, I>> &&
+            // The keys point into the projected strings, so these must
+            // outlive the call to the projection.
+            (std::is_lvalue_reference<indirect_result_t<P &, I>>::value ||
+             View<uncvref_t<indirect_result_t<P &, I>>>)
+    );
+    // clang-format on
+
+    /// Sorts a range lexicographically by projected strings of single-byte
+    /// characters (\c std::string, \c string_view, or the result of
+    /// `view::c_str`), comparing characters as <tt>unsigned char</tt> like
+    /// \c std::char_traits<char> does. Large subranges are split by MSD
+    /// radix passes and smaller ones by multikey quicksort, so characters
+    /// already known to be shared by a group of strings are never compared
+    /// again. The projection is evaluated once per element. The sort is not
+    /// stable.
+    struct string_sort_fn
+    {
+        template<typename I, typename S, typename P = identity>
+        auto operator()(I first, S last, P proj = P{}) const -> CPP_ret(I)( //
+            requires StringSortable<I, P> && Sentinel<S, I>)
+        {
+            using D = iter_difference_t<I>;
+            I const end = ranges::next(first, std::move(last));
+            std::size_t const n = static_cast<std::size_t>(end - first);
+            std::vector<detail::string_record> keys;
+            keys.reserve(n);
+            detail::string_key_fn key;
+            for(std::size_t i = 0; i != n; ++i)
+                keys.push_back({key(invoke(proj, *(first + static_cast<D>(i)))), i});
+            detail::string_sort_scratch scratch(n);
+            detail::multikey_quicksort(keys.data(), n, 0, scratch);
+            detail::permute_by_cached_keys(first, keys);
+            return end;
+        }
+
+        template<typename Rng, typename P = identity>
+        auto operator()(Rng && rng, P proj = P{}) const
+            -> CPP_ret(safe_iterator_t<Rng>)( //
+                requires RandomAccessRange<Rng> && StringSortable<iterator_t<Rng>, P>)
+        {
+            return (*this)(begin(rng), end(rng), std::move(proj));
+        }
+    };
+
+    /// \sa `string_sort_fn`
+    /// \ingroup group-algorithms
+    RANGES_INLINE_VARIABLE(string_sort_fn, string_sort)
+    /// @}
+} // namespace ranges
+
+#endif // include guard
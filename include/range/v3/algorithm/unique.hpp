@@ -17,9 +17,14 @@
 #ifndef RANGES_V3_ALGORITHM_UNIQUE_HPP
 #define RANGES_V3_ALGORITHM_UNIQUE_HPP
 
+#include <cstddef>
+#include <functional>
+#include <vector>
+
 #include <range/v3/range_fwd.hpp>
 
 #include <range/v3/algorithm/adjacent_find.hpp>
+#include <range/v3/algorithm/move.hpp>
 #include <range/v3/functional/comparisons.hpp>
 #include <range/v3/functional/identity.hpp>
 #include <range/v3/functional/invoke.hpp>
@@ -28,14 +33,63 @@
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
 {
     /// \addtogroup group-algorithms
     /// @{
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. They compare the first element of each block of the
+    /// sequence with the last of the block before it, remove the duplicates
+    /// within the blocks on several threads at once, and then move the
+    /// elements each block kept down to follow those of the blocks before
+    /// it, in one pass on the calling thread. Since \c pred is an
+    /// equivalence, the result is the same as with the sequential algorithm.
     struct unique_fn
     {
+    private:
+        template<typename I, typename C, typename P>
+        static I parallel_impl_(parallel_policy pol, I begin, iter_difference_t<I> n,
+                                C & pred, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size, detail::compact_grain);
+            if(count <= 1)
+                return unique_fn{}(begin, begin + n, std::ref(pred), std::ref(proj));
+            // Where the elements each block keeps begin and end. A block whose
+            // first element repeats the last of the block before drops it; this
+            // is decided before any block is modified.
+            std::vector<I> firsts(count), ends(count);
+            for(std::size_t b = 0; b < count; ++b)
+            {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                firsts[b] = begin + static_cast<D>(bnd.first);
+                if(b != 0 &&
+                   invoke(pred, invoke(proj, *(firsts[b] - 1)), invoke(proj, *firsts[b])))
+                    ++firsts[b];
+            }
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                ends[b] = unique_fn{}(begin + static_cast<D>(bnd.first),
+                                      begin + static_cast<D>(bnd.second),
+                                      std::ref(pred),
+                                      std::ref(proj));
+            });
+            I out = ends[0];
+            for(std::size_t b = 1; b < count; ++b)
+            {
+                if(firsts[b] < ends[b])
+                    out = firsts[b] == out ? ends[b]
+                                           : ranges::move(firsts[b], ends[b], out).out;
+            }
+            return out;
+        }
+
+    public:
         /// \brief template function \c unique_fn::operator()
         ///
         /// range-based version of the \c unique std algorithm
@@ -69,6 +123,24 @@ namespace ranges
         {
             return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
         }
+
+        template<typename I, typename S, typename C = equal_to, typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(I)( //
+            requires Sortable<I, C, P> && RandomAccessIterator<I> &&
+                SizedSentinel<S, I>)
+        {
+            return unique_fn::parallel_impl_(pol, begin, end - begin, pred, proj);
+        }
+
+        template<typename Rng, typename C = equal_to, typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, C pred = C{},
+                        P proj = P{}) const -> CPP_ret(safe_iterator_t<Rng>)( //
+            requires Sortable<iterator_t<Rng>, C, P> && RandomAccessRange<Rng> &&
+                SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>>)
+        {
+            return (*this)(pol, begin(rng), end(rng), std::move(pred), std::move(proj));
+        }
     };
 
     /// \sa `unique_fn`
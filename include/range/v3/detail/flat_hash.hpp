@@ -0,0 +1,129 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_FLAT_HASH_HPP
+#define RANGES_V3_DETAIL_FLAT_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // A set of keys that numbers them in the order they are first
+        // inserted, so that whatever goes with a key can be kept in a vector
+        // beside it. The keys and their hashes are kept in insertion order in
+        // two vectors, and the table is open addressing with linear probing
+        // over a power-of-two array of indices into them, at most half full.
+        // A key's first slot is taken from the high bits of its hash times
+        // 2^64 / phi, since std::hash is the identity for integers in the
+        // common standard libraries and their low bits alone cluster badly.
+        template<typename K, typename H = std::hash<K>>
+        struct flat_hash_index
+        {
+        private:
+            std::vector<K> keys_;
+            std::vector<std::size_t> hashes_;
+            // One more than the index of the key in each slot, or 0.
+            std::vector<std::size_t> slots_;
+            unsigned shift_ = 64;
+            RANGES_NO_UNIQUE_ADDRESS H hash_;
+
+            std::size_t home_(std::size_t h) const noexcept
+            {
+                return static_cast<std::size_t>(
+                    (static_cast<std::uint64_t>(h) * 0x9E3779B97F4A7C15ull) >> shift_);
+            }
+            // Doubles the table and reserves room for the keys it can take,
+            // so that an insert cannot fail after the key is stored.
+            void grow_()
+            {
+                std::size_t const size = slots_.empty() ? 16 : slots_.size() * 2;
+                keys_.reserve(size / 2);
+                hashes_.reserve(size / 2);
+                slots_.assign(size, 0);
+                shift_ = 64;
+                for(std::size_t s = size; s > 1; s /= 2)
+                    --shift_;
+                std::size_t const mask = size - 1;
+                for(std::size_t i = 0; i < keys_.size(); ++i)
+                {
+                    std::size_t s = home_(hashes_[i]);
+                    while(slots_[s] != 0)
+                        s = (s + 1) & mask;
+                    slots_[s] = i + 1;
+                }
+            }
+
+        public:
+            std::size_t size() const noexcept
+            {
+                return keys_.size();
+            }
+            // The keys, in the order they were first inserted.
+            std::vector<K> & keys() noexcept
+            {
+                return keys_;
+            }
+            std::size_t hash(std::size_t i) const noexcept
+            {
+                return hashes_[i];
+            }
+            // Removes the keys but keeps the memory.
+            void clear() noexcept
+            {
+                keys_.clear();
+                hashes_.clear();
+                for(auto & s : slots_)
+                    s = 0;
+            }
+            // The index of key, which is stored first if it is new, and
+            // whether it was.
+            template<typename KK>
+            std::pair<std::size_t, bool> insert(KK && key, std::size_t h)
+            {
+                if(2 * (keys_.size() + 1) > slots_.size())
+                    grow_();
+                std::size_t const mask = slots_.size() - 1;
+                for(std::size_t s = home_(h);; s = (s + 1) & mask)
+                {
+                    std::size_t const i = slots_[s];
+                    if(i == 0)
+                    {
+                        keys_.emplace_back(static_cast<KK &&>(key));
+                        hashes_.push_back(h);
+                        slots_[s] = keys_.size();
+                        return {keys_.size() - 1, true};
+                    }
+                    if(hashes_[i - 1] == h && keys_[i - 1] == key)
+                        return {i - 1, false};
+                }
+            }
+            template<typename KK>
+            std::pair<std::size_t, bool> insert(KK && key)
+            {
+                std::size_t const h = hash_(key);
+                return insert(static_cast<KK &&>(key), h);
+            }
+        };
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#endif
@@ -0,0 +1,156 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_MERGE_PATH_HPP
+#define RANGES_V3_DETAIL_MERGE_PATH_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // The merge of two sorted sequences a and b, which takes from a on
+        // ties, is a path through the grid of (i, j) pairs from (0, 0) to
+        // (n0, n1); its first d steps take some i elements from a and d - i
+        // from b. Finding i, the co-rank of d, takes a binary search along the
+        // diagonal i + j == d, and splits the merge into two that can be done
+        // independently. See "Merge Path - Parallel Merging Made Simple",
+        // Odeh, Green, Mwassi, Shmueli and Birk, 2012.
+        template<typename I0, typename I1, typename C, typename P0, typename P1>
+        std::size_t merge_path_corank(I0 a, std::size_t n0, I1 b, std::size_t n1,
+                                      std::size_t d, C & pred, P0 & proj0, P1 & proj1)
+        {
+            RANGES_EXPECT(d <= n0 + n1);
+            std::size_t lo = d > n1 ? d - n1 : 0;
+            std::size_t hi = d < n0 ? d : n0;
+            while(lo < hi)
+            {
+                std::size_t const i = lo + (hi - lo) / 2;
+                auto const j = static_cast<iter_difference_t<I1>>(d - i - 1);
+                if(invoke(pred,
+                          invoke(proj1, b[j]),
+                          invoke(proj0, a[static_cast<iter_difference_t<I0>>(i)])))
+                    hi = i;
+                else
+                    lo = i + 1;
+            }
+            return lo;
+        }
+
+        // The number of elements of [b, b + n) that are less than the
+        // projection of *key.
+        template<typename I, typename K, typename C, typename P, typename PK>
+        std::size_t merge_path_lower_(I b, std::size_t n, K key, C & pred, P & proj,
+                                      PK & key_proj)
+        {
+            std::size_t lo = 0;
+            while(n != 0)
+            {
+                std::size_t const half = n / 2;
+                auto const m = static_cast<iter_difference_t<I>>(lo + half);
+                if(invoke(pred, invoke(proj, b[m]), invoke(key_proj, *key)))
+                {
+                    lo += half + 1;
+                    n -= half + 1;
+                }
+                else
+                    n = half;
+            }
+            return lo;
+        }
+
+        // The points that split the merge of [a, a + n0) and [b, b + n1) into
+        // count pieces, as pairs of positions in a and b; the first is (0, 0)
+        // and the last (n0, n1). The pieces are as nearly equal as can be,
+        // unless whole_runs is set, in which case each split is moved back to
+        // the start of the elements equivalent to the one after it, so that no
+        // two pieces have equivalent elements. The set algorithms need that,
+        // and a long run of equivalent elements makes their pieces uneven.
+        template<typename I0, typename I1, typename C, typename P0, typename P1>
+        std::vector<std::pair<std::size_t, std::size_t>> merge_path_partition(
+            I0 a, std::size_t n0, I1 b, std::size_t n1, std::size_t count, C & pred,
+            P0 & proj0, P1 & proj1, bool whole_runs)
+        {
+            std::vector<std::pair<std::size_t, std::size_t>> splits(count + 1);
+            splits[count] = {n0, n1};
+            for(std::size_t k = 1; k < count; ++k)
+            {
+                std::size_t const d = parallel_block_bounds(n0 + n1, count, k).first;
+                std::size_t i = merge_path_corank(a, n0, b, n1, d, pred, proj0, proj1);
+                std::size_t j = d - i;
+                if(whole_runs)
+                {
+                    auto const ai = a + static_cast<iter_difference_t<I0>>(i);
+                    auto const bj = b + static_cast<iter_difference_t<I1>>(j);
+                    if(i < n0 &&
+                       (j == n1 || !invoke(pred, invoke(proj1, *bj), invoke(proj0, *ai))))
+                    {
+                        i = merge_path_lower_(a, i, ai, pred, proj0, proj0);
+                        j = merge_path_lower_(b, j, ai, pred, proj1, proj0);
+                    }
+                    else if(j < n1)
+                    {
+                        i = merge_path_lower_(a, i, bj, pred, proj0, proj1);
+                        j = merge_path_lower_(b, j, bj, pred, proj1, proj1);
+                    }
+                }
+                splits[k] = {i, j};
+            }
+            return splits;
+        }
+
+        // An output iterator that only counts what is written through it.
+        struct counting_output
+        {
+            struct sink
+            {
+                template<typename T>
+                sink const & operator=(T &&) const noexcept
+                {
+                    return *this;
+                }
+            };
+
+            using difference_type = std::ptrdiff_t;
+            std::ptrdiff_t count = 0;
+
+            sink operator*() const noexcept
+            {
+                return {};
+            }
+            counting_output & operator++() noexcept
+            {
+                ++count;
+                return *this;
+            }
+            counting_output operator++(int) noexcept
+            {
+                auto tmp = *this;
+                ++count;
+                return tmp;
+            }
+        };
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#endif
@@ -0,0 +1,630 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_DETAIL_SIMD_COMPACT_HPP
+#define RANGES_V3_DETAIL_SIMD_COMPACT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/functional/not_fn.hpp>
+#include <range/v3/functional/pred.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+
+// The kernels are compiled for AVX2 and AVX-512 with target attributes and
+// chosen at run time, so they need GCC or Clang on x86-64. Define
+// RANGES_NO_SIMD_COMPACT to use the scalar loop everywhere.
+#if !defined(RANGES_NO_SIMD_COMPACT) && (defined(__GNUC__) || defined(__clang__)) && \
+    defined(__x86_64__)
+#include <immintrin.h>
+#define RANGES_SIMD_COMPACT 1
+#define RANGES_TARGET_AVX2 __attribute__((target("avx2,bmi2,popcnt")))
+#define RANGES_TARGET_AVX512 __attribute__((target("avx512f,popcnt")))
+#endif
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        enum class simd_isa
+        {
+            none,
+            avx2,
+            avx512
+        };
+
+        // The widest instruction set the compaction kernels can use here.
+        inline simd_isa compact_isa() noexcept
+        {
+#ifdef RANGES_SIMD_COMPACT
+            static simd_isa const isa = [] {
+                __builtin_cpu_init();
+                if(__builtin_cpu_supports("avx512f"))
+                    return simd_isa::avx512;
+                if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2"))
+                    return simd_isa::avx2;
+                return simd_isa::none;
+            }();
+            return isa;
+#else
+            return simd_isa::none;
+#endif
+        }
+
+        // Every predicate of the vocabulary in pred.hpp tests one of these on
+        // its argument, and then maybe negates the result.
+        enum class compact_test
+        {
+            lt,     // u < lo
+            gt,     // lo < u
+            eq,     // u == lo
+            outside // u < lo || hi < u
+        };
+
+        template<compact_test Test, bool Negate>
+        struct compact_pred_base_
+        {
+            static constexpr bool value = true;
+            static constexpr compact_test test = Test;
+            static constexpr bool negate = Negate;
+        };
+
+        // Describes the predicates the kernels recognize: what they test,
+        // and against which bounds.
+        template<typename Pred>
+        struct compact_pred_
+        {
+            static constexpr bool value = false;
+        };
+
+        template<typename Cmp, typename T, compact_test Test, bool Negate>
+        struct compact_compare_ : compact_pred_base_<Test, Negate>
+        {
+            using bound_t = T;
+            static constexpr T const & lo(pred::compare_with<Cmp, T> const & p) noexcept
+            {
+                return p.bound;
+            }
+            static constexpr T const & hi(pred::compare_with<Cmp, T> const & p) noexcept
+            {
+                return p.bound;
+            }
+        };
+        // less_equal(u, b) is !less(b, u), and greater_equal(u, b) is
+        // !less(u, b), so both keep their meaning for NaNs.
+        template<typename T>
+        struct compact_pred_<pred::compare_with<less, T>>
+          : compact_compare_<less, T, compact_test::lt, false>
+        {};
+        template<typename T>
+        struct compact_pred_<pred::compare_with<less_equal, T>>
+          : compact_compare_<less_equal, T, compact_test::gt, true>
+        {};
+        template<typename T>
+        struct compact_pred_<pred::compare_with<greater, T>>
+          : compact_compare_<greater, T, compact_test::gt, false>
+        {};
+        template<typename T>
+        struct compact_pred_<pred::compare_with<greater_equal, T>>
+          : compact_compare_<greater_equal, T, compact_test::lt, true>
+        {};
+        template<typename T>
+        struct compact_pred_<pred::compare_with<equal_to, T>>
+          : compact_compare_<equal_to, T, compact_test::eq, false>
+        {};
+        template<typename T>
+        struct compact_pred_<pred::compare_with<not_equal_to, T>>
+          : compact_compare_<not_equal_to, T, compact_test::eq, true>
+        {};
+        template<typename T>
+        struct compact_pred_<pred::within<T>>
+          : compact_pred_base_<compact_test::outside, true>
+        {
+            using bound_t = T;
+            static constexpr T const & lo(pred::within<T> const & p) noexcept
+            {
+                return p.lo;
+            }
+            static constexpr T const & hi(pred::within<T> const & p) noexcept
+            {
+                return p.hi;
+            }
+        };
+        template<typename Pred, bool = compact_pred_<Pred>::value>
+        struct compact_negated_
+        {
+            static constexpr bool value = false;
+        };
+        template<typename Pred>
+        struct compact_negated_<Pred, true>
+          : compact_pred_base_<compact_pred_<Pred>::test, !compact_pred_<Pred>::negate>
+        {
+            using bound_t = typename compact_pred_<Pred>::bound_t;
+            static constexpr bound_t const & lo(logical_negate<Pred> const & p) noexcept
+            {
+                return compact_pred_<Pred>::lo(p.negated_());
+            }
+            static constexpr bound_t const & hi(logical_negate<Pred> const & p) noexcept
+            {
+                return compact_pred_<Pred>::hi(p.negated_());
+            }
+        };
+        template<typename Pred>
+        struct compact_pred_<logical_negate<Pred>> : compact_negated_<Pred>
+        {};
+
+        // The parallel algorithms pass their predicates by std::ref.
+        template<typename Pred, bool = compact_pred_<Pred>::value>
+        struct compact_referred_
+        {
+            static constexpr bool value = false;
+        };
+        template<typename Pred>
+        struct compact_referred_<Pred, true>
+          : compact_pred_base_<compact_pred_<Pred>::test, compact_pred_<Pred>::negate>
+        {
+            using bound_t = typename compact_pred_<Pred>::bound_t;
+            template<typename Ref>
+            static constexpr bound_t const & lo(Ref const & p) noexcept
+            {
+                return compact_pred_<Pred>::lo(p.get());
+            }
+            template<typename Ref>
+            static constexpr bound_t const & hi(Ref const & p) noexcept
+            {
+                return compact_pred_<Pred>::hi(p.get());
+            }
+        };
+        template<typename Pred>
+        struct compact_pred_<std::reference_wrapper<Pred>>
+          : compact_referred_<meta::_t<std::remove_const<Pred>>>
+        {};
+
+        template<typename P>
+        struct is_identity_proj_ : meta::bool_<Same<P, identity>>
+        {};
+        template<typename P>
+        struct is_identity_proj_<std::reference_wrapper<P>>
+          : meta::bool_<Same<meta::_t<std::remove_const<P>>, identity>>
+        {};
+
+        // Elements of type V can be tested by the kernels against a bound of
+        // type T when comparing them converts the bound to V.
+        template<typename V, typename T>
+        using compact_scalar_ = meta::bool_<
+            std::is_arithmetic<V>::value && !Same<V, bool> &&
+            (sizeof(V) == 4 || sizeof(V) == 8) && std::is_arithmetic<T>::value &&
+            Same<meta::_t<std::common_type<V, T>>, V>>;
+
+        template<typename V, typename Pred, bool = compact_pred_<Pred>::value>
+        struct compact_value_pred_ : std::false_type
+        {};
+        template<typename V, typename Pred>
+        struct compact_value_pred_<V, Pred, true>
+          : compact_scalar_<V, typename compact_pred_<Pred>::bound_t>
+        {};
+
+        // Contiguous sequences of 32- and 64-bit integers and floating-point
+        // numbers, tested without a projection by a predicate from pred.hpp,
+        // can be compacted with the kernels below.
+        template<typename I, typename S, typename Pred, typename P, typename = void>
+        struct simd_compactable_ : std::false_type
+        {};
+        template<typename I, typename S, typename Pred, typename P>
+        struct simd_compactable_<
+            I, S, Pred, P, meta::if_c<ContiguousIterator<I> && SizedSentinel<S, I>>>
+          : meta::bool_<is_identity_proj_<P>::value &&
+                        compact_value_pred_<iter_value_t<I>, Pred>::value>
+        {};
+
+#ifdef RANGES_SIMD_COMPACT
+        // Each lanes struct loads, tests and rearranges a vector of elements
+        // of one type. key maps an element to one that compares the same way
+        // as signed integers do, for the unsigned types under AVX2.
+        struct avx2_i32_
+        {
+            static constexpr int lanes = 8;
+            RANGES_TARGET_AVX2 static __m256i broadcast(std::int32_t x) noexcept
+            {
+                return _mm256_set1_epi32(x);
+            }
+            RANGES_TARGET_AVX2 static __m256i key(__m256i x) noexcept
+            {
+                return x;
+            }
+            RANGES_TARGET_AVX2 static __m256i lt(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_cmpgt_epi32(b, x);
+            }
+            RANGES_TARGET_AVX2 static __m256i gt(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_cmpgt_epi32(x, b);
+            }
+            RANGES_TARGET_AVX2 static __m256i eq(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_cmpeq_epi32(x, b);
+            }
+            RANGES_TARGET_AVX2 static unsigned mask(__m256i r) noexcept
+            {
+                return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(r)));
+            }
+            // One bit per 32-bit half lane.
+            RANGES_TARGET_AVX2 static unsigned halves(unsigned m) noexcept
+            {
+                return m;
+            }
+        };
+        struct avx2_u32_ : avx2_i32_
+        {
+            RANGES_TARGET_AVX2 static __m256i broadcast(std::uint32_t x) noexcept
+            {
+                return _mm256_set1_epi32(static_cast<std::int32_t>(x ^ 0x80000000u));
+            }
+            RANGES_TARGET_AVX2 static __m256i key(__m256i x) noexcept
+            {
+                return _mm256_xor_si256(x, _mm256_set1_epi32(INT32_MIN));
+            }
+        };
+        struct avx2_f32_ : avx2_i32_
+        {
+            RANGES_TARGET_AVX2 static __m256i broadcast(float x) noexcept
+            {
+                return _mm256_castps_si256(_mm256_set1_ps(x));
+            }
+            RANGES_TARGET_AVX2 static __m256i lt(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(
+                    _mm256_castsi256_ps(x), _mm256_castsi256_ps(b), _CMP_LT_OQ));
+            }
+            RANGES_TARGET_AVX2 static __m256i gt(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(
+                    _mm256_castsi256_ps(x), _mm256_castsi256_ps(b), _CMP_GT_OQ));
+            }
+            RANGES_TARGET_AVX2 static __m256i eq(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(
+                    _mm256_castsi256_ps(x), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+            }
+        };
+        struct avx2_i64_
+        {
+            static constexpr int lanes = 4;
+            RANGES_TARGET_AVX2 static __m256i broadcast(std::int64_t x) noexcept
+            {
+                return _mm256_set1_epi64x(x);
+            }
+            RANGES_TARGET_AVX2 static __m256i key(__m256i x) noexcept
+            {
+                return x;
+            }
+            RANGES_TARGET_AVX2 static __m256i lt(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_cmpgt_epi64(b, x);
+            }
+            RANGES_TARGET_AVX2 static __m256i gt(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_cmpgt_epi64(x, b);
+            }
+            RANGES_TARGET_AVX2 static __m256i eq(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_cmpeq_epi64(x, b);
+            }
+            RANGES_TARGET_AVX2 static unsigned mask(__m256i r) noexcept
+            {
+                return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(r)));
+            }
+            RANGES_TARGET_AVX2 static unsigned halves(unsigned m) noexcept
+            {
+                return _pdep_u32(m, 0x55u) * 3u;
+            }
+        };
+        struct avx2_u64_ : avx2_i64_
+        {
+            RANGES_TARGET_AVX2 static __m256i broadcast(std::uint64_t x) noexcept
+            {
+                return _mm256_set1_epi64x(
+                    static_cast<std::int64_t>(x ^ 0x8000000000000000u));
+            }
+            RANGES_TARGET_AVX2 static __m256i key(__m256i x) noexcept
+            {
+                return _mm256_xor_si256(x, _mm256_set1_epi64x(INT64_MIN));
+            }
+        };
+        struct avx2_f64_ : avx2_i64_
+        {
+            RANGES_TARGET_AVX2 static __m256i broadcast(double x) noexcept
+            {
+                return _mm256_castpd_si256(_mm256_set1_pd(x));
+            }
+            RANGES_TARGET_AVX2 static __m256i lt(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_castpd_si256(_mm256_cmp_pd(
+                    _mm256_castsi256_pd(x), _mm256_castsi256_pd(b), _CMP_LT_OQ));
+            }
+            RANGES_TARGET_AVX2 static __m256i gt(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_castpd_si256(_mm256_cmp_pd(
+                    _mm256_castsi256_pd(x), _mm256_castsi256_pd(b), _CMP_GT_OQ));
+            }
+            RANGES_TARGET_AVX2 static __m256i eq(__m256i x, __m256i b) noexcept
+            {
+                return _mm256_castpd_si256(_mm256_cmp_pd(
+                    _mm256_castsi256_pd(x), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+            }
+        };
+
+        // Moves the 32-bit lanes of x selected by m to the front, in order:
+        // pdep spreads the bits of m to whole bytes, and pext picks the
+        // indices of the selected lanes out of 0, 1, ..., 7.
+        RANGES_TARGET_AVX2 inline __m256i avx2_compress_(__m256i x, unsigned m) noexcept
+        {
+            std::uint64_t const bytes = _pdep_u64(m, 0x0101010101010101u) * 0xffu;
+            std::uint64_t const idx = _pext_u64(0x0706050403020100u, bytes);
+            return _mm256_permutevar8x32_epi32(
+                x, _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(idx))));
+        }
+
+        template<typename L, compact_test Test>
+        RANGES_TARGET_AVX2 unsigned avx2_test_(__m256i y, __m256i lo, __m256i hi) noexcept
+        {
+            switch(Test)
+            {
+            case compact_test::lt: return L::mask(L::lt(y, lo));
+            case compact_test::gt: return L::mask(L::gt(y, lo));
+            case compact_test::eq: return L::mask(L::eq(y, lo));
+            default: return L::mask(_mm256_or_si256(L::lt(y, lo), L::gt(y, hi)));
+            }
+        }
+
+        // Writes the elements of in[0, n) whose bit of the test, xor flip, is
+        // set to out, and returns how many. Stops short of the last partial
+        // vector, and sets n to where it stopped. When InPlace, out <= in, and
+        // whole vectors are stored: the lanes past the elements kept land on
+        // elements already read.
+        template<typename L, compact_test Test, bool InPlace, typename V>
+        RANGES_TARGET_AVX2 std::size_t avx2_compact_(V const * in, std::size_t & n,
+                                                     V * out, V lo, V hi,
+                                                     unsigned flip) noexcept
+        {
+            constexpr std::size_t lanes = L::lanes;
+            flip &= (1u << lanes) - 1u;
+            __m256i const a = L::broadcast(lo), b = L::broadcast(hi);
+            __m256i const iota = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            std::size_t i = 0, k = 0;
+            for(; i + lanes <= n; i += lanes)
+            {
+                __m256i const x =
+                    _mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + i));
+                unsigned const m = avx2_test_<L, Test>(L::key(x), a, b) ^ flip;
+                unsigned const h = L::halves(m);
+                __m256i const y = avx2_compress_(x, h);
+                if(InPlace)
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + k), y);
+                else
+                    _mm256_maskstore_epi32(
+                        reinterpret_cast<int *>(out + k),
+                        _mm256_cmpgt_epi32(_mm256_set1_epi32(_mm_popcnt_u32(h)), iota),
+                        y);
+                k += static_cast<std::size_t>(_mm_popcnt_u32(m));
+            }
+            n = i;
+            return k;
+        }
+
+        struct avx512_i32_
+        {
+            static constexpr int lanes = 16;
+            RANGES_TARGET_AVX512 static __m512i broadcast(std::int32_t x) noexcept
+            {
+                return _mm512_set1_epi32(x);
+            }
+            template<int Cmp>
+            RANGES_TARGET_AVX512 static unsigned cmp(__m512i x, __m512i b) noexcept
+            {
+                return _mm512_cmp_epi32_mask(x, b, Cmp);
+            }
+            RANGES_TARGET_AVX512 static __m512i compress(unsigned m, __m512i x) noexcept
+            {
+                return _mm512_maskz_compress_epi32(static_cast<__mmask16>(m), x);
+            }
+            RANGES_TARGET_AVX512 static void store(void * out, unsigned k,
+                                                   __m512i x) noexcept
+            {
+                _mm512_mask_storeu_epi32(out, static_cast<__mmask16>((1u << k) - 1u), x);
+            }
+        };
+        struct avx512_u32_ : avx512_i32_
+        {
+            RANGES_TARGET_AVX512 static __m512i broadcast(std::uint32_t x) noexcept
+            {
+                return _mm512_set1_epi32(static_cast<std::int32_t>(x));
+            }
+            template<int Cmp>
+            RANGES_TARGET_AVX512 static unsigned cmp(__m512i x, __m512i b) noexcept
+            {
+                return _mm512_cmp_epu32_mask(x, b, Cmp);
+            }
+        };
+        struct avx512_f32_ : avx512_i32_
+        {
+            RANGES_TARGET_AVX512 static __m512i broadcast(float x) noexcept
+            {
+                return _mm512_castps_si512(_mm512_set1_ps(x));
+            }
+            template<int Cmp>
+            RANGES_TARGET_AVX512 static unsigned cmp(__m512i x, __m512i b) noexcept
+            {
+                return _mm512_cmp_ps_mask(_mm512_castsi512_ps(x), _mm512_castsi512_ps(b),
+                                          Cmp == _MM_CMPINT_LT
+                                              ? _CMP_LT_OQ
+                                              : Cmp == _MM_CMPINT_NLE ? _CMP_GT_OQ
+                                                                      : _CMP_EQ_OQ);
+            }
+        };
+        struct avx512_i64_
+        {
+            static constexpr int lanes = 8;
+            RANGES_TARGET_AVX512 static __m512i broadcast(std::int64_t x) noexcept
+            {
+                return _mm512_set1_epi64(x);
+            }
+            template<int Cmp>
+            RANGES_TARGET_AVX512 static unsigned cmp(__m512i x, __m512i b) noexcept
+            {
+                return _mm512_cmp_epi64_mask(x, b, Cmp);
+            }
+            RANGES_TARGET_AVX512 static __m512i compress(unsigned m, __m512i x) noexcept
+            {
+                return _mm512_maskz_compress_epi64(static_cast<__mmask8>(m), x);
+            }
+            RANGES_TARGET_AVX512 static void store(void * out, unsigned k,
+                                                   __m512i x) noexcept
+            {
+                _mm512_mask_storeu_epi64(out, static_cast<__mmask8>((1u << k) - 1u), x);
+            }
+        };
+        struct avx512_u64_ : avx512_i64_
+        {
+            RANGES_TARGET_AVX512 static __m512i broadcast(std::uint64_t x) noexcept
+            {
+                return _mm512_set1_epi64(static_cast<std::int64_t>(x));
+            }
+            template<int Cmp>
+            RANGES_TARGET_AVX512 static unsigned cmp(__m512i x, __m512i b) noexcept
+            {
+                return _mm512_cmp_epu64_mask(x, b, Cmp);
+            }
+        };
+        struct avx512_f64_ : avx512_i64_
+        {
+            RANGES_TARGET_AVX512 static __m512i broadcast(double x) noexcept
+            {
+                return _mm512_castpd_si512(_mm512_set1_pd(x));
+            }
+            template<int Cmp>
+            RANGES_TARGET_AVX512 static unsigned cmp(__m512i x, __m512i b) noexcept
+            {
+                return _mm512_cmp_pd_mask(_mm512_castsi512_pd(x), _mm512_castsi512_pd(b),
+                                          Cmp == _MM_CMPINT_LT
+                                              ? _CMP_LT_OQ
+                                              : Cmp == _MM_CMPINT_NLE ? _CMP_GT_OQ
+                                                                      : _CMP_EQ_OQ);
+            }
+        };
+
+        template<typename L, compact_test Test>
+        RANGES_TARGET_AVX512 unsigned avx512_test_(__m512i x, __m512i lo,
+                                                   __m512i hi) noexcept
+        {
+            switch(Test)
+            {
+            case compact_test::lt: return L::template cmp<_MM_CMPINT_LT>(x, lo);
+            case compact_test::gt: return L::template cmp<_MM_CMPINT_NLE>(x, lo);
+            case compact_test::eq: return L::template cmp<_MM_CMPINT_EQ>(x, lo);
+            default:
+                return L::template cmp<_MM_CMPINT_LT>(x, lo) |
+                       L::template cmp<_MM_CMPINT_NLE>(x, hi);
+            }
+        }
+
+        // As avx2_compact_, with the compress instruction and masked stores.
+        template<typename L, compact_test Test, bool InPlace, typename V>
+        RANGES_TARGET_AVX512 std::size_t avx512_compact_(V const * in, std::size_t & n,
+                                                         V * out, V lo, V hi,
+                                                         unsigned flip) noexcept
+        {
+            constexpr std::size_t lanes = L::lanes;
+            flip &= (1u << lanes) - 1u;
+            __m512i const a = L::broadcast(lo), b = L::broadcast(hi);
+            std::size_t i = 0, k = 0;
+            for(; i + lanes <= n; i += lanes)
+            {
+                __m512i const x = _mm512_loadu_si512(in + i);
+                unsigned const m = avx512_test_<L, Test>(x, a, b) ^ flip;
+                __m512i const y = L::compress(m, x);
+                unsigned const c = static_cast<unsigned>(_mm_popcnt_u32(m));
+                if(InPlace)
+                    _mm512_storeu_si512(out + k, y);
+                else
+                    L::store(out + k, c, y);
+                k += c;
+            }
+            n = i;
+            return k;
+        }
+
+        template<typename V>
+        using avx2_lanes_t = meta::if_c<
+            std::is_floating_point<V>::value,
+            meta::if_c<sizeof(V) == 4, avx2_f32_, avx2_f64_>,
+            meta::if_c<std::is_signed<V>::value,
+                       meta::if_c<sizeof(V) == 4, avx2_i32_, avx2_i64_>,
+                       meta::if_c<sizeof(V) == 4, avx2_u32_, avx2_u64_>>>;
+        template<typename V>
+        using avx512_lanes_t = meta::if_c<
+            std::is_floating_point<V>::value,
+            meta::if_c<sizeof(V) == 4, avx512_f32_, avx512_f64_>,
+            meta::if_c<std::is_signed<V>::value,
+                       meta::if_c<sizeof(V) == 4, avx512_i32_, avx512_i64_>,
+                       meta::if_c<sizeof(V) == 4, avx512_u32_, avx512_u64_>>>;
+#endif
+
+        // Writes the elements of in[0, n) for which pred is Keep to out, in
+        // order, and returns how many were written. When InPlace, out may be
+        // in; otherwise the two must not overlap. Uses the widest kernel isa
+        // allows, and a scalar loop for the rest.
+        template<bool Keep, bool InPlace, typename V, typename Pred>
+        std::size_t simd_compact(V const * in, std::size_t n, V * out, Pred & pred,
+                                 simd_isa isa = compact_isa())
+        {
+            CPP_assert(compact_value_pred_<V, Pred>::value);
+            std::size_t i = 0, k = 0;
+#ifdef RANGES_SIMD_COMPACT
+            using spec = compact_pred_<Pred>;
+            V const lo = static_cast<V>(spec::lo(pred));
+            V const hi = static_cast<V>(spec::hi(pred));
+            unsigned const flip = spec::negate == Keep ? ~0u : 0u;
+            i = n;
+            if(isa == simd_isa::avx512)
+                k = detail::avx512_compact_<avx512_lanes_t<V>, spec::test, InPlace>(
+                    in, i, out, lo, hi, flip);
+            else if(isa == simd_isa::avx2)
+                k = detail::avx2_compact_<avx2_lanes_t<V>, spec::test, InPlace>(
+                    in, i, out, lo, hi, flip);
+            else
+                i = 0;
+#else
+            (void)isa;
+#endif
+            for(; i < n; ++i)
+            {
+                if(static_cast<bool>(invoke(pred, in[i])) == Keep)
+                    out[k++] = in[i];
+            }
+            return k;
+        }
+    } // namespace detail
+    /// \endcond
+} // namespace ranges
+
+#endif
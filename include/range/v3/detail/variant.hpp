@@ -310,40 +310,175 @@ namespace ranges
             meta::list<Ts...>, meta::as_list<meta::make_index_sequence<sizeof...(Ts)>>,
             meta::quote<indexed_datum>>>>;
 
-        inline std::size_t variant_move_copy_(std::size_t, variant_nil, variant_nil)
+        template<typename Data>
+        struct variant_data_size_
+          : meta::size_t<1 + variant_data_size_<typename Data::tail_t>::value>
+        {};
+        template<>
+        struct variant_data_size_<variant_nil> : meta::size_t<0>
+        {};
+        template<typename Data>
+        using variant_data_size = variant_data_size_<meta::_t<std::remove_cv<Data>>>;
+
+        // The datum of alternative N, found by walking the unions at compile
+        // time.
+        template<std::size_t N>
+        struct variant_at_
         {
-            return 0;
-        }
+            template<typename Data>
+            static constexpr decltype(auto) get(Data && data) noexcept
+            {
+                return variant_at_<N - 1>::get(static_cast<Data &&>(data).tail);
+            }
+        };
+        template<>
+        struct variant_at_<0>
+        {
+            template<typename Data>
+            static constexpr decltype(auto) get(Data && data) noexcept
+            {
+                return (static_cast<Data &&>(data).head);
+            }
+        };
+
+        template<bool Valid>
+        struct variant_case_
+        {
+            template<std::size_t I, typename R, typename Fun>
+            static R call(Fun & fun)
+            {
+                return fun(meta::size_t<I>{});
+            }
+        };
+        template<>
+        struct variant_case_<false>
+        {
+            template<std::size_t I, typename R, typename Fun>
+            [[noreturn]] static R call(Fun &)
+            {
+                RANGES_ASSUME(false);
+            }
+        };
+
+        // Calls fun(meta::size_t<n>{}) for a run-time n < Size with a switch
+        // over blocks of 16 alternatives, which compilers lower to a jump
+        // table. Dispatch costs one indirect jump per block of 16 that
+        // precedes n, rather than one comparison per preceding alternative.
+        template<typename R, std::size_t Size, std::size_t Base = 0>
+        struct variant_switch_
+        {
+#define RANGES_VARIANT_CASE_(I)                                                \
+    case I:                                                                    \
+        return variant_case_<(Base + I < Size)>::template call<Base + I, R>(fun)
+
+            template<typename Fun>
+            static R call(std::size_t n, Fun & fun)
+            {
+                // Checked once here so that the cases past the end are known to
+                // be unreachable.
+                RANGES_EXPECT(n < Size);
+                switch(n - Base)
+                {
+                    RANGES_VARIANT_CASE_(0);
+                    RANGES_VARIANT_CASE_(1);
+                    RANGES_VARIANT_CASE_(2);
+                    RANGES_VARIANT_CASE_(3);
+                    RANGES_VARIANT_CASE_(4);
+                    RANGES_VARIANT_CASE_(5);
+                    RANGES_VARIANT_CASE_(6);
+                    RANGES_VARIANT_CASE_(7);
+                    RANGES_VARIANT_CASE_(8);
+                    RANGES_VARIANT_CASE_(9);
+                    RANGES_VARIANT_CASE_(10);
+                    RANGES_VARIANT_CASE_(11);
+                    RANGES_VARIANT_CASE_(12);
+                    RANGES_VARIANT_CASE_(13);
+                    RANGES_VARIANT_CASE_(14);
+                    RANGES_VARIANT_CASE_(15);
+                default:
+                    return variant_switch_::next_(meta::bool_<(Base + 16 < Size)>{}, n,
+                                                  fun);
+                }
+            }
+#undef RANGES_VARIANT_CASE_
+
+        private:
+            template<typename Fun>
+            static R next_(std::true_type, std::size_t n, Fun & fun)
+            {
+                return variant_switch_<R, Size, Base + 16>::call(n, fun);
+            }
+            template<typename Fun>
+            [[noreturn]] static R next_(std::false_type, std::size_t, Fun &)
+            {
+                RANGES_ASSUME(false);
+            }
+        };
+
+        template<typename Data0, typename Data1>
+        struct variant_move_copy_fn
+        {
+            Data0 & self;
+            Data1 && that;
+
+            template<std::size_t N>
+            void operator()(meta::size_t<N>) const
+            {
+                using Head = meta::_t<std::remove_reference<decltype(
+                    variant_at_<N>::get(self))>>;
+                ::new((void *)std::addressof(variant_at_<N>::get(self)))
+                    Head(variant_at_<N>::get(static_cast<Data1 &&>(that)));
+            }
+        };
         template<typename Data0, typename Data1>
         std::size_t variant_move_copy_(std::size_t n, Data0 & self, Data1 && that)
         {
-            using Head = typename Data0::head_t;
-            return 0 == n
-                       ? ((void)::new((void *)&self.head) Head(((Data1 &&) that).head), 0)
-                       : variant_move_copy_(n - 1, self.tail, ((Data1 &&) that).tail) + 1;
+            constexpr std::size_t size = variant_data_size<Data0>::value;
+            if(n < size)
+            {
+                variant_move_copy_fn<Data0, Data1> fn{self, static_cast<Data1 &&>(that)};
+                variant_switch_<void, size>::call(n, fn);
+            }
+            return n;
         }
-        constexpr bool variant_equal_(std::size_t, variant_nil, variant_nil)
+
+        template<typename Data0, typename Data1>
+        struct variant_equal_fn
         {
-            return true;
-        }
+            Data0 const & self;
+            Data1 const & that;
+
+            template<std::size_t N>
+            bool operator()(meta::size_t<N>) const
+            {
+                return variant_at_<N>::get(self).get() == variant_at_<N>::get(that).get();
+            }
+        };
         template<typename Data0, typename Data1>
-        constexpr bool variant_equal_(std::size_t n, Data0 const & self,
-                                      Data1 const & that)
+        bool variant_equal_(std::size_t n, Data0 const & self, Data1 const & that)
         {
-            return n == 0 ? self.head.get() == that.head.get()
-                          : variant_equal_(n - 1, self.tail, that.tail);
+            variant_equal_fn<Data0, Data1> fn{self, that};
+            return variant_switch_<bool, variant_data_size<Data0>::value>::call(n, fn);
         }
-        template<typename Fun, typename Proj = indexed_element_fn>
-        constexpr int variant_visit_(std::size_t, variant_nil, Fun, Proj = {})
+
+        template<typename Data, typename Fun, typename Proj>
+        struct variant_visit_fn
         {
-            return (RANGES_EXPECT(false), 0);
-        }
+            Data & self;
+            Fun & fun;
+            Proj & proj;
+
+            template<std::size_t N>
+            void operator()(meta::size_t<N>) const
+            {
+                (void)invoke(fun, invoke(proj, variant_at_<N>::get(self)));
+            }
+        };
         template<typename Data, typename Fun, typename Proj = indexed_element_fn>
-        constexpr int variant_visit_(std::size_t n, Data & self, Fun fun, Proj proj = {})
+        void variant_visit_(std::size_t n, Data & self, Fun fun, Proj proj = {})
         {
-            return 0 == n ? ((void)invoke(fun, invoke(proj, self.head)), 0)
-                          : detail::variant_visit_(
-                                n - 1, self.tail, detail::move(fun), detail::move(proj));
+            variant_visit_fn<Data, Fun, Proj> fn{self, fun, proj};
+            variant_switch_<void, variant_data_size<Data>::value>::call(n, fn);
         }
 
         struct get_datum_fn
@@ -355,6 +490,20 @@ namespace ranges
             }
         };
 
+        template<typename R, typename Data, typename Fun, typename Proj>
+        struct variant_visit_r_fn
+        {
+            Data & self;
+            Fun & fun;
+            Proj & proj;
+
+            template<std::size_t N>
+            R operator()(meta::size_t<N>) const
+            {
+                return static_cast<R>(invoke(fun, invoke(proj, variant_at_<N>::get(self))));
+            }
+        };
+
         struct indexed_element_fn
         {
             template<typename T>
@@ -392,6 +541,20 @@ namespace ranges
             }
         };
 
+        // Calls fun with the active element of a valid variant, and returns
+        // its result as an R, without building a variant of the results as
+        // variant::visit does. With indexed_element_fn as the projection, fun
+        // is passed an indexed_element, as with variant::visit_i.
+        template<typename R, typename Variant, typename Fun, typename Proj = get_datum_fn>
+        R variant_visit_r(Variant & var, Fun fun, Proj proj = {})
+        {
+            using Data = meta::_t<std::remove_reference<decltype(
+                variant_core_access::data(var))>>;
+            variant_visit_r_fn<R, Data, Fun, Proj> fn{
+                variant_core_access::data(var), fun, proj};
+            return variant_switch_<R, variant_data_size<Data>::value>::call(var.index(), fn);
+        }
+
         struct delete_fn
         {
             template<typename T>
@@ -446,11 +609,6 @@ namespace ranges
         {
             T ** t_;
 
-            template<typename U, std::size_t M>
-            [[noreturn]] meta::if_c<M != N> operator()(indexed_element<U, M>) const
-            {
-                throw bad_variant_access("bad variant access");
-            }
             template<typename U>
             void operator()(indexed_element<U, N> t) const noexcept
             {
@@ -544,8 +702,10 @@ namespace ranges
                     std::remove_reference<meta::at_c<meta::as_list<Variant>, N>>>;
                 elem_t * elem = nullptr;
                 auto & data_var = detail::variant_core_access::data(var);
-                detail::variant_visit_(
-                    var.index(), data_var, detail::get_fn<elem_t, N>{&elem});
+                if(var.index() != N)
+                    throw bad_variant_access("bad variant access");
+                detail::get_fn<elem_t, N>{&elem}(
+                    detail::variant_at_<N>::get(data_var).ref());
                 return detail::variant_deref_(elem);
             }
             template<std::size_t N>
@@ -557,8 +717,10 @@ namespace ranges
                     std::remove_reference<meta::at_c<meta::as_list<Variant>, N> const>>;
                 elem_t * elem = nullptr;
                 auto & data_var = detail::variant_core_access::data(var);
-                detail::variant_visit_(
-                    var.index(), data_var, detail::get_fn<elem_t, N>{&elem});
+                if(var.index() != N)
+                    throw bad_variant_access("bad variant access");
+                detail::get_fn<elem_t, N>{&elem}(
+                    detail::variant_at_<N>::get(data_var).ref());
                 return detail::variant_deref_(elem);
             }
             template<std::size_t N>
@@ -570,8 +732,10 @@ namespace ranges
                     std::remove_reference<meta::at_c<meta::as_list<Variant>, N>>>;
                 elem_t * elem = nullptr;
                 auto & data_var = detail::variant_core_access::data(var);
-                detail::variant_visit_(
-                    var.index(), data_var, detail::get_fn<elem_t, N>{&elem});
+                if(var.index() != N)
+                    throw bad_variant_access("bad variant access");
+                detail::get_fn<elem_t, N>{&elem}(
+                    detail::variant_at_<N>::get(data_var).ref());
                 using res_t = meta::_t<
                     std::add_rvalue_reference<meta::at_c<meta::as_list<Variant>, N>>>;
                 return static_cast<res_t>(detail::variant_deref_(elem));
@@ -758,7 +922,7 @@ namespace ranges
         {
             this->clear_();
             detail::construct_fn<N, Args &&...> fn{static_cast<Args &&>(args)...};
-            detail::variant_visit_(N, data_(), std::ref(fn), identity{});
+            fn(detail::variant_at_<N>::get(data_()));
             index_ = N;
         }
         constexpr bool valid() const noexcept
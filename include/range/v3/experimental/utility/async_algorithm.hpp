@@ -0,0 +1,254 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXPERIMENTAL_UTILITY_ASYNC_ALGORITHM_HPP
+#define RANGES_V3_EXPERIMENTAL_UTILITY_ASYNC_ALGORITHM_HPP
+
+#include <range/v3/detail/config.hpp>
+#if RANGES_CXX_COROUTINES >= RANGES_CXX_COROUTINES_TS1
+#include <experimental/coroutine>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/experimental/utility/async_generator.hpp>
+#include <range/v3/experimental/utility/task.hpp>
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/functional/pipeable.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-view
+    /// @{
+
+    /// \cond
+    namespace detail
+    {
+        template<typename T>
+        struct async_result_
+        {
+            using type = T;
+        };
+        template<typename T>
+        struct async_result_<experimental::task<T>>
+        {
+            using type = T;
+        };
+        // What co_awaiting the result of invoking Fun with Ref yields: the
+        // result of the task if Fun returns one, or else what Fun returns.
+        template<typename Fun, typename Ref>
+        using async_result_t = meta::_t<async_result_<invoke_result_t<Fun &, Ref>>>;
+
+        template<typename T>
+        struct async_ready
+        {
+            T value_;
+
+            bool await_ready() const noexcept
+            {
+                return true;
+            }
+            void await_suspend(std::experimental::coroutine_handle<>) const noexcept
+            {}
+            T await_resume()
+            {
+                return static_cast<T &&>(value_);
+            }
+        };
+        template<>
+        struct async_ready<void>
+        {
+            bool await_ready() const noexcept
+            {
+                return true;
+            }
+            void await_suspend(std::experimental::coroutine_handle<>) const noexcept
+            {}
+            void await_resume() const noexcept
+            {}
+        };
+
+        // Invokes fun with ref and returns something to co_await for the
+        // result: the task fun returned, or else the result itself, ready at
+        // once. This lets the adaptors take both plain and asynchronous
+        // functions.
+        template<typename Fun, typename Ref>
+        auto async_invoke(Fun & fun, Ref && ref)
+            -> CPP_ret(invoke_result_t<Fun &, Ref>)( //
+                requires meta::is<invoke_result_t<Fun &, Ref>, experimental::task>::value)
+        {
+            return invoke(fun, static_cast<Ref &&>(ref));
+        }
+        template<typename Fun, typename Ref>
+        auto async_invoke(Fun & fun, Ref && ref)
+            -> CPP_ret(async_ready<void>)( //
+                requires std::is_void<invoke_result_t<Fun &, Ref>>::value)
+        {
+            invoke(fun, static_cast<Ref &&>(ref));
+            return {};
+        }
+        template<typename Fun, typename Ref>
+        auto async_invoke(Fun & fun, Ref && ref)
+            -> CPP_ret(async_ready<invoke_result_t<Fun &, Ref>>)( //
+                requires(!std::is_void<invoke_result_t<Fun &, Ref>>::value) &&
+                (!meta::is<invoke_result_t<Fun &, Ref>, experimental::task>::value))
+        {
+            return {invoke(fun, static_cast<Ref &&>(ref))};
+        }
+    } // namespace detail
+    /// \endcond
+
+    namespace experimental
+    {
+        /// Adaptors and algorithms for `async_generator`. The functions they
+        /// take may return a `task`, which is awaited for the result, so the
+        /// per-element work can itself wait on I/O.
+        namespace async
+        {
+            struct transform_fn
+            {
+            private:
+                template<typename Reference, typename Value, typename Fun>
+                static async_generator<detail::async_result_t<Fun, Reference>> impl(
+                    async_generator<Reference, Value> gen, Fun fun)
+                {
+                    auto it = co_await gen.begin();
+                    while(it != gen.end())
+                    {
+                        co_yield co_await detail::async_invoke(fun, *it);
+                        co_await ++it;
+                    }
+                }
+
+            public:
+                template<typename Reference, typename Value, typename Fun>
+                auto operator()(async_generator<Reference, Value> gen, Fun fun) const
+                    -> CPP_ret(
+                        async_generator<detail::async_result_t<Fun, Reference>>)( //
+                        requires Invocable<Fun &, Reference>)
+                {
+                    return transform_fn::impl(std::move(gen), std::move(fun));
+                }
+                template<typename Fun>
+                auto operator()(Fun fun) const
+                {
+                    return make_pipeable(bind_back(*this, std::move(fun)));
+                }
+            };
+
+            /// \relates transform_fn
+            RANGES_INLINE_VARIABLE(transform_fn, transform)
+
+            struct filter_fn
+            {
+            private:
+                template<typename Reference, typename Value, typename Pred>
+                static async_generator<Reference, Value> impl(
+                    async_generator<Reference, Value> gen, Pred pred)
+                {
+                    auto it = co_await gen.begin();
+                    while(it != gen.end())
+                    {
+                        if(co_await detail::async_invoke(pred, *it))
+                            co_yield *it;
+                        co_await ++it;
+                    }
+                }
+
+            public:
+                template<typename Reference, typename Value, typename Pred>
+                auto operator()(async_generator<Reference, Value> gen, Pred pred) const
+                    -> CPP_ret(async_generator<Reference, Value>)( //
+                        requires Invocable<Pred &, Reference> &&
+                            ConvertibleTo<detail::async_result_t<Pred, Reference>, bool>)
+                {
+                    return filter_fn::impl(std::move(gen), std::move(pred));
+                }
+                template<typename Pred>
+                auto operator()(Pred pred) const
+                {
+                    return make_pipeable(bind_back(*this, std::move(pred)));
+                }
+            };
+
+            /// \relates filter_fn
+            RANGES_INLINE_VARIABLE(filter_fn, filter)
+
+            struct for_each_fn
+            {
+            private:
+                template<typename Reference, typename Value, typename Fun>
+                static task<> impl(async_generator<Reference, Value> gen, Fun fun)
+                {
+                    auto it = co_await gen.begin();
+                    while(it != gen.end())
+                    {
+                        co_await detail::async_invoke(fun, *it);
+                        co_await ++it;
+                    }
+                }
+
+            public:
+                /// A task that calls \c fun with each element in turn.
+                template<typename Reference, typename Value, typename Fun>
+                auto operator()(async_generator<Reference, Value> gen, Fun fun) const
+                    -> CPP_ret(task<>)( //
+                        requires Invocable<Fun &, Reference>)
+                {
+                    return for_each_fn::impl(std::move(gen), std::move(fun));
+                }
+            };
+
+            /// \relates for_each_fn
+            RANGES_INLINE_VARIABLE(for_each_fn, for_each)
+
+            /// A task that collects the elements into a \c Cont.
+            template<typename Cont, typename Reference, typename Value>
+            task<Cont> to(async_generator<Reference, Value> gen)
+            {
+                Cont c;
+                auto it = co_await gen.begin();
+                while(it != gen.end())
+                {
+                    c.insert(c.end(), *it);
+                    co_await ++it;
+                }
+                co_return c;
+            }
+
+            struct to_vector_fn
+            {
+                template<typename Reference, typename Value>
+                task<std::vector<Value>> operator()(
+                    async_generator<Reference, Value> gen) const
+                {
+                    return async::to<std::vector<Value>>(std::move(gen));
+                }
+            };
+
+            /// \relates to_vector_fn
+            RANGES_INLINE_VARIABLE(to_vector_fn, to_vector)
+        } // namespace async
+    }     // namespace experimental
+    /// @}
+} // namespace ranges
+#endif // RANGES_CXX_COROUTINES >= RANGES_CXX_COROUTINES_TS1
+
+#endif // RANGES_V3_EXPERIMENTAL_UTILITY_ASYNC_ALGORITHM_HPP
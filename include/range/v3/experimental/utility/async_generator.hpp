@@ -0,0 +1,271 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXPERIMENTAL_UTILITY_ASYNC_GENERATOR_HPP
+#define RANGES_V3_EXPERIMENTAL_UTILITY_ASYNC_GENERATOR_HPP
+
+#include <range/v3/detail/config.hpp>
+#if RANGES_CXX_COROUTINES >= RANGES_CXX_COROUTINES_TS1
+#include <cstddef>
+#include <exception>
+#include <experimental/coroutine>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/experimental/utility/generator.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/swap.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-view
+    /// @{
+
+    /// \cond
+    namespace detail
+    {
+        // An awaitable that suspends the current coroutine and resumes another
+        // in its place, without growing the stack.
+        struct coroutine_transfer
+        {
+            std::experimental::coroutine_handle<> next_;
+
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+            std::experimental::coroutine_handle<> await_suspend(
+                std::experimental::coroutine_handle<>) const noexcept
+            {
+                return next_;
+            }
+            void await_resume() const noexcept
+            {}
+        };
+
+        // Unlike generator_promise, this leaves co_await alone, so that the
+        // producer can wait on other coroutines between values. Each co_yield
+        // hands control back to the consumer that asked for the next value.
+        template<typename Reference>
+        struct async_generator_promise : coroutine_frame_allocation
+        {
+            std::exception_ptr except_ = nullptr;
+            std::experimental::coroutine_handle<> consumer_ = nullptr;
+
+            CPP_assert(std::is_reference<Reference>::value ||
+                       CopyConstructible<Reference>);
+
+            async_generator_promise * get_return_object() noexcept
+            {
+                return this;
+            }
+            std::experimental::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+            coroutine_transfer final_suspend() const noexcept
+            {
+                return {consumer_};
+            }
+            void return_void() const noexcept
+            {}
+            void unhandled_exception() noexcept
+            {
+                except_ = std::current_exception();
+                RANGES_EXPECT(except_);
+            }
+            template<typename Arg>
+            auto yield_value(Arg && arg) noexcept(
+                std::is_nothrow_assignable<semiregular_t<Reference> &, Arg>::value)
+                -> CPP_ret(coroutine_transfer)( //
+                    requires ConvertibleTo<Arg, Reference> &&
+                        std::is_assignable<semiregular_t<Reference> &, Arg>::value)
+            {
+                ref_ = std::forward<Arg>(arg);
+                return {consumer_};
+            }
+            meta::if_<std::is_reference<Reference>, Reference, Reference const &> read()
+                const noexcept
+            {
+                return ref_;
+            }
+
+        private:
+            semiregular_t<Reference> ref_;
+        };
+    } // namespace detail
+    /// \endcond
+
+    namespace experimental
+    {
+        /// A coroutine that produces a sequence of \c Reference, like
+        /// `generator`, but that may itself co_await between values: on a
+        /// `task`, another async_generator or an `event_loop`. Consumers
+        /// co_await `begin()` and each `++it`, so a coroutine reading from an
+        /// async_generator suspends, rather than blocks its thread, while the
+        /// producer waits. It is not a range; the adaptors and algorithms in
+        /// range/v3/experimental/utility/async_algorithm.hpp work with it.
+        /// async_generator owns its coroutine and is move-only.
+        template<typename Reference, typename Value = uncvref_t<Reference>>
+        struct async_generator
+        {
+            using promise_type = detail::async_generator_promise<Reference>;
+
+        private:
+            using handle = std::experimental::coroutine_handle<promise_type>;
+            handle coro_ = nullptr;
+
+            // Resumes the producer until it yields a value or finishes, and
+            // rethrows what it threw.
+            struct advance_awaiter
+            {
+                handle coro_;
+
+                explicit advance_awaiter(handle coro) noexcept
+                  : coro_(coro)
+                {}
+                bool await_ready() const noexcept
+                {
+                    return !coro_ || coro_.done();
+                }
+                std::experimental::coroutine_handle<> await_suspend(
+                    std::experimental::coroutine_handle<> consumer) const noexcept
+                {
+                    coro_.promise().consumer_ = consumer;
+                    return coro_;
+                }
+                void await_resume() const
+                {
+                    if(coro_ && coro_.done())
+                    {
+                        auto & e = coro_.promise().except_;
+                        if(e)
+                            std::rethrow_exception(std::move(e));
+                    }
+                }
+            };
+
+        public:
+            struct iterator
+            {
+                using value_type = Value;
+                using reference = Reference;
+                using difference_type = std::ptrdiff_t;
+
+                iterator() = default;
+                explicit iterator(handle coro) noexcept
+                  : coro_(coro)
+                {}
+                Reference operator*() const
+                {
+                    RANGES_EXPECT(coro_ && !coro_.done());
+                    return coro_.promise().read();
+                }
+
+            private:
+                struct increment_awaiter : advance_awaiter
+                {
+                    iterator * it_;
+
+                    explicit increment_awaiter(iterator & it) noexcept
+                      : advance_awaiter(it.coro_)
+                      , it_(detail::addressof(it))
+                    {}
+                    iterator & await_resume() const
+                    {
+                        advance_awaiter::await_resume();
+                        return *it_;
+                    }
+                };
+
+            public:
+                /// Awaitable; resumes the producer for the next value.
+                increment_awaiter operator++() noexcept
+                {
+                    RANGES_EXPECT(coro_ && !coro_.done());
+                    return increment_awaiter{*this};
+                }
+                friend bool operator==(iterator const & it, default_sentinel_t) noexcept
+                {
+                    return !it.coro_ || it.coro_.done();
+                }
+                friend bool operator==(default_sentinel_t, iterator const & it) noexcept
+                {
+                    return it == default_sentinel;
+                }
+                friend bool operator!=(iterator const & it, default_sentinel_t) noexcept
+                {
+                    return !(it == default_sentinel);
+                }
+                friend bool operator!=(default_sentinel_t, iterator const & it) noexcept
+                {
+                    return !(it == default_sentinel);
+                }
+
+            private:
+                handle coro_ = nullptr;
+            };
+
+            async_generator() = default;
+            async_generator(promise_type * p) noexcept
+              : coro_{handle::from_promise(*p)}
+            {}
+            async_generator(async_generator && that) noexcept
+              : coro_{ranges::exchange(that.coro_, nullptr)}
+            {}
+            async_generator & operator=(async_generator && that) noexcept
+            {
+                ranges::swap(coro_, that.coro_);
+                return *this;
+            }
+            ~async_generator()
+            {
+                if(coro_)
+                    coro_.destroy();
+            }
+
+        private:
+            struct begin_awaiter : advance_awaiter
+            {
+                using advance_awaiter::advance_awaiter;
+                iterator await_resume() const
+                {
+                    advance_awaiter::await_resume();
+                    return iterator{this->coro_};
+                }
+            };
+
+        public:
+            /// Awaitable; starts the producer and yields an iterator to its
+            /// first value. Call it once.
+            begin_awaiter begin() noexcept
+            {
+                return begin_awaiter{coro_};
+            }
+            default_sentinel_t end() const noexcept
+            {
+                return {};
+            }
+        };
+    } // namespace experimental
+    /// @}
+} // namespace ranges
+#endif // RANGES_CXX_COROUTINES >= RANGES_CXX_COROUTINES_TS1
+
+#endif // RANGES_V3_EXPERIMENTAL_UTILITY_ASYNC_GENERATOR_HPP
@@ -0,0 +1,264 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXPERIMENTAL_UTILITY_EVENT_LOOP_HPP
+#define RANGES_V3_EXPERIMENTAL_UTILITY_EVENT_LOOP_HPP
+
+#include <range/v3/detail/config.hpp>
+#if RANGES_CXX_COROUTINES >= RANGES_CXX_COROUTINES_TS1
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <experimental/coroutine>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/experimental/utility/task.hpp>
+#include <range/v3/utility/swap.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-view
+    /// @{
+
+    /// \cond
+    namespace detail
+    {
+        // The coroutine event_loop::run uses to start a task and to be resumed
+        // when it finishes. It suspends at the end so that the loop can
+        // destroy it.
+        struct event_loop_driver
+        {
+            struct promise_type
+            {
+                event_loop_driver get_return_object() noexcept
+                {
+                    return event_loop_driver{handle::from_promise(*this)};
+                }
+                std::experimental::suspend_always initial_suspend() const noexcept
+                {
+                    return {};
+                }
+                std::experimental::suspend_always final_suspend() const noexcept
+                {
+                    return {};
+                }
+                void return_void() const noexcept
+                {}
+                void unhandled_exception() const noexcept
+                {
+                    // Only awaits task::when_ready, which does not throw.
+                    std::terminate();
+                }
+            };
+            using handle = std::experimental::coroutine_handle<promise_type>;
+
+            explicit event_loop_driver(handle coro) noexcept
+              : coro_(coro)
+            {}
+            event_loop_driver(event_loop_driver && that) noexcept
+              : coro_(ranges::exchange(that.coro_, nullptr))
+            {}
+            event_loop_driver & operator=(event_loop_driver && that) noexcept
+            {
+                ranges::swap(coro_, that.coro_);
+                return *this;
+            }
+            ~event_loop_driver()
+            {
+                if(coro_)
+                    coro_.destroy();
+            }
+
+            template<typename Awaitable>
+            static event_loop_driver drive(Awaitable a)
+            {
+                co_await std::move(a);
+            }
+
+            handle coro_;
+        };
+    } // namespace detail
+    /// \endcond
+
+    namespace experimental
+    {
+        /// A single-threaded scheduler for coroutines, with a virtual clock.
+        /// Coroutines co_await `schedule()` to go to the back of the queue of
+        /// ready coroutines, or `delay(n)` to sleep for \c n ticks; `spawn`
+        /// starts a task that runs alongside the others. `run` resumes ready
+        /// coroutines in order until none are left, and then moves the clock
+        /// to the earliest sleeper rather than waiting, so a test can simulate
+        /// slow producers, such as files or sockets, with thousands of
+        /// concurrent streams on one thread and get the same interleaving
+        /// every time.
+        ///
+        /// The loop does not own the coroutines it holds. Do not destroy a
+        /// task or async_generator while it is waiting on the loop.
+        class event_loop
+        {
+            struct sleeper
+            {
+                std::size_t due_;
+                std::size_t seq_;
+                std::experimental::coroutine_handle<> coro_;
+
+                // For a min-heap, in order of waking.
+                friend bool operator<(sleeper const & x, sleeper const & y) noexcept
+                {
+                    return x.due_ != y.due_ ? x.due_ > y.due_ : x.seq_ > y.seq_;
+                }
+            };
+
+            struct spawned
+            {
+                task<> task_;
+                detail::event_loop_driver driver_;
+            };
+
+            std::deque<std::experimental::coroutine_handle<>> ready_;
+            std::vector<sleeper> sleepers_;
+            std::vector<spawned> spawned_;
+            std::size_t now_ = 0;
+            std::size_t seq_ = 0;
+
+            void sleep_(std::experimental::coroutine_handle<> coro, std::size_t ticks)
+            {
+                sleepers_.push_back({now_ + ticks, seq_++, coro});
+                std::push_heap(sleepers_.begin(), sleepers_.end());
+            }
+
+            void reap_()
+            {
+                std::exception_ptr except = nullptr;
+                auto const done = std::partition(
+                    spawned_.begin(), spawned_.end(),
+                    [](spawned const & s) { return !s.task_.is_ready(); });
+                for(auto it = done; it != spawned_.end(); ++it)
+                {
+                    if(!except)
+                        except = it->task_.coro_.promise().except_;
+                }
+                spawned_.erase(done, spawned_.end());
+                if(except)
+                    std::rethrow_exception(except);
+            }
+
+        public:
+            struct schedule_awaiter
+            {
+                event_loop * loop_;
+
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+                void await_suspend(std::experimental::coroutine_handle<> coro) const
+                {
+                    loop_->ready_.push_back(coro);
+                }
+                void await_resume() const noexcept
+                {}
+            };
+            struct delay_awaiter
+            {
+                event_loop * loop_;
+                std::size_t ticks_;
+
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+                void await_suspend(std::experimental::coroutine_handle<> coro) const
+                {
+                    loop_->sleep_(coro, ticks_);
+                }
+                void await_resume() const noexcept
+                {}
+            };
+
+            event_loop() = default;
+            event_loop(event_loop const &) = delete;
+            event_loop & operator=(event_loop const &) = delete;
+
+            /// Awaitable; resumes the awaiting coroutine after the coroutines
+            /// that are already ready.
+            schedule_awaiter schedule() noexcept
+            {
+                return {this};
+            }
+            /// Awaitable; resumes the awaiting coroutine once the clock has
+            /// advanced by \c ticks and no coroutine is ready.
+            delay_awaiter delay(std::size_t ticks) noexcept
+            {
+                return {this, ticks};
+            }
+            /// The virtual time, in ticks since the loop was made.
+            std::size_t now() const noexcept
+            {
+                return now_;
+            }
+            /// Starts \c t, which then runs alongside the other coroutines.
+            void spawn(task<> t)
+            {
+                auto driver = detail::event_loop_driver::drive(t.when_ready());
+                ready_.push_back(driver.coro_);
+                spawned_.push_back({std::move(t), std::move(driver)});
+            }
+            /// Resumes coroutines until none is ready or sleeping. Then
+            /// releases the spawned tasks that have finished and rethrows the
+            /// first exception one of them threw.
+            void run()
+            {
+                for(;;)
+                {
+                    if(ready_.empty())
+                    {
+                        if(sleepers_.empty())
+                            return reap_();
+                        now_ = sleepers_.front().due_;
+                        while(!sleepers_.empty() && sleepers_.front().due_ == now_)
+                        {
+                            std::pop_heap(sleepers_.begin(), sleepers_.end());
+                            ready_.push_back(sleepers_.back().coro_);
+                            sleepers_.pop_back();
+                        }
+                    }
+                    auto const coro = ready_.front();
+                    ready_.pop_front();
+                    coro.resume();
+                }
+            }
+            /// Starts \c t, runs the loop until no coroutine is ready or
+            /// sleeping, and returns the result of \c t or rethrows what it
+            /// threw. \pre \c t finishes by then.
+            template<typename T>
+            T run(task<T> t)
+            {
+                auto driver = detail::event_loop_driver::drive(t.when_ready());
+                ready_.push_back(driver.coro_);
+                run();
+                RANGES_ENSURE_MSG(t.is_ready(),
+                                  "event_loop::run: the task is waiting on something "
+                                  "that will never resume it");
+                return t.result();
+            }
+        };
+    } // namespace experimental
+    /// @}
+} // namespace ranges
+#endif // RANGES_CXX_COROUTINES >= RANGES_CXX_COROUTINES_TS1
+
+#endif // RANGES_V3_EXPERIMENTAL_UTILITY_EVENT_LOOP_HPP
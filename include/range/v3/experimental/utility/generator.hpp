@@ -19,6 +19,9 @@
 #include <cstddef>
 #include <exception>
 #include <experimental/coroutine>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 #include <meta/meta.hpp>
@@ -34,6 +37,7 @@
 #include <range/v3/utility/swap.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/facade.hpp>
+#include <range/v3/view/span.hpp>
 
 #if defined(_MSC_VER) && !defined(RANGES_SILENCE_COROUTINE_WARNING)
 #ifdef __clang__
@@ -87,6 +91,207 @@ namespace ranges
             coro.resume();
         }
 
+        // Every coroutine frame is followed by a trailer that says how to free
+        // it, so that frames from the pool and frames from user allocators can
+        // share the promise's one operator delete.
+        struct coroutine_frame_trailer
+        {
+            void (*deallocate_)(void * frame, std::size_t size);
+        };
+
+        struct alignas(std::max_align_t) coroutine_frame_unit
+        {
+            unsigned char bytes_[alignof(std::max_align_t)];
+        };
+
+        inline constexpr std::size_t coroutine_frame_offset(std::size_t size) noexcept
+        {
+            return (size + sizeof(coroutine_frame_unit) - 1) /
+                   sizeof(coroutine_frame_unit) * sizeof(coroutine_frame_unit);
+        }
+
+        inline coroutine_frame_trailer * coroutine_frame_trailer_of(
+            void * frame, std::size_t size) noexcept
+        {
+            return static_cast<coroutine_frame_trailer *>(static_cast<void *>(
+                static_cast<unsigned char *>(frame) + coroutine_frame_offset(size)));
+        }
+
+        // A thread-local cache of freed frames, in size classes of 64 bytes up
+        // to 2KB. A generator that is created and destroyed in a loop reuses
+        // the same block instead of going to the global heap each time. The
+        // pool is trivially destructible so that frames freed late in thread
+        // exit still find it; a separate object returns the cached blocks
+        // to the heap and closes it.
+        struct coroutine_frame_pool
+        {
+            static constexpr std::size_t granularity = 64;
+            static constexpr std::size_t classes = 32;
+            static constexpr unsigned max_cached = 16;
+
+            static coroutine_frame_pool & get() noexcept
+            {
+                static thread_local coroutine_frame_pool pool;
+                return pool;
+            }
+            void * allocate(std::size_t bytes)
+            {
+                std::size_t const c = (bytes - 1) / granularity;
+                if(c >= classes)
+                    return ::operator new(bytes);
+                if(block * const b = free_[c])
+                {
+                    free_[c] = b->next_;
+                    --cached_[c];
+                    return b;
+                }
+                return ::operator new((c + 1) * granularity);
+            }
+            void deallocate(void * p, std::size_t bytes) noexcept
+            {
+                std::size_t const c = (bytes - 1) / granularity;
+                if(c >= classes || cached_[c] == max_cached || closed_)
+                    return ::operator delete(p);
+                static thread_local drain const d{};
+                (void)d;
+                free_[c] = ::new(p) block{free_[c]};
+                ++cached_[c];
+            }
+
+        private:
+            struct block
+            {
+                block * next_;
+            };
+            struct drain
+            {
+                ~drain()
+                {
+                    auto & pool = coroutine_frame_pool::get();
+                    pool.closed_ = true;
+                    for(std::size_t c = 0; c < classes; ++c)
+                    {
+                        while(block * const b = pool.free_[c])
+                        {
+                            pool.free_[c] = b->next_;
+                            ::operator delete(b);
+                        }
+                        pool.cached_[c] = 0;
+                    }
+                }
+            };
+
+            block * free_[classes];
+            unsigned char cached_[classes];
+            bool closed_;
+        };
+
+        inline std::size_t coroutine_frame_pool_bytes(std::size_t size) noexcept
+        {
+            return coroutine_frame_offset(size) + sizeof(coroutine_frame_trailer);
+        }
+
+        inline void coroutine_frame_pool_deallocate(void * frame, std::size_t size)
+        {
+            coroutine_frame_pool::get().deallocate(frame,
+                                                   coroutine_frame_pool_bytes(size));
+        }
+
+        // Frames allocated with a user's allocator keep a copy of it, rebound
+        // to coroutine_frame_unit, in the trailer.
+        template<typename Alloc>
+        struct coroutine_frame_allocator
+        {
+            using unit_alloc = typename std::allocator_traits<
+                Alloc>::template rebind_alloc<coroutine_frame_unit>;
+            using traits = std::allocator_traits<unit_alloc>;
+            CPP_assert(std::is_pointer<typename traits::pointer>::value);
+
+            struct trailer : coroutine_frame_trailer
+            {
+                unit_alloc alloc_;
+
+                explicit trailer(unit_alloc alloc) noexcept
+                  : coroutine_frame_trailer{&coroutine_frame_allocator::deallocate}
+                  , alloc_(std::move(alloc))
+                {}
+            };
+            static_assert(alignof(trailer) <= sizeof(coroutine_frame_unit),
+                          "Over-aligned allocators cannot allocate coroutine frames");
+
+            static std::size_t units(std::size_t size) noexcept
+            {
+                return (coroutine_frame_offset(size) + sizeof(trailer) +
+                        sizeof(coroutine_frame_unit) - 1) /
+                       sizeof(coroutine_frame_unit);
+            }
+            static void * allocate(Alloc const & a, std::size_t size)
+            {
+                unit_alloc alloc(a);
+                void * const frame = traits::allocate(alloc, units(size));
+                ::new(coroutine_frame_trailer_of(frame, size)) trailer{std::move(alloc)};
+                return frame;
+            }
+            static void deallocate(void * frame, std::size_t size)
+            {
+                auto & t =
+                    static_cast<trailer &>(*coroutine_frame_trailer_of(frame, size));
+                unit_alloc alloc(std::move(t.alloc_));
+                t.~trailer();
+                traits::deallocate(
+                    alloc, static_cast<coroutine_frame_unit *>(frame), units(size));
+            }
+        };
+
+        // A base for promise types that allocates coroutine frames from the
+        // thread's frame pool, or with the allocator that follows a
+        // std::allocator_arg among the coroutine's leading parameters.
+        struct coroutine_frame_allocation
+        {
+            static void * operator new(std::size_t size)
+            {
+                void * const frame = coroutine_frame_pool::get().allocate(
+                    coroutine_frame_pool_bytes(size));
+                ::new(coroutine_frame_trailer_of(frame, size))
+                    coroutine_frame_trailer{&coroutine_frame_pool_deallocate};
+                return frame;
+            }
+            template<typename Alloc, typename... Args>
+            static void * operator new(std::size_t size, std::allocator_arg_t,
+                                       Alloc const & alloc, Args const &...)
+            {
+                return coroutine_frame_allocator<Alloc>::allocate(alloc, size);
+            }
+            // For member function coroutines, whose first parameter is *this.
+            template<typename This, typename Alloc, typename... Args>
+            static void * operator new(std::size_t size, This const &,
+                                       std::allocator_arg_t, Alloc const & alloc,
+                                       Args const &...)
+            {
+                return coroutine_frame_allocator<Alloc>::allocate(alloc, size);
+            }
+            static void operator delete(void * frame, std::size_t size) noexcept
+            {
+                coroutine_frame_trailer_of(frame, size)->deallocate_(frame, size);
+            }
+        };
+
+        // The awaitable returned for a co_yield of a block. Yielding an empty
+        // block does not suspend.
+        struct generator_block_awaiter
+        {
+            bool empty_;
+
+            bool await_ready() const noexcept
+            {
+                return empty_;
+            }
+            void await_suspend(std::experimental::coroutine_handle<>) const noexcept
+            {}
+            void await_resume() const noexcept
+            {}
+        };
+
         namespace coroutine_owner_
         {
             struct adl_hook
@@ -169,7 +374,7 @@ namespace ranges
             }
 
         private:
-            std::atomic<bool> copied_{false};
+            mutable std::atomic<bool> copied_{false};
 
             base_t & base() noexcept
             {
@@ -182,9 +387,20 @@ namespace ranges
     namespace detail
     {
         template<typename Reference>
-        struct generator_promise : experimental::enable_coroutine_owner
+        struct generator_promise
+          : experimental::enable_coroutine_owner
+          , coroutine_frame_allocation
         {
+            // The elements of a block yielded with co_yield span.
+            using block_element_t = meta::if_<std::is_reference<Reference>,
+                                              meta::_t<std::remove_reference<Reference>>,
+                                              Reference const>;
+
             std::exception_ptr except_ = nullptr;
+            // The block the coroutine is suspended on, or two nulls when it is
+            // suspended on a single value.
+            block_element_t * block_first_ = nullptr;
+            block_element_t * block_last_ = nullptr;
 
             CPP_assert(std::is_reference<Reference>::value ||
                        CopyConstructible<Reference>);
@@ -197,8 +413,9 @@ namespace ranges
             {
                 return {};
             }
-            std::experimental::suspend_always final_suspend() const noexcept
+            std::experimental::suspend_always final_suspend() noexcept
             {
+                block_first_ = block_last_ = nullptr;
                 return {};
             }
             void return_void() const noexcept
@@ -215,9 +432,24 @@ namespace ranges
                     requires ConvertibleTo<Arg, Reference> &&
                         std::is_assignable<semiregular_t<Reference> &, Arg>::value)
             {
+                block_first_ = block_last_ = nullptr;
                 ref_ = std::forward<Arg>(arg);
                 return {};
             }
+            // co_yield of a span hands the whole block to the consumer, which
+            // walks it without resuming the coroutine until it reaches the end.
+            // The elements must stay alive until then, as for any co_yield of a
+            // reference.
+            template<typename U, span_index_t N>
+            auto yield_value(span<U, N> block) noexcept
+                -> CPP_ret(generator_block_awaiter)( //
+                    requires ConvertibleTo<U (*)[], block_element_t (*)[]> &&
+                    (!ConvertibleTo<span<U, N>, Reference>))
+            {
+                block_first_ = block.data();
+                block_last_ = block_first_ + block.size();
+                return {block_first_ == block_last_};
+            }
             std::experimental::suspend_never await_transform(
                 experimental::generator_size) const noexcept
             {
@@ -295,11 +527,15 @@ namespace ranges
                 using value_type = Value;
 
                 cursor() = default;
-                constexpr explicit cursor(handle coro) noexcept
+                explicit cursor(handle coro) noexcept
                   : coro_{coro}
-                {}
+                {
+                    load_();
+                }
                 bool equal(default_sentinel_t) const
                 {
+                    if(pos_ != last_)
+                        return false;
                     RANGES_EXPECT(coro_);
                     if(coro_.done())
                     {
@@ -312,16 +548,31 @@ namespace ranges
                 }
                 void next()
                 {
+                    if(pos_ != last_ && ++pos_ != last_)
+                        return;
                     detail::resume(coro_);
+                    load_();
                 }
                 Reference read() const
                 {
                     RANGES_EXPECT(coro_);
+                    if(pos_ != last_)
+                        return static_cast<Reference>(*pos_);
                     return coro_.promise().read();
                 }
 
             private:
+                using block_element_t = typename promise_type::block_element_t;
+
                 handle coro_ = nullptr;
+                block_element_t * pos_ = nullptr;
+                block_element_t * last_ = nullptr;
+
+                void load_() noexcept
+                {
+                    pos_ = coro_.promise().block_first_;
+                    last_ = coro_.promise().block_last_;
+                }
             };
 
             cursor begin_cursor()
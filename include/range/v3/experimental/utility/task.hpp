@@ -0,0 +1,250 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXPERIMENTAL_UTILITY_TASK_HPP
+#define RANGES_V3_EXPERIMENTAL_UTILITY_TASK_HPP
+
+#include <range/v3/detail/config.hpp>
+#if RANGES_CXX_COROUTINES >= RANGES_CXX_COROUTINES_TS1
+#include <exception>
+#include <experimental/coroutine>
+#include <utility>
+
+#include <meta/meta.hpp>
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/experimental/utility/generator.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/swap.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-view
+    /// @{
+    namespace experimental
+    {
+        template<typename T = void>
+        struct task;
+
+        class event_loop;
+    } // namespace experimental
+
+    /// \cond
+    namespace detail
+    {
+        // The parts of a task's promise that do not depend on its result. A
+        // finished task transfers control to the coroutine waiting on it, which
+        // always exists: either a coroutine that co_awaited the task, or the
+        // one event_loop::run uses to drive it.
+        struct task_promise_base : coroutine_frame_allocation
+        {
+            struct final_awaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+                template<typename Promise>
+                std::experimental::coroutine_handle<> await_suspend(
+                    std::experimental::coroutine_handle<Promise> coro) const noexcept
+                {
+                    return coro.promise().continuation_;
+                }
+                void await_resume() const noexcept
+                {}
+            };
+
+            std::experimental::coroutine_handle<> continuation_ = nullptr;
+            std::exception_ptr except_ = nullptr;
+
+            std::experimental::suspend_always initial_suspend() const noexcept
+            {
+                return {};
+            }
+            final_awaiter final_suspend() const noexcept
+            {
+                return {};
+            }
+            void unhandled_exception() noexcept
+            {
+                except_ = std::current_exception();
+                RANGES_EXPECT(except_);
+            }
+            void rethrow_if_exception()
+            {
+                if(except_)
+                    std::rethrow_exception(std::move(except_));
+            }
+        };
+
+        template<typename T>
+        struct task_promise : task_promise_base
+        {
+            task_promise * get_return_object() noexcept
+            {
+                return this;
+            }
+            template<typename U>
+            auto return_value(U && u) -> CPP_ret(void)( //
+                requires ConvertibleTo<U, T>)
+            {
+                value_.emplace(static_cast<U &&>(u));
+            }
+            T result()
+            {
+                rethrow_if_exception();
+                RANGES_EXPECT(value_);
+                return std::move(*value_);
+            }
+
+        private:
+            optional<T> value_;
+        };
+
+        template<typename T>
+        struct task_promise<T &> : task_promise_base
+        {
+            task_promise * get_return_object() noexcept
+            {
+                return this;
+            }
+            void return_value(T & t) noexcept
+            {
+                value_ = detail::addressof(t);
+            }
+            T & result()
+            {
+                rethrow_if_exception();
+                RANGES_EXPECT(value_);
+                return *value_;
+            }
+
+        private:
+            T * value_ = nullptr;
+        };
+
+        template<>
+        struct task_promise<void> : task_promise_base
+        {
+            task_promise * get_return_object() noexcept
+            {
+                return this;
+            }
+            void return_void() const noexcept
+            {}
+            void result()
+            {
+                rethrow_if_exception();
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    namespace experimental
+    {
+        /// A lazily started coroutine that produces one \c T, or throws. A
+        /// task runs when it is co_awaited, as an rvalue and at most once, from
+        /// another coroutine, or when it is handed to `event_loop::run`. When
+        /// it finishes, the coroutine that awaited it resumes without growing
+        /// the stack.
+        template<typename T>
+        struct task
+        {
+            using promise_type = detail::task_promise<T>;
+
+            task() = default;
+            task(promise_type * p) noexcept
+              : coro_{handle::from_promise(*p)}
+            {}
+            task(task && that) noexcept
+              : coro_{ranges::exchange(that.coro_, nullptr)}
+            {}
+            task & operator=(task && that) noexcept
+            {
+                ranges::swap(coro_, that.coro_);
+                return *this;
+            }
+            ~task()
+            {
+                if(coro_)
+                    coro_.destroy();
+            }
+
+            /// Whether the task has run to completion.
+            bool is_ready() const noexcept
+            {
+                return !coro_ || coro_.done();
+            }
+
+        private:
+            friend event_loop;
+            using handle = std::experimental::coroutine_handle<promise_type>;
+            handle coro_ = nullptr;
+
+            struct ready_awaiter
+            {
+                handle coro_;
+
+                explicit ready_awaiter(handle coro) noexcept
+                  : coro_(coro)
+                {}
+                bool await_ready() const noexcept
+                {
+                    return coro_.done();
+                }
+                std::experimental::coroutine_handle<> await_suspend(
+                    std::experimental::coroutine_handle<> waiter) const noexcept
+                {
+                    coro_.promise().continuation_ = waiter;
+                    return coro_;
+                }
+                void await_resume() const noexcept
+                {}
+            };
+            struct result_awaiter : ready_awaiter
+            {
+                using ready_awaiter::ready_awaiter;
+                T await_resume() const
+                {
+                    return this->coro_.promise().result();
+                }
+            };
+
+            // Runs the task without taking its result, for event_loop.
+            ready_awaiter when_ready() const noexcept
+            {
+                RANGES_EXPECT(coro_);
+                return ready_awaiter{coro_};
+            }
+            T result()
+            {
+                RANGES_EXPECT(is_ready());
+                return coro_.promise().result();
+            }
+
+        public:
+            result_awaiter operator co_await() && noexcept
+            {
+                RANGES_EXPECT(coro_);
+                return result_awaiter{coro_};
+            }
+        };
+    } // namespace experimental
+    /// @}
+} // namespace ranges
+#endif // RANGES_CXX_COROUTINES >= RANGES_CXX_COROUTINES_TS1
+
+#endif // RANGES_V3_EXPERIMENTAL_UTILITY_TASK_HPP
@@ -30,6 +30,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/functional/on.hpp>
 #include <range/v3/functional/overload.hpp>
 #include <range/v3/functional/pipeable.hpp>
+#include <range/v3/functional/pred.hpp>
 #include <range/v3/functional/reference_wrapper.hpp>
 
 RANGES_RE_ENABLE_WARNINGS
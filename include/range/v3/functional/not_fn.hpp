@@ -47,6 +47,14 @@ namespace ranges
           : pred_(static_cast<T &&>(pred))
         {}
 
+        /// \cond
+        // The predicate negated, for algorithms that recognize it.
+        constexpr FD const & negated_() const noexcept
+        {
+            return pred_;
+        }
+        /// \endcond
+
         template<typename... Args>
         constexpr auto operator()(Args &&... args) & -> CPP_ret(bool)( //
             requires Predicate<FD &, Args...>)
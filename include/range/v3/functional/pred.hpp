@@ -0,0 +1,107 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_FUNCTIONAL_PRED_HPP
+#define RANGES_V3_FUNCTIONAL_PRED_HPP
+
+#include <concepts/concepts.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-functional
+    /// @{
+
+    /// Unary predicates that compare their argument with fixed bounds, like
+    /// `pred::lt(10)` or `pred::between(lo, hi)`. They behave like the
+    /// equivalent lambdas, but `remove_if`, `copy_if` and `view::remove_if`
+    /// recognize them, and their negations by `not_fn` or `view::filter`,
+    /// and test many elements of a contiguous range of integers or
+    /// floating-point numbers at once.
+    namespace pred
+    {
+        /// A predicate true of \c u when `Cmp{}(u, bound)` is.
+        template<typename Cmp, typename T>
+        struct compare_with
+        {
+            T bound;
+
+            template<typename U>
+            constexpr auto operator()(U const & u) const -> CPP_ret(bool)( //
+                requires Predicate<Cmp const &, U const &, T const &>)
+            {
+                return Cmp{}(u, bound);
+            }
+        };
+
+        /// A predicate true of \c u when `lo <= u && u <= hi`, where \c <= is
+        /// `ranges::less_equal`.
+        template<typename T>
+        struct within
+        {
+            T lo;
+            T hi;
+
+            template<typename U>
+            constexpr auto operator()(U const & u) const -> CPP_ret(bool)( //
+                requires StrictTotallyOrderedWith<U const &, T const &>)
+            {
+                return less_equal{}(lo, u) && less_equal{}(u, hi);
+            }
+        };
+
+        template<typename Cmp>
+        struct compare_fn
+        {
+            template<typename T>
+            constexpr auto operator()(T bound) const
+                -> CPP_ret(compare_with<Cmp, T>)( //
+                    requires CopyConstructible<T>)
+            {
+                return {static_cast<T &&>(bound)};
+            }
+        };
+
+        struct between_fn
+        {
+            template<typename T>
+            constexpr auto operator()(T lo, T hi) const -> CPP_ret(within<T>)( //
+                requires StrictTotallyOrdered<T>)
+            {
+                return {static_cast<T &&>(lo), static_cast<T &&>(hi)};
+            }
+        };
+
+        /// \sa `compare_with`
+        RANGES_INLINE_VARIABLE(compare_fn<less>, lt)
+        /// \sa `compare_with`
+        RANGES_INLINE_VARIABLE(compare_fn<less_equal>, le)
+        /// \sa `compare_with`
+        RANGES_INLINE_VARIABLE(compare_fn<greater>, gt)
+        /// \sa `compare_with`
+        RANGES_INLINE_VARIABLE(compare_fn<greater_equal>, ge)
+        /// \sa `compare_with`
+        RANGES_INLINE_VARIABLE(compare_fn<equal_to>, eq)
+        /// \sa `compare_with`
+        RANGES_INLINE_VARIABLE(compare_fn<not_equal_to>, ne)
+        /// \sa `within`
+        RANGES_INLINE_VARIABLE(between_fn, between)
+    } // namespace pred
+    /// @}
+} // namespace ranges
+
+#endif
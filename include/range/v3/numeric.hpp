@@ -13,6 +13,9 @@
 
 #include <range/v3/numeric/accumulate.hpp>
 #include <range/v3/numeric/adjacent_difference.hpp>
+#include <range/v3/numeric/exclusive_scan.hpp>
+#include <range/v3/numeric/group_aggregate.hpp>
+#include <range/v3/numeric/inclusive_scan.hpp>
 #include <range/v3/numeric/inner_product.hpp>
 #include <range/v3/numeric/iota.hpp>
 #include <range/v3/numeric/partial_sum.hpp>
@@ -0,0 +1,237 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_EXCLUSIVE_SCAN_HPP
+#define RANGES_V3_NUMERIC_EXCLUSIVE_SCAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/functional/arithmetic.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/numeric/inclusive_scan.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-numerics
+    /// @{
+    // clang-format off
+    CPP_def
+    (
+        template(typename I, typename O, typename T, typename BOp = plus,
+            typename P = identity)
+        (concept ExclusiveScannable)(I, O, T, BOp, P),
+            InputIterator<I> &&
+            Copyable<T> &&
+            IndirectBinaryInvocable_<BOp, T *,
+                projected<projected<I, detail::as_value_type_t<I>>, P>> &&
+            Assignable<T &, indirect_result_t<BOp &, T *,
+                projected<projected<I, detail::as_value_type_t<I>>, P>>> &&
+            OutputIterator<O, T const &>
+    );
+    // clang-format on
+
+    /// \cond
+    namespace detail
+    {
+        template<typename I, typename O, typename T, typename BOp, typename P>
+        O exclusive_scan_carry_n_(I first, iter_difference_t<I> n, O out, BOp & bop,
+                                  P & proj, T & t, std::false_type)
+        {
+            coerce<iter_value_t<I>> val_i;
+            for(; n > 0; --n, ++first, ++out)
+            {
+                // Read *first before writing *out in case they alias.
+                auto && cur = val_i(*first);
+                T prev = t;
+                t = invoke(bop, t, invoke(proj, cur));
+                *out = prev;
+            }
+            return out;
+        }
+        template<typename I, typename O, typename T, typename BOp, typename P>
+        O exclusive_scan_carry_n_(I first, iter_difference_t<I> n, O out, BOp &, P &,
+                                  T & t, std::true_type)
+        {
+            t = detail::scan_plus_n_<true>(first, n, out, t);
+            return out + n;
+        }
+
+        template<typename I, typename O, typename T, typename BOp, typename P>
+        O parallel_exclusive_scan_n_(parallel_policy pol, I first, iter_difference_t<I> n,
+                                     O out, T init, BOp & bop, P & proj)
+        {
+            using X = scan_value_t<I, P>;
+            using D = iter_difference_t<I>;
+            using simd_t = meta::bool_<simd_scannable_<I, O, BOp, P>::value &&
+                                       Same<T, iter_value_t<I>>>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count = detail::parallel_block_count(pol, size, scan_grain);
+            if(count <= 1)
+                return detail::exclusive_scan_carry_n_(
+                    first, n, out, bop, proj, init, simd_t{});
+            std::vector<optional<X>> totals(count - 1);
+            detail::parallel_invoke_n(count - 1, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                totals[b].emplace(detail::scan_reduce_n_(first + static_cast<D>(bnd.first),
+                                                         static_cast<D>(bnd.second - bnd.first),
+                                                         bop,
+                                                         proj));
+            });
+            // carries[b] is the value the scan of block b starts from.
+            std::vector<T> carries;
+            carries.reserve(count);
+            carries.push_back(std::move(init));
+            for(std::size_t b = 1; b < count; ++b)
+            {
+                T t = carries.back();
+                t = invoke(bop, t, *totals[b - 1]);
+                carries.push_back(std::move(t));
+            }
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                auto const lo = static_cast<D>(bnd.first);
+                detail::exclusive_scan_carry_n_(first + lo,
+                                                static_cast<D>(bnd.second - bnd.first),
+                                                out + lo,
+                                                bop,
+                                                proj,
+                                                carries[b],
+                                                simd_t{});
+            });
+            return out + n;
+        }
+    } // namespace detail
+    /// \endcond
+
+    template<typename I, typename O>
+    using exclusive_scan_result = detail::in_out_result<I, O>;
+
+    /// Like \c inclusive_scan, except that the i-th output is the "sum" of
+    /// \c init and the first i-1 inputs, so the i-th input is excluded. The
+    /// \c parallel_policy overloads additionally require that \c bop can combine
+    /// two projected elements.
+    struct exclusive_scan_fn
+    {
+    private:
+        template<typename I, typename S, typename O, typename T, typename BOp,
+                 typename P>
+        static exclusive_scan_result<I, O> impl_(I first, S last, O out, T & init,
+                                                 BOp & bop, P & proj, std::true_type simd)
+        {
+            auto const n = last - first;
+            out = detail::exclusive_scan_carry_n_(first, n, out, bop, proj, init, simd);
+            return {first + n, out};
+        }
+        template<typename I, typename S, typename O, typename T, typename BOp,
+                 typename P>
+        static exclusive_scan_result<I, O> impl_(I first, S last, O out, T & init,
+                                                 BOp & bop, P & proj, std::false_type)
+        {
+            coerce<iter_value_t<I>> val_i;
+            for(; first != last; ++first, ++out)
+            {
+                auto && cur = val_i(*first);
+                T prev = init;
+                init = invoke(bop, init, invoke(proj, cur));
+                *out = prev;
+            }
+            return {first, out};
+        }
+
+    public:
+        template<typename I, typename S, typename O, typename T, typename BOp = plus,
+                 typename P = identity>
+        auto operator()(I first, S last, O out, T init, BOp bop = BOp{},
+                        P proj = P{}) const
+            -> CPP_ret(exclusive_scan_result<I, O>)( //
+                requires Sentinel<S, I> && ExclusiveScannable<I, O, T, BOp, P>)
+        {
+            using simd_t =
+                meta::bool_<SizedSentinel<S, I> &&
+                            detail::simd_scannable_<I, O, BOp, P>::value &&
+                            Same<T, iter_value_t<I>>>;
+            return exclusive_scan_fn::impl_(
+                std::move(first), std::move(last), std::move(out), init, bop, proj,
+                simd_t{});
+        }
+
+        template<typename Rng, typename O, typename T, typename BOp = plus,
+                 typename P = identity, typename I = iterator_t<Rng>>
+        auto operator()(Rng && rng, O out, T init, BOp bop = BOp{}, P proj = P{}) const
+            -> CPP_ret(exclusive_scan_result<safe_iterator_t<Rng>, O>)( //
+                requires Range<Rng> && ExclusiveScannable<I, O, T, BOp, P>)
+        {
+            return (*this)(begin(rng),
+                           end(rng),
+                           std::move(out),
+                           std::move(init),
+                           std::move(bop),
+                           std::move(proj));
+        }
+
+        template<typename I, typename S, typename O, typename T, typename BOp = plus,
+                 typename P = identity>
+        auto operator()(parallel_policy pol, I first, S last, O out, T init,
+                        BOp bop = BOp{}, P proj = P{}) const
+            -> CPP_ret(exclusive_scan_result<I, O>)( //
+                requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                    RandomAccessIterator<O> && ExclusiveScannable<I, O, T, BOp, P> &&
+                    IndirectSemigroup<
+                        projected<projected<I, detail::as_value_type_t<I>>, P>, BOp>)
+        {
+            auto const n = last - first;
+            out = detail::parallel_exclusive_scan_n_(
+                pol, first, n, out, std::move(init), bop, proj);
+            return {first + n, out};
+        }
+
+        template<typename Rng, typename O, typename T, typename BOp = plus,
+                 typename P = identity, typename I = iterator_t<Rng>>
+        auto operator()(parallel_policy pol, Rng && rng, O out, T init, BOp bop = BOp{},
+                        P proj = P{}) const
+            -> CPP_ret(exclusive_scan_result<safe_iterator_t<Rng>, O>)( //
+                requires RandomAccessRange<Rng> && SizedSentinel<sentinel_t<Rng>, I> &&
+                    RandomAccessIterator<O> && ExclusiveScannable<I, O, T, BOp, P> &&
+                    IndirectSemigroup<
+                        projected<projected<I, detail::as_value_type_t<I>>, P>, BOp>)
+        {
+            return (*this)(pol,
+                           begin(rng),
+                           end(rng),
+                           std::move(out),
+                           std::move(init),
+                           std::move(bop),
+                           std::move(proj));
+        }
+    };
+
+    /// \sa `exclusive_scan_fn`
+    RANGES_INLINE_VARIABLE(exclusive_scan_fn, exclusive_scan)
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,212 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_GROUP_AGGREGATE_HPP
+#define RANGES_V3_NUMERIC_GROUP_AGGREGATE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/detail/flat_hash.hpp>
+#include <range/v3/functional/arithmetic.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-numerics
+    /// @{
+
+    /// The groups `group_aggregate` returns: the key of each group and the
+    /// result of folding its elements, in the order the keys first appear.
+    template<typename I, typename Key, typename T>
+    using group_aggregate_result_t =
+        std::vector<std::pair<detail::decay_t<indirect_result_t<Key &, I>>, T>>;
+
+    /// Like `accumulate` on each group of the elements that have equal keys
+    /// by \c key, whether or not they are adjacent, so that unsorted input
+    /// needs no sort first: each group starts from \c init, and each of its
+    /// elements \c x folds in as `acc = op(acc, proj(x))`. The groups are
+    /// found with an open-addressing hash table of the keys, using
+    /// `std::hash` and \c ==, and the elements are read once, in order.
+    ///
+    /// The overloads taking a \c parallel_policy require random-access
+    /// iterators. Each thread aggregates a block of the sequence into a table
+    /// of its own, and then the calling thread merges the tables in block
+    /// order, folding the partial results of a key together with
+    /// `op(acc, acc)`. So \c op must also take two accumulators, like \c plus
+    /// or \c max, and be associative, and \c init must be its identity; then
+    /// the result is that of the sequential algorithm. To count the elements
+    /// of each group, say, use \c plus with a projection that returns 1. The
+    /// merge takes time in the number of keys per block, so it is cheap when
+    /// there are many fewer keys than elements.
+    struct group_aggregate_fn
+    {
+    private:
+        template<typename I, typename S, typename K, typename Key, typename T,
+                 typename Op, typename P>
+        static void fold_(I begin, S end, detail::flat_hash_index<K> & index,
+                          std::vector<T> & accs, Key & key, T const & init, Op & op,
+                          P & proj)
+        {
+            for(; begin != end; ++begin)
+            {
+                std::size_t const i = index.insert(invoke(key, *begin)).first;
+                if(i == accs.size())
+                    accs.push_back(init);
+                accs[i] = invoke(op, accs[i], invoke(proj, *begin));
+            }
+        }
+        template<typename K, typename T>
+        static std::vector<std::pair<K, T>> groups_(detail::flat_hash_index<K> & index,
+                                                    std::vector<T> & accs)
+        {
+            std::vector<std::pair<K, T>> groups;
+            groups.reserve(accs.size());
+            auto & keys = index.keys();
+            for(std::size_t i = 0; i < accs.size(); ++i)
+                groups.emplace_back(std::move(keys[i]), std::move(accs[i]));
+            return groups;
+        }
+        template<typename I, typename Key, typename T, typename Op, typename P>
+        static group_aggregate_result_t<I, Key, T> parallel_impl_(
+            parallel_policy pol, I begin, iter_difference_t<I> n, Key & key,
+            T const & init, Op & op, P & proj)
+        {
+            using D = iter_difference_t<I>;
+            using K = detail::decay_t<indirect_result_t<Key &, I>>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count =
+                detail::parallel_block_count(pol, size, detail::compact_grain);
+            std::vector<detail::flat_hash_index<K>> indices(count);
+            std::vector<std::vector<T>> accs(count);
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                group_aggregate_fn::fold_(begin + static_cast<D>(bnd.first),
+                                          begin + static_cast<D>(bnd.second),
+                                          indices[b],
+                                          accs[b],
+                                          key,
+                                          init,
+                                          op,
+                                          proj);
+            });
+            auto & index = indices[0];
+            auto & acc = accs[0];
+            for(std::size_t b = 1; b < count; ++b)
+            {
+                auto & keys = indices[b].keys();
+                for(std::size_t j = 0; j < keys.size(); ++j)
+                {
+                    std::size_t const i =
+                        index.insert(std::move(keys[j]), indices[b].hash(j)).first;
+                    if(i == acc.size())
+                        acc.push_back(std::move(accs[b][j]));
+                    else
+                        acc[i] = invoke(op, acc[i], accs[b][j]);
+                }
+                indices[b] = {};
+                accs[b] = {};
+            }
+            return group_aggregate_fn::groups_(index, acc);
+        }
+
+    public:
+        template<typename I, typename S, typename Key, typename T, typename Op = plus,
+                 typename P = identity>
+        auto operator()(I begin, S end, Key key, T init, Op op = Op{},
+                        P proj = P{}) const
+            -> CPP_ret(group_aggregate_result_t<I, Key, T>)( //
+                requires Sentinel<S, I> && Accumulateable<I, T, Op, P> &&
+                    IndirectUnaryInvocable<Key, I> &&
+                    CopyConstructible<detail::decay_t<indirect_result_t<Key &, I>>>)
+        {
+            detail::flat_hash_index<detail::decay_t<indirect_result_t<Key &, I>>> index;
+            std::vector<T> accs;
+            group_aggregate_fn::fold_(
+                std::move(begin), std::move(end), index, accs, key, init, op, proj);
+            return group_aggregate_fn::groups_(index, accs);
+        }
+
+        template<typename Rng, typename Key, typename T, typename Op = plus,
+                 typename P = identity>
+        auto operator()(Rng && rng, Key key, T init, Op op = Op{}, P proj = P{}) const
+            -> CPP_ret(group_aggregate_result_t<iterator_t<Rng>, Key, T>)( //
+                requires Range<Rng> && Accumulateable<iterator_t<Rng>, T, Op, P> &&
+                    IndirectUnaryInvocable<Key, iterator_t<Rng>> &&
+                    CopyConstructible<
+                        detail::decay_t<indirect_result_t<Key &, iterator_t<Rng>>>>)
+        {
+            return (*this)(begin(rng),
+                           end(rng),
+                           std::move(key),
+                           std::move(init),
+                           std::move(op),
+                           std::move(proj));
+        }
+
+        template<typename I, typename S, typename Key, typename T, typename Op = plus,
+                 typename P = identity>
+        auto operator()(parallel_policy pol, I begin, S end, Key key, T init,
+                        Op op = Op{}, P proj = P{}) const
+            -> CPP_ret(group_aggregate_result_t<I, Key, T>)( //
+                requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                    Accumulateable<I, T, Op, P> && IndirectUnaryInvocable<Key, I> &&
+                    CopyConstructible<detail::decay_t<indirect_result_t<Key &, I>>> &&
+                    Invocable<Op &, T &, T &> &&
+                    Assignable<T &, invoke_result_t<Op &, T &, T &>>)
+        {
+            return group_aggregate_fn::parallel_impl_(
+                pol, begin, end - begin, key, init, op, proj);
+        }
+
+        template<typename Rng, typename Key, typename T, typename Op = plus,
+                 typename P = identity>
+        auto operator()(parallel_policy pol, Rng && rng, Key key, T init, Op op = Op{},
+                        P proj = P{}) const
+            -> CPP_ret(group_aggregate_result_t<iterator_t<Rng>, Key, T>)( //
+                requires RandomAccessRange<Rng> &&
+                    SizedSentinel<sentinel_t<Rng>, iterator_t<Rng>> &&
+                    Accumulateable<iterator_t<Rng>, T, Op, P> &&
+                    IndirectUnaryInvocable<Key, iterator_t<Rng>> &&
+                    CopyConstructible<
+                        detail::decay_t<indirect_result_t<Key &, iterator_t<Rng>>>> &&
+                    Invocable<Op &, T &, T &> &&
+                    Assignable<T &, invoke_result_t<Op &, T &, T &>>)
+        {
+            return (*this)(pol,
+                           begin(rng),
+                           end(rng),
+                           std::move(key),
+                           std::move(init),
+                           std::move(op),
+                           std::move(proj));
+        }
+    };
+
+    /// \sa `group_aggregate_fn`
+    RANGES_INLINE_VARIABLE(group_aggregate_fn, group_aggregate)
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,373 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_INCLUSIVE_SCAN_HPP
+#define RANGES_V3_NUMERIC_INCLUSIVE_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/algorithm/result_types.hpp>
+#include <range/v3/functional/arithmetic.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/traits.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/dangling.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RANGES_SCAN_SSE2 1
+#endif
+
+namespace ranges
+{
+    /// \addtogroup group-numerics
+    /// @{
+
+    /// \cond
+    namespace detail
+    {
+        // Below this many elements per thread a parallel scan is not worth it.
+        constexpr std::size_t scan_grain = std::size_t{1} << 14;
+
+        template<typename I, typename P>
+        using scan_value_t = iter_value_t<projected<projected<I, as_value_type_t<I>>, P>>;
+
+        template<typename BOp>
+        struct is_plus_ : std::false_type
+        {};
+        template<>
+        struct is_plus_<plus> : std::true_type
+        {};
+        template<>
+        struct is_plus_<std::plus<>> : std::true_type
+        {};
+
+        // Contiguous sequences of 32- and 64-bit integers summed with a plain
+        // `plus` can be scanned with the in-register kernel below.
+        template<typename I, typename O, typename BOp, typename P, typename = void>
+        struct simd_scannable_ : std::false_type
+        {};
+        template<typename I, typename O, typename BOp, typename P>
+        struct simd_scannable_<
+            I, O, BOp, P, meta::if_c<ContiguousIterator<I> && ContiguousIterator<O>>>
+          : meta::bool_<Same<P, identity> && is_plus_<BOp>::value &&
+                        Same<iter_value_t<I>, iter_value_t<O>> &&
+                        std::is_integral<iter_value_t<I>>::value &&
+                        !Same<iter_value_t<I>, bool> &&
+                        (sizeof(iter_value_t<I>) == 4 || sizeof(iter_value_t<I>) == 8)>
+        {};
+
+#ifdef RANGES_SCAN_SSE2
+        // Prefix sums of the lanes of x, by the usual shift-and-add ladder.
+        inline __m128i scan_lanes_(__m128i x, meta::size_t<4>) noexcept
+        {
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            return _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        }
+        inline __m128i scan_lanes_(__m128i x, meta::size_t<8>) noexcept
+        {
+            return _mm_add_epi64(x, _mm_slli_si128(x, 8));
+        }
+        inline __m128i add_lanes_(__m128i x, __m128i y, meta::size_t<4>) noexcept
+        {
+            return _mm_add_epi32(x, y);
+        }
+        inline __m128i add_lanes_(__m128i x, __m128i y, meta::size_t<8>) noexcept
+        {
+            return _mm_add_epi64(x, y);
+        }
+        inline __m128i sub_lanes_(__m128i x, __m128i y, meta::size_t<4>) noexcept
+        {
+            return _mm_sub_epi32(x, y);
+        }
+        inline __m128i sub_lanes_(__m128i x, __m128i y, meta::size_t<8>) noexcept
+        {
+            return _mm_sub_epi64(x, y);
+        }
+        // Broadcast the highest lane of x.
+        inline __m128i last_lane_(__m128i x, meta::size_t<4>) noexcept
+        {
+            return _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+        inline __m128i last_lane_(__m128i x, meta::size_t<8>) noexcept
+        {
+            return _mm_unpackhi_epi64(x, x);
+        }
+#endif
+
+        // Writes the running sums of in[0, n), offset by carry, to out and
+        // returns the final sum. Sums are computed modulo 2^N, so in and out
+        // may be the same array. When Exclusive, out[i] excludes in[i].
+        template<bool Exclusive, typename U>
+        U scan_plus_kernel_(U const * in, U * out, std::ptrdiff_t n, U carry) noexcept
+        {
+            CPP_assert(std::is_unsigned<U>::value);
+            std::ptrdiff_t i = 0;
+#ifdef RANGES_SCAN_SSE2
+            using W = meta::size_t<sizeof(U)>;
+            constexpr std::ptrdiff_t lanes = 16 / sizeof(U);
+            if(n >= lanes)
+            {
+                U buf[lanes];
+                for(auto & b : buf)
+                    b = carry;
+                __m128i c = _mm_loadu_si128(reinterpret_cast<__m128i const *>(buf));
+                for(; i + lanes <= n; i += lanes)
+                {
+                    __m128i const x =
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i));
+                    __m128i const s = add_lanes_(scan_lanes_(x, W{}), c, W{});
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                                     Exclusive ? sub_lanes_(s, x, W{}) : s);
+                    c = last_lane_(s, W{});
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(buf), c);
+                carry = buf[0];
+            }
+#endif
+            for(; i < n; ++i)
+            {
+                U const x = in[i];
+                out[i] = Exclusive ? carry : U(carry + x);
+                carry = U(carry + x);
+            }
+            return carry;
+        }
+
+        template<bool Exclusive, typename I, typename O, typename V = iter_value_t<I>>
+        V scan_plus_n_(I first, iter_difference_t<I> n, O out, V carry) noexcept
+        {
+            using U = meta::_t<std::make_unsigned<V>>;
+            if(n <= 0)
+                return carry;
+            return static_cast<V>(detail::scan_plus_kernel_<Exclusive>(
+                reinterpret_cast<U const *>(detail::addressof(*first)),
+                reinterpret_cast<U *>(detail::addressof(*out)),
+                static_cast<std::ptrdiff_t>(n),
+                static_cast<U>(carry)));
+        }
+
+        // Folds the n > 0 elements starting at first with bop.
+        template<typename I, typename BOp, typename P>
+        scan_value_t<I, P> scan_reduce_n_(I first, iter_difference_t<I> n, BOp & bop,
+                                          P & proj)
+        {
+            using X = scan_value_t<I, P>;
+            RANGES_EXPECT(n > 0);
+            coerce<iter_value_t<I>> val_i;
+            coerce<X> val_x;
+            auto && cur1 = val_i(*first);
+            X t(invoke(proj, cur1));
+            for(++first; --n > 0; ++first)
+            {
+                auto && cur2 = val_i(*first);
+                t = val_x(invoke(bop, t, invoke(proj, cur2)));
+            }
+            return t;
+        }
+
+        // Continues an inclusive scan whose running sum so far is t.
+        template<typename I, typename O, typename BOp, typename P, typename X>
+        O inclusive_scan_carry_n_(I first, iter_difference_t<I> n, O out, BOp & bop,
+                                  P & proj, X t, std::false_type)
+        {
+            coerce<iter_value_t<I>> val_i;
+            coerce<X> val_x;
+            for(; n > 0; --n, ++first, ++out)
+            {
+                auto && cur = val_i(*first);
+                t = val_x(invoke(bop, t, invoke(proj, cur)));
+                *out = t;
+            }
+            return out;
+        }
+        template<typename I, typename O, typename BOp, typename P, typename X>
+        O inclusive_scan_carry_n_(I first, iter_difference_t<I> n, O out, BOp &, P &,
+                                  X t, std::true_type)
+        {
+            detail::scan_plus_n_<false>(first, n, out, t);
+            return out + n;
+        }
+
+        template<typename I, typename O, typename BOp, typename P>
+        O inclusive_scan_n_(I first, iter_difference_t<I> n, O out, BOp & bop, P & proj,
+                            std::false_type simd)
+        {
+            if(n <= 0)
+                return out;
+            using X = scan_value_t<I, P>;
+            coerce<iter_value_t<I>> val_i;
+            auto && cur = val_i(*first);
+            X t(invoke(proj, cur));
+            *out = t;
+            return detail::inclusive_scan_carry_n_(
+                ++first, n - 1, ++out, bop, proj, std::move(t), simd);
+        }
+        template<typename I, typename O, typename BOp, typename P>
+        O inclusive_scan_n_(I first, iter_difference_t<I> n, O out, BOp &, P &,
+                            std::true_type)
+        {
+            detail::scan_plus_n_<false>(first, n, out, iter_value_t<I>{});
+            return out + n;
+        }
+
+        // Two-pass parallel scan: reduce every block but the last, scan the
+        // block totals, then re-scan each block seeded with its predecessors'
+        // total.
+        template<typename I, typename O, typename BOp, typename P>
+        O parallel_inclusive_scan_n_(parallel_policy pol, I first, iter_difference_t<I> n,
+                                     O out, BOp & bop, P & proj)
+        {
+            using X = scan_value_t<I, P>;
+            using D = iter_difference_t<I>;
+            using simd_t = meta::bool_<simd_scannable_<I, O, BOp, P>::value>;
+            std::size_t const size = static_cast<std::size_t>(n);
+            std::size_t const count = detail::parallel_block_count(pol, size, scan_grain);
+            if(count <= 1)
+                return detail::inclusive_scan_n_(first, n, out, bop, proj, simd_t{});
+            std::vector<optional<X>> totals(count - 1);
+            detail::parallel_invoke_n(count - 1, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                totals[b].emplace(detail::scan_reduce_n_(first + static_cast<D>(bnd.first),
+                                                         static_cast<D>(bnd.second - bnd.first),
+                                                         bop,
+                                                         proj));
+            });
+            coerce<X> val_x;
+            for(std::size_t b = 1; b < count - 1; ++b)
+                *totals[b] = val_x(invoke(bop, *totals[b - 1], *totals[b]));
+            detail::parallel_invoke_n(count, [&](std::size_t b) {
+                auto const bnd = detail::parallel_block_bounds(size, count, b);
+                auto const lo = static_cast<D>(bnd.first);
+                auto const len = static_cast<D>(bnd.second - bnd.first);
+                if(b == 0)
+                    detail::inclusive_scan_n_(first, len, out, bop, proj, simd_t{});
+                else
+                    detail::inclusive_scan_carry_n_(
+                        first + lo, len, out + lo, bop, proj, *totals[b - 1], simd_t{});
+            });
+            return out + n;
+        }
+    } // namespace detail
+    /// \endcond
+
+    template<typename I, typename O>
+    using inclusive_scan_result = detail::in_out_result<I, O>;
+
+    /// Computes the running "sums" of a sequence, like \c partial_sum. The
+    /// overloads taking a \c parallel_policy require random-access input and
+    /// output and compute the scan in two parallel passes, so \c bop must be
+    /// associative and safe to call concurrently. Contiguous 32- and 64-bit
+    /// integers summed with \c plus use a vectorized kernel.
+    struct inclusive_scan_fn
+    {
+    private:
+        template<typename I, typename S, typename O, typename BOp, typename P>
+        static inclusive_scan_result<I, O> impl_(I first, S last, O out, BOp & bop,
+                                                 P & proj, std::true_type simd)
+        {
+            auto const n = last - first;
+            out = detail::inclusive_scan_n_(first, n, out, bop, proj, simd);
+            return {first + n, out};
+        }
+        template<typename I, typename S, typename O, typename BOp, typename P>
+        static inclusive_scan_result<I, O> impl_(I first, S last, O out, BOp & bop,
+                                                 P & proj, std::false_type)
+        {
+            using X = detail::scan_value_t<I, P>;
+            coerce<iter_value_t<I>> val_i;
+            coerce<X> val_x;
+            if(first != last)
+            {
+                auto && cur1 = val_i(*first);
+                X t(invoke(proj, cur1));
+                *out = t;
+                for(++first, ++out; first != last; ++first, ++out)
+                {
+                    auto && cur2 = val_i(*first);
+                    t = val_x(invoke(bop, t, invoke(proj, cur2)));
+                    *out = t;
+                }
+            }
+            return {first, out};
+        }
+
+    public:
+        template<typename I, typename S, typename O, typename BOp = plus,
+                 typename P = identity>
+        auto operator()(I first, S last, O out, BOp bop = BOp{}, P proj = P{}) const
+            -> CPP_ret(inclusive_scan_result<I, O>)( //
+                requires Sentinel<S, I> && PartialSummable<I, O, BOp, P>)
+        {
+            using simd_t = meta::bool_<SizedSentinel<S, I> &&
+                                       detail::simd_scannable_<I, O, BOp, P>::value>;
+            return inclusive_scan_fn::impl_(
+                std::move(first), std::move(last), std::move(out), bop, proj, simd_t{});
+        }
+
+        template<typename Rng, typename O, typename BOp = plus, typename P = identity,
+                 typename I = iterator_t<Rng>>
+        auto operator()(Rng && rng, O out, BOp bop = BOp{}, P proj = P{}) const
+            -> CPP_ret(inclusive_scan_result<safe_iterator_t<Rng>, O>)( //
+                requires Range<Rng> && PartialSummable<I, O, BOp, P>)
+        {
+            return (*this)(
+                begin(rng), end(rng), std::move(out), std::move(bop), std::move(proj));
+        }
+
+        template<typename I, typename S, typename O, typename BOp = plus,
+                 typename P = identity>
+        auto operator()(parallel_policy pol, I first, S last, O out, BOp bop = BOp{},
+                        P proj = P{}) const
+            -> CPP_ret(inclusive_scan_result<I, O>)( //
+                requires RandomAccessIterator<I> && SizedSentinel<S, I> &&
+                    RandomAccessIterator<O> && PartialSummable<I, O, BOp, P>)
+        {
+            auto const n = last - first;
+            out = detail::parallel_inclusive_scan_n_(pol, first, n, out, bop, proj);
+            return {first + n, out};
+        }
+
+        template<typename Rng, typename O, typename BOp = plus, typename P = identity,
+                 typename I = iterator_t<Rng>>
+        auto operator()(parallel_policy pol, Rng && rng, O out, BOp bop = BOp{},
+                        P proj = P{}) const
+            -> CPP_ret(inclusive_scan_result<safe_iterator_t<Rng>, O>)( //
+                requires RandomAccessRange<Rng> && SizedSentinel<sentinel_t<Rng>, I> &&
+                    RandomAccessIterator<O> && PartialSummable<I, O, BOp, P>)
+        {
+            return (*this)(
+                pol, begin(rng), end(rng), std::move(out), std::move(bop), std::move(proj));
+        }
+    };
+
+    /// \sa `inclusive_scan_fn`
+    RANGES_INLINE_VARIABLE(inclusive_scan_fn, inclusive_scan)
+    /// @}
+} // namespace ranges
+
+#endif
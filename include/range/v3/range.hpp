@@ -22,7 +22,9 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/range/dangling.hpp>
 #include <range/v3/range/operations.hpp>
+#include <range/v3/range/parallel_conversion.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 
 RANGES_RE_ENABLE_WARNINGS
@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_RANGE_CONVERSION_HPP
 #define RANGES_V3_RANGE_CONVERSION_HPP
 
+#include <memory>
+
 #include <meta/meta.hpp>
 
 #include <range/v3/range_fwd.hpp>
@@ -21,7 +23,9 @@
 #include <range/v3/action/concepts.hpp>
 #include <range/v3/functional/pipeable.hpp>
 #include <range/v3/iterator/common_iterator.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -47,6 +51,12 @@ namespace ranges
             template<typename ToContainer>
             struct fn;
 
+            template<typename ToContainer>
+            struct par_fn;
+
+            template<typename ToContainer, typename Alloc>
+            struct alloc_fn;
+
             template<typename ToContainer, typename Rng>
             using container_t = meta::invoke<ToContainer, Rng>;
 
@@ -231,6 +241,30 @@ namespace ranges
                 defer::ConvertibleToContainerContainerImpl<Rng, Cont>
         );
 
+        // A container whose elements are views into its own storage, like
+        // jagged_vector, is built from the range of ranges directly when its
+        // elements cannot simply be constructed from the source's.
+        CPP_def
+        (
+            template(typename Rng, typename Cont)
+            concept ConvertibleToContainerOfViewsImpl,
+                Range<Cont> && (!View<Cont>) && MoveConstructible<Cont> &&
+                View<range_value_t<Cont>> && InputRange<range_reference_t<Rng>> &&
+                (!Constructible<range_value_t<Cont>, range_reference_t<Rng>>) &&
+                Constructible<
+                    Cont,
+                    range_cpp17_iterator_t<Rng>,
+                    range_cpp17_iterator_t<Rng>>
+        );
+
+        CPP_def
+        (
+            template(typename Rng, typename Cont)
+            concept ConvertibleToContainerOfViews,
+                defer::HasAllocatorType<Cont> && // HACKHACK
+                defer::ConvertibleToContainerOfViewsImpl<Rng, Cont>
+        );
+
         CPP_def
         (
             template(typename C, typename I, typename R)
@@ -238,8 +272,36 @@ namespace ranges
                 ReserveAndAssignable<C, I> &&
                 SizedRange<R>
         );
+
+        CPP_def
+        (
+            template(typename C, typename I, typename R)
+            concept ToContainerHintReserve,
+                requires (C &c, I i)
+                (
+                    c.push_back(*i)
+                ) &&
+                Reservable<C> && (!SizedRange<R>) && HasSizeHint<R>
+        );
+
+        CPP_def
+        (
+            template(typename C)
+            concept ShrinkableContainer,
+                requires (C &c)
+                (
+                    c.shrink_to_fit()
+                )
+        );
         // clang-format on
 
+        // Reserving from an upper bound stops at this many bytes; beyond
+        // that the container grows as usual.
+        constexpr std::size_t size_hint_reserve_max = std::size_t{1} << 24;
+
+        struct size_hint_reserve_tag
+        {};
+
         template<typename ToContainer>
         struct to_container::fn : pipeable<fn<ToContainer>>
         {
@@ -261,6 +323,54 @@ namespace ranges
                 c.assign(I{ranges::begin(rng)}, I{ranges::end(rng)});
                 return c;
             }
+            // Not sized, but the range knows roughly how large it is: reserve
+            // once, fill in a single pass, and give back the excess if the
+            // reservation was far too generous.
+            template<typename Cont, typename I, typename Rng>
+            static Cont impl(Rng && rng, size_hint_reserve_tag)
+            {
+                Cont c;
+                size_bounds const hint = ranges::size_hint(rng);
+                std::size_t const limit = size_hint_reserve_max / sizeof(range_value_t<Cont>);
+                std::size_t n = hint.lower;
+                if(hint.bounded() && n < limit)
+                    n = hint.upper < limit ? hint.upper : limit;
+                if(n > static_cast<std::size_t>(c.max_size()))
+                    n = static_cast<std::size_t>(c.max_size());
+                c.reserve(static_cast<decltype(c.max_size())>(n));
+                fn::append_<I>(c, rng, 0);
+                if(c.size() < c.capacity() / 2)
+                    fn::shrink_(c, meta::bool_<ShrinkableContainer<Cont>>{});
+                return c;
+            }
+            // A view that can append its elements to a container in bulk
+            // finds to_container_append_(c, rng) by ADL.
+            template<typename I, typename Cont, typename Rng>
+            static auto append_(Cont & c, Rng & rng, int)
+                -> decltype(to_container_append_(c, rng))
+            {
+                to_container_append_(c, rng);
+            }
+            template<typename I, typename Cont, typename Rng>
+            static void append_(Cont & c, Rng & rng, long)
+            {
+                I const last{ranges::end(rng)};
+                for(I it{ranges::begin(rng)}; it != last; ++it)
+                    c.push_back(*it);
+            }
+            template<typename Cont>
+            static void shrink_(Cont & c, std::true_type)
+            {
+                c.shrink_to_fit();
+            }
+            template<typename Cont>
+            static void shrink_(Cont &, std::false_type)
+            {}
+            template<typename Cont, typename I, typename Rng>
+            using reserve_t =
+                meta::if_c<(bool)ToContainerReserve<Cont, I, Rng>, std::true_type,
+                           meta::if_c<(bool)ToContainerHintReserve<Cont, I, Rng>,
+                                      size_hint_reserve_tag, std::false_type>>;
             template<typename Rng>
             using container_t = meta::invoke<ToContainer, Rng>;
 
@@ -273,9 +383,8 @@ namespace ranges
                               "Attempt to convert an infinite range to a container.");
                 using cont_t = container_t<Rng>;
                 using iter_t = range_cpp17_iterator_t<Rng>;
-                using use_reserve_t =
-                    meta::bool_<(bool)ToContainerReserve<cont_t, iter_t, Rng>>;
-                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng), use_reserve_t{});
+                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng),
+                                            reserve_t<cont_t, iter_t, Rng>{});
             }
             template<typename Rng>
             auto operator()(Rng && rng) const -> CPP_ret(container_t<Rng>)(       //
@@ -287,15 +396,212 @@ namespace ranges
                               "Attempt to convert an infinite range to a container.");
                 using cont_t = container_t<Rng>;
                 using iter_t = to_container_iterator<Rng, cont_t>;
-                using use_reserve_t =
-                    meta::bool_<(bool)ToContainerReserve<cont_t, iter_t, Rng>>;
-                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng), use_reserve_t{});
+                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng),
+                                            reserve_t<cont_t, iter_t, Rng>{});
+            }
+            template<typename Rng>
+            auto operator()(Rng && rng) const -> CPP_ret(container_t<Rng>)(       //
+                requires InputRange<Rng> &&
+                    ConvertibleToContainerOfViews<Rng, container_t<Rng>>)
+            {
+                static_assert(!is_infinite<Rng>::value,
+                              "Attempt to convert an infinite range to a container.");
+                using cont_t = container_t<Rng>;
+                using iter_t = range_cpp17_iterator_t<Rng>;
+                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng), std::false_type{});
             }
         };
 
         template<typename ToContainer>
         using to_container_fn = to_container::fn<ToContainer>;
 
+        template<typename Alloc, typename T>
+        using rebind_alloc_t =
+            typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+
+        // clang-format off
+        CPP_def
+        (
+            template(typename A)
+            concept ContainerAllocator,
+                requires (A &a)
+                (
+                    a.allocate(std::size_t{1})
+                ) &&
+                CopyConstructible<A>
+        );
+
+        CPP_def
+        (
+            template(typename Cont, typename Alloc)
+            concept AllocatorAwareContainerImpl,
+                Range<Cont> && (!View<Cont>) && MoveConstructible<Cont> &&
+                Constructible<typename Cont::allocator_type, Alloc const &> &&
+                Constructible<Cont, typename Cont::allocator_type const &>
+        );
+
+        CPP_def
+        (
+            template(typename Cont, typename Alloc)
+            concept AllocatorAwareContainer,
+                defer::HasAllocatorType<Cont> &&
+                defer::AllocatorAwareContainerImpl<Cont, Alloc>
+        );
+
+        CPP_def
+        (
+            template(typename Rng, typename Cont, typename Alloc)
+            concept ConvertibleToAllocContainerImpl,
+                Constructible<range_value_t<Cont>, range_reference_t<Rng>> &&
+                Constructible<
+                    Cont,
+                    range_cpp17_iterator_t<Rng>,
+                    range_cpp17_iterator_t<Rng>,
+                    typename Cont::allocator_type const &>
+        );
+
+        CPP_def
+        (
+            template(typename Rng, typename Cont, typename Alloc)
+            concept ConvertibleToAllocContainer,
+                defer::AllocatorAwareContainer<Cont, Alloc> &&
+                defer::ConvertibleToAllocContainerImpl<Rng, Cont, Alloc>
+        );
+
+        // A container of containers each of which takes its memory from the
+        // same allocator as the outer one.
+        CPP_def
+        (
+            template(typename Rng, typename Cont, typename Alloc)
+            concept ConvertibleToAllocContainerContainerImpl,
+                requires (Cont &c, range_value_t<Cont> &v)
+                (
+                    c.insert(c.end(), std::move(v))
+                ) &&
+                Range<range_reference_t<Rng>> &&
+                Invocable<
+                    to_container::alloc_fn<meta::id<range_value_t<Cont>>, Alloc>,
+                    range_reference_t<Rng>>
+        );
+
+        CPP_def
+        (
+            template(typename Rng, typename Cont, typename Alloc)
+            concept ConvertibleToAllocContainerContainer,
+                defer::AllocatorAwareContainer<Cont, Alloc> &&
+                defer::AllocatorAwareContainer<range_value_t<Cont>, Alloc> &&
+                defer::ConvertibleToAllocContainerContainerImpl<Rng, Cont, Alloc>
+        );
+        // clang-format on
+
+        template<typename ToContainer, typename Alloc>
+        struct to_container::alloc_fn : pipeable<alloc_fn<ToContainer, Alloc>>
+        {
+        private:
+            Alloc alloc_;
+
+            template<typename Rng>
+            using container_t = meta::invoke<ToContainer, Rng>;
+
+            template<typename Cont>
+            typename Cont::allocator_type get_allocator_() const
+            {
+                return typename Cont::allocator_type(alloc_);
+            }
+            // Memory handed out by an arena is rarely reclaimed, so find the
+            // size up front even when that means walking the range twice.
+            template<typename Cont, typename Rng>
+            static void reserve_(Cont & c, Rng & rng, std::true_type)
+            {
+                c.reserve(static_cast<range_size_t<Cont>>(ranges::distance(rng)));
+            }
+            template<typename Cont, typename Rng>
+            static void reserve_(Cont &, Rng &, std::false_type)
+            {}
+            template<typename Cont, typename Rng>
+            using use_reserve_t = meta::bool_<Reservable<Cont> &&
+                                              (SizedRange<Rng> || ForwardRange<Rng>)>;
+
+            template<typename Cont, typename I, typename Rng>
+            Cont impl(Rng && rng, std::false_type) const
+            {
+                return Cont(I{ranges::begin(rng)}, I{ranges::end(rng)},
+                            get_allocator_<Cont>());
+            }
+            template<typename Cont, typename I, typename Rng>
+            Cont impl(Rng && rng, std::true_type) const
+            {
+                Cont c(get_allocator_<Cont>());
+                reserve_(c, rng, use_reserve_t<Cont, Rng>{});
+                c.assign(I{ranges::begin(rng)}, I{ranges::end(rng)});
+                return c;
+            }
+
+        public:
+            constexpr explicit alloc_fn(Alloc alloc)
+              : alloc_(std::move(alloc))
+            {}
+
+            template<typename Rng>
+            auto operator()(Rng && rng) const -> CPP_ret(container_t<Rng>)( //
+                requires InputRange<Rng> &&
+                    ConvertibleToAllocContainer<Rng, container_t<Rng>, Alloc> &&
+                    (!ConvertibleToAllocContainerContainer<Rng, container_t<Rng>, Alloc>))
+            {
+                static_assert(!is_infinite<Rng>::value,
+                              "Attempt to convert an infinite range to a container.");
+                using cont_t = container_t<Rng>;
+                using iter_t = range_cpp17_iterator_t<Rng>;
+                using use_assign_t = meta::bool_<ReserveAndAssignable<cont_t, iter_t>>;
+                return impl<cont_t, iter_t>(static_cast<Rng &&>(rng), use_assign_t{});
+            }
+            template<typename Rng>
+            auto operator()(Rng && rng) const -> CPP_ret(container_t<Rng>)( //
+                requires InputRange<Rng> &&
+                    ConvertibleToAllocContainerContainer<Rng, container_t<Rng>, Alloc>)
+            {
+                static_assert(!is_infinite<Rng>::value,
+                              "Attempt to convert an infinite range to a container.");
+                using cont_t = container_t<Rng>;
+                alloc_fn<meta::id<range_value_t<cont_t>>, Alloc> const elem{alloc_};
+                cont_t c(get_allocator_<cont_t>());
+                reserve_(c, rng, use_reserve_t<cont_t, Rng>{});
+                auto const last = ranges::end(rng);
+                for(auto it = ranges::begin(rng); it != last; ++it)
+                {
+                    range_value_t<cont_t> v = elem(*it);
+                    c.insert(c.end(), std::move(v));
+                }
+                return c;
+            }
+        };
+
+        template<template<typename...> class ContT, typename Alloc>
+        struct from_range_alloc
+        {
+            template<typename Rng>
+            using invoke =
+                ContT<range_value_t<Rng>, rebind_alloc_t<Alloc, range_value_t<Rng>>>;
+        };
+
+        // C itself when it already uses the rebound allocator, or else a
+        // std::vector with the same elements that does.
+        template<typename C, typename Alloc, typename = void>
+        struct container_for_alloc_
+        {
+            using type = std::vector<range_value_t<C>, rebind_alloc_t<Alloc, range_value_t<C>>>;
+        };
+        template<typename C, typename Alloc>
+        struct container_for_alloc_<
+            C, Alloc,
+            meta::if_<std::is_same<typename C::allocator_type,
+                                   rebind_alloc_t<Alloc, range_value_t<C>>>>>
+        {
+            using type = C;
+        };
+        template<typename C, typename Alloc>
+        using container_for_alloc_t = meta::_t<container_for_alloc_<C, Alloc>>;
+
         template<template<typename...> class ContT>
         struct from_range
         {
@@ -362,11 +668,61 @@ namespace ranges
         /// \overload
         template<typename Cont, typename Rng>
         auto to(Rng && rng) -> CPP_ret(Cont)( //
-            requires Range<Rng> && detail::ConvertibleToContainer<Rng, Cont>)
+            requires Range<Rng> && Invocable<detail::to_container_fn<meta::id<Cont>>, Rng>)
         {
             return detail::to_container_fn<meta::id<Cont>>{}(static_cast<Rng &&>(rng));
         }
 
+        /// \brief Like `to<ContT>()`, except that the container, and any
+        /// containers nested in it, take their memory from \c alloc (rebound
+        /// to the appropriate value type). The container type is
+        /// <tt>ContT\<V, A\></tt>, so \c ContT must take the allocator as
+        /// its second template parameter; spell out the container type
+        /// otherwise.
+        template<template<typename...> class ContT, typename Alloc>
+        auto to(Alloc alloc)
+            -> CPP_ret(detail::to_container::alloc_fn<detail::from_range_alloc<ContT, Alloc>,
+                                                      Alloc>)( //
+                requires detail::ContainerAllocator<Alloc> && (!Range<Alloc>))
+        {
+            return detail::to_container::alloc_fn<detail::from_range_alloc<ContT, Alloc>,
+                                                  Alloc>{std::move(alloc)};
+        }
+
+        /// \overload
+        template<template<typename...> class ContT, typename Rng, typename Alloc>
+        auto to(Rng && rng, Alloc alloc) -> CPP_ret(meta::invoke<
+            detail::from_range_alloc<ContT, meta::if_c<detail::ContainerAllocator<Alloc>, Alloc>>,
+            Rng>)( //
+            requires Range<Rng> && detail::ContainerAllocator<Alloc> &&
+                Invocable<detail::to_container::alloc_fn<
+                              detail::from_range_alloc<ContT, Alloc>, Alloc>,
+                          Rng>)
+        {
+            return detail::to_container::alloc_fn<detail::from_range_alloc<ContT, Alloc>,
+                                                  Alloc>{std::move(alloc)}(
+                static_cast<Rng &&>(rng));
+        }
+
+        /// \overload
+        template<typename Cont, typename Alloc>
+        auto to(Alloc alloc)
+            -> CPP_ret(detail::to_container::alloc_fn<meta::id<Cont>, Alloc>)( //
+                requires detail::ContainerAllocator<Alloc> && (!Range<Alloc>))
+        {
+            return detail::to_container::alloc_fn<meta::id<Cont>, Alloc>{std::move(alloc)};
+        }
+
+        /// \overload
+        template<typename Cont, typename Rng, typename Alloc>
+        auto to(Rng && rng, Alloc alloc) -> CPP_ret(Cont)( //
+            requires Range<Rng> && detail::ContainerAllocator<Alloc> &&
+                Invocable<detail::to_container::alloc_fn<meta::id<Cont>, Alloc>, Rng>)
+        {
+            return detail::to_container::alloc_fn<meta::id<Cont>, Alloc>{std::move(alloc)}(
+                static_cast<Rng &&>(rng));
+        }
+
         /// \cond
         // Slightly odd initializer_list overloads, undocumented for now.
         template<template<typename...> class ContT, typename T>
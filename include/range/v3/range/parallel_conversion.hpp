@@ -0,0 +1,280 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_RANGE_PARALLEL_CONVERSION_HPP
+#define RANGES_V3_RANGE_PARALLEL_CONVERSION_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/action/concepts.hpp>
+#include <range/v3/functional/pipeable.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // Below this many elements per thread a parallel conversion is not
+        // worth it.
+        constexpr std::size_t to_container_grain = std::size_t{1} << 12;
+
+        // clang-format off
+        // A container whose elements can be created up front and then
+        // assigned from several threads at once.
+        CPP_def
+        (
+            template(typename C, typename T)
+            concept ParallelAssignableContainer,
+                requires (C &c, range_size_t<C> n)
+                (
+                    c.resize(n)
+                ) &&
+                RandomAccessRange<C> && DefaultConstructible<range_value_t<C>> &&
+                std::is_lvalue_reference<range_reference_t<C>>::value &&
+                Assignable<range_reference_t<C>, T>
+        );
+
+        // A container to which separately built chunks can be appended.
+        CPP_def
+        (
+            template(typename C)
+            concept ChunkAppendableContainer,
+                requires (C &c, std::move_iterator<range_value_t<C> *> i)
+                (
+                    c.insert(c.end(), i, i)
+                ) &&
+                MoveConstructible<range_value_t<C>>
+        );
+        // clang-format on
+
+        // Produces the element of Cont for an element of the source range,
+        // converting it with ranges::to when Cont is a container of containers.
+        template<typename Cont, bool Nested>
+        struct to_container_element_
+        {
+            template<typename Ref>
+            Ref && operator()(Ref && ref) const
+            {
+                return static_cast<Ref &&>(ref);
+            }
+        };
+        template<typename Cont>
+        struct to_container_element_<Cont, true>
+        {
+            template<typename Ref>
+            range_value_t<Cont> operator()(Ref && ref) const
+            {
+                return to_container::fn<meta::id<range_value_t<Cont>>>{}(
+                    static_cast<Ref &&>(ref));
+            }
+        };
+
+        template<typename ToContainer>
+        struct to_container::par_fn : pipeable<par_fn<ToContainer>>
+        {
+        private:
+            parallel_policy pol_;
+
+            template<typename Rng>
+            using container_t = meta::invoke<ToContainer, Rng>;
+            // Ranges of views are converted element-wise with ranges::to rather
+            // than with the views' deprecated implicit conversion.
+            template<typename Rng>
+            using element_fn_t = to_container_element_<
+                container_t<Rng>,
+                !ConvertibleToContainer<Rng, container_t<Rng>> ||
+                    (View<uncvref_t<range_reference_t<Rng>>> &&
+                     Invocable<to_container::fn<meta::id<range_value_t<container_t<Rng>>>>,
+                               range_reference_t<Rng>>)>;
+            template<typename Rng>
+            using element_t =
+                invoke_result_t<element_fn_t<Rng> const &, range_reference_t<Rng>>;
+
+            // Sized and random-access: make room for every element, then let
+            // each thread assign its own slice of the result.
+            template<typename Cont, typename Rng>
+            Cont impl(Rng && rng, std::size_t n, std::size_t count, meta::size_t<2>) const
+            {
+                using D = range_difference_t<Rng>;
+                using CD = range_difference_t<Cont>;
+                element_fn_t<Rng> elem;
+                Cont c;
+                c.resize(static_cast<range_size_t<Cont>>(n));
+                auto const first = ranges::begin(rng);
+                auto const out = ranges::begin(c);
+                detail::parallel_invoke_n(count, [&](std::size_t b) {
+                    auto const bnd = detail::parallel_block_bounds(n, count, b);
+                    auto it = first + static_cast<D>(bnd.first);
+                    auto o = out + static_cast<CD>(bnd.first);
+                    for(auto i = bnd.first; i != bnd.second; ++i, ++it, ++o)
+                        *o = elem(*it);
+                });
+                return c;
+            }
+            // Forward: find the chunk boundaries without dereferencing, build
+            // every chunk into a buffer of its own, then splice the buffers.
+            template<typename Cont, typename Rng>
+            Cont impl(Rng && rng, std::size_t n, std::size_t count, meta::size_t<1>) const
+            {
+                using V = range_value_t<Cont>;
+                element_fn_t<Rng> elem;
+                std::vector<iterator_t<Rng>> bounds;
+                bounds.reserve(count + 1);
+                auto it = ranges::begin(rng);
+                std::size_t pos = 0;
+                for(std::size_t b = 0; b < count; ++b)
+                {
+                    auto const lo = detail::parallel_block_bounds(n, count, b).first;
+                    for(; pos != lo; ++pos)
+                        ++it;
+                    bounds.push_back(it);
+                }
+                std::vector<std::vector<V>> chunks(count);
+                detail::parallel_invoke_n(count, [&](std::size_t b) {
+                    auto const bnd = detail::parallel_block_bounds(n, count, b);
+                    auto & chunk = chunks[b];
+                    chunk.reserve(bnd.second - bnd.first);
+                    auto i = bounds[b];
+                    for(auto k = bnd.first; k != bnd.second; ++k, ++i)
+                        chunk.emplace_back(elem(*i));
+                });
+                Cont c;
+                this->reserve_(c, n, meta::bool_<Reservable<Cont>>{});
+                for(auto & chunk : chunks)
+                    c.insert(c.end(),
+                             std::make_move_iterator(chunk.data()),
+                             std::make_move_iterator(chunk.data() + chunk.size()));
+                return c;
+            }
+            template<typename Cont, typename Rng>
+            Cont impl(Rng && rng, std::size_t, std::size_t, meta::size_t<0>) const
+            {
+                return to_container::fn<meta::id<Cont>>{}(static_cast<Rng &&>(rng));
+            }
+            template<typename Cont>
+            static void reserve_(Cont & c, std::size_t n, std::true_type)
+            {
+                c.reserve(static_cast<range_size_t<Cont>>(n));
+            }
+            template<typename Cont>
+            static void reserve_(Cont &, std::size_t, std::false_type)
+            {}
+
+        public:
+            par_fn() = default;
+            constexpr explicit par_fn(parallel_policy pol) noexcept
+              : pol_(pol)
+            {}
+
+            template<typename Rng>
+            auto operator()(Rng && rng) const -> CPP_ret(container_t<Rng>)( //
+                requires InputRange<Rng> &&
+                    True<defer::ConvertibleToContainer<Rng, container_t<Rng>> ||
+                         defer::ConvertibleToContainerContainer<Rng, container_t<Rng>>>)
+            {
+                static_assert(!is_infinite<Rng>::value,
+                              "Attempt to convert an infinite range to a container.");
+                using cont_t = container_t<Rng>;
+                // 2: assign in place, 1: splice chunks, 0: sequential
+                using strategy_t = meta::size_t<
+                    RandomAccessRange<Rng> && SizedRange<Rng> &&
+                            ParallelAssignableContainer<cont_t, element_t<Rng>>
+                        ? 2
+                        : ForwardRange<Rng> && ChunkAppendableContainer<cont_t> ? 1 : 0>;
+                std::size_t n = 0, count = 1;
+                if(strategy_t::value != 0)
+                {
+                    n = static_cast<std::size_t>(ranges::distance(rng));
+                    count = detail::parallel_block_count(pol_, n, to_container_grain);
+                }
+                if(count <= 1)
+                    return impl<cont_t>(static_cast<Rng &&>(rng), n, count, meta::size_t<0>{});
+                return impl<cont_t>(static_cast<Rng &&>(rng), n, count, strategy_t{});
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-range
+    /// @{
+
+    /// \cond
+    namespace _to_
+    {
+        /// \endcond
+
+        /// \brief Like `ranges::to`, but computes the elements of the container
+        /// on several threads. Sized, random-access sources are converted in
+        /// place into containers that can be resized up front, such as
+        /// \c std::vector; other forward sources are converted into per-thread
+        /// buffers that are spliced together at the end. Everything else is
+        /// converted sequentially. Dereferencing distinct elements of the
+        /// source must be safe to do concurrently.
+        template<template<typename...> class ContT>
+        auto to(parallel_policy pol)
+            -> detail::to_container::par_fn<detail::from_range<ContT>>
+        {
+            return detail::to_container::par_fn<detail::from_range<ContT>>{pol};
+        }
+
+        /// \overload
+        template<template<typename...> class ContT, typename Rng>
+        auto to(parallel_policy pol, Rng && rng) -> CPP_ret(ContT<range_value_t<Rng>>)( //
+            requires Range<Rng> &&
+                detail::ConvertibleToContainer<Rng, ContT<range_value_t<Rng>>>)
+        {
+            return detail::to_container::par_fn<detail::from_range<ContT>>{pol}(
+                static_cast<Rng &&>(rng));
+        }
+
+        /// \overload
+        template<typename Cont>
+        auto to(parallel_policy pol) -> detail::to_container::par_fn<meta::id<Cont>>
+        {
+            return detail::to_container::par_fn<meta::id<Cont>>{pol};
+        }
+
+        /// \overload
+        template<typename Cont, typename Rng>
+        auto to(parallel_policy pol, Rng && rng) -> CPP_ret(Cont)( //
+            requires Range<Rng> &&
+                True<detail::defer::ConvertibleToContainer<Rng, Cont> ||
+                     detail::defer::ConvertibleToContainerContainer<Rng, Cont>>)
+        {
+            return detail::to_container::par_fn<meta::id<Cont>>{pol}(
+                static_cast<Rng &&>(rng));
+        }
+
+        /// \cond
+    } // namespace _to_
+    /// \endcond
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,126 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_RANGE_SIZE_HINT_HPP
+#define RANGES_V3_RANGE_SIZE_HINT_HPP
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-range
+    /// @{
+
+    /// Bounds on the number of elements of a range that are known without
+    /// traversing it. An \c upper of \c size_bounds::unbounded means that
+    /// nothing is known about the upper bound.
+    struct size_bounds
+    {
+        static constexpr std::size_t unbounded = std::numeric_limits<std::size_t>::max();
+
+        std::size_t lower = 0;
+        std::size_t upper = unbounded;
+
+        constexpr bool bounded() const noexcept
+        {
+            return upper != unbounded;
+        }
+        /// \return Bounds no tighter than <tt>[0, upper]</tt>.
+        constexpr size_bounds at_most() const noexcept
+        {
+            return {0, upper};
+        }
+    };
+
+    /// \cond
+    namespace _size_hint_
+    {
+        struct fn
+        {
+        private:
+            template<typename R>
+            using member_size_hint_t = decltype(std::declval<R>().size_hint());
+
+            template<typename R>
+            static constexpr auto impl_(R && r, detail::priority_tag<2>)
+                -> CPP_ret(size_bounds)( //
+                    requires SizedRange<R>)
+            {
+                return {static_cast<std::size_t>(ranges::size(r)),
+                        static_cast<std::size_t>(ranges::size(r))};
+            }
+            template<typename R>
+            static constexpr auto impl_(R && r, detail::priority_tag<1>)
+                -> CPP_ret(size_bounds)( //
+                    requires Same<member_size_hint_t<R>, size_bounds>)
+            {
+                return ((R &&) r).size_hint();
+            }
+            template<typename R>
+            static constexpr size_bounds impl_(R &&, detail::priority_tag<0>) noexcept
+            {
+                return {};
+            }
+
+        public:
+            template<typename R>
+            constexpr size_bounds operator()(R && r) const
+            {
+                return fn::impl_((R &&) r, detail::priority_tag<2>{});
+            }
+        };
+    } // namespace _size_hint_
+    /// \endcond
+
+    /// \ingroup group-range
+    /// \return For a given expression `E`, `ranges::size_hint(E)` is:
+    ///   * `{ranges::size(E), ranges::size(E)}` if `E` is a `SizedRange`.
+    ///   * Otherwise, `E.size_hint()` if that is a valid expression of type
+    ///     `size_bounds`. Views that cannot be sized cheaply, such as
+    ///     `view::filter`, use this to report what they know.
+    ///   * Otherwise, `size_bounds{}`.
+    RANGES_INLINE_VARIABLE(_size_hint_::fn, size_hint)
+
+    /// \cond
+    namespace detail
+    {
+        // clang-format off
+        CPP_def
+        (
+            template(typename R)
+            concept HasSizeHint,
+                requires (R &&r)
+                (
+                    concepts::requires_<Same<decltype(((R &&) r).size_hint()), size_bounds>>
+                )
+        );
+        // clang-format on
+
+        inline constexpr size_bounds size_bounds_min(size_bounds b, std::size_t n) noexcept
+        {
+            return {b.lower < n ? b.lower : n, b.upper < n ? b.upper : n};
+        }
+    } // namespace detail
+    /// \endcond
+    /// @}
+} // namespace ranges
+
+#endif
@@ -18,6 +18,7 @@
 RANGES_DISABLE_WARNINGS
 
 #include <range/v3/utility/any.hpp>
+#include <range/v3/utility/arena.hpp>
 #include <range/v3/utility/box.hpp>
 #include <range/v3/utility/common_tuple.hpp>
 #include <range/v3/utility/common_type.hpp>
@@ -25,13 +26,17 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/utility/copy.hpp>
 #include <range/v3/utility/get.hpp>
 #include <range/v3/utility/in_place.hpp>
+#include <range/v3/utility/jagged_vector.hpp>
 #include <range/v3/utility/memory.hpp>
 #include <range/v3/utility/move.hpp>
 #include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/parallel.hpp>
 #include <range/v3/utility/polymorphic_cast.hpp>
 #include <range/v3/utility/random.hpp>
 #include <range/v3/utility/scope_exit.hpp>
+#include <range/v3/utility/scratch_buffer.hpp>
 #include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/soa_vector.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/swap.hpp>
 #include <range/v3/utility/tuple_algorithm.hpp>
@@ -0,0 +1,218 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_ARENA_HPP
+#define RANGES_V3_UTILITY_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#include <range/v3/detail/config.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-utility
+    /// @{
+
+    /// A monotonic memory resource. Memory is carved sequentially out of a
+    /// list of blocks, and is given back all at once by \c reset() or by
+    /// destroying the arena; \c reset() keeps the blocks for reuse. Freeing
+    /// the most recent allocation rewinds the arena, so a scratch buffer that
+    /// is released before anything else is allocated costs nothing. The arena
+    /// is neither copyable nor thread-safe.
+    struct monotonic_arena
+    {
+    private:
+        struct block
+        {
+            block * next;
+            std::size_t size;
+        };
+        static constexpr std::size_t min_block_size = 256;
+
+        block * head_ = nullptr;
+        block * current_ = nullptr;
+        char * cur_ = nullptr;
+        char * end_ = nullptr;
+        std::size_t initial_size_;
+        std::size_t next_size_;
+
+        static char * data_(block * b) noexcept
+        {
+            return reinterpret_cast<char *>(b + 1);
+        }
+        void * try_allocate_(std::size_t bytes, std::size_t align) noexcept
+        {
+            if(!cur_)
+                return nullptr;
+            auto const addr = reinterpret_cast<std::uintptr_t>(cur_);
+            auto const pad = (align - addr % align) % align;
+            if(static_cast<std::size_t>(end_ - cur_) < pad ||
+               static_cast<std::size_t>(end_ - cur_) - pad < bytes)
+                return nullptr;
+            char * const p = cur_ + pad;
+            cur_ = p + bytes;
+            return p;
+        }
+        // Make current_ a block with at least need usable bytes, reusing the
+        // blocks kept by reset() when they are large enough.
+        void next_block_(std::size_t need)
+        {
+            block ** link = current_ ? &current_->next : &head_;
+            while(*link && (*link)->size < need)
+            {
+                block * const small = *link;
+                *link = small->next;
+                ::operator delete(small);
+            }
+            if(!*link)
+            {
+                std::size_t size = next_size_;
+                while(size < need)
+                    size *= 2;
+                block * const b = static_cast<block *>(::operator new(sizeof(block) + size));
+                b->next = nullptr;
+                b->size = size;
+                *link = b;
+                next_size_ = size * 2;
+            }
+            current_ = *link;
+            cur_ = data_(current_);
+            end_ = cur_ + current_->size;
+        }
+
+    public:
+        /// Creates an empty arena whose first block will hold at least
+        /// \c initial_block bytes. Each new block is twice as large as the
+        /// previous one.
+        explicit monotonic_arena(std::size_t initial_block = 4096) noexcept
+          : initial_size_(initial_block < min_block_size ? min_block_size
+                                                         : initial_block)
+          , next_size_(initial_size_)
+        {}
+        monotonic_arena(monotonic_arena const &) = delete;
+        monotonic_arena & operator=(monotonic_arena const &) = delete;
+        ~monotonic_arena()
+        {
+            release();
+        }
+
+        /// \pre \c align is a power of two.
+        void * allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t))
+        {
+            RANGES_EXPECT(align != 0 && (align & (align - 1)) == 0);
+            if(void * const p = try_allocate_(bytes, align))
+                return p;
+            if(bytes > std::numeric_limits<std::size_t>::max() - align)
+                throw std::bad_alloc{};
+            next_block_(bytes + align);
+            return try_allocate_(bytes, align);
+        }
+        /// Gives the memory back only if it is the most recent allocation.
+        void deallocate(void * p, std::size_t bytes) noexcept
+        {
+            if(static_cast<char *>(p) + bytes == cur_)
+                cur_ = static_cast<char *>(p);
+        }
+        /// Makes all the memory handed out so far available again, without
+        /// returning it to the system.
+        void reset() noexcept
+        {
+            current_ = nullptr;
+            cur_ = end_ = nullptr;
+        }
+        /// Returns all memory to the system.
+        void release() noexcept
+        {
+            reset();
+            while(head_)
+            {
+                block * const next = head_->next;
+                ::operator delete(head_);
+                head_ = next;
+            }
+            next_size_ = initial_size_;
+        }
+        /// The total size of the blocks owned by the arena.
+        std::size_t capacity() const noexcept
+        {
+            std::size_t n = 0;
+            for(block * b = head_; b; b = b->next)
+                n += b->size;
+            return n;
+        }
+    };
+
+    /// An allocator that takes its memory from a `monotonic_arena`.
+    /// Deallocation is almost always free. Containers using it must not
+    /// outlive the arena, nor be used after the arena is reset. A
+    /// default-constructed \c arena_allocator has no arena and uses
+    /// <tt>::operator new</tt>, so that containers using it stay
+    /// default-constructible.
+    template<typename T>
+    struct arena_allocator
+    {
+    private:
+        template<typename U>
+        friend struct arena_allocator;
+        monotonic_arena * arena_ = nullptr;
+
+    public:
+        using value_type = T;
+
+        arena_allocator() = default;
+        arena_allocator(monotonic_arena & arena) noexcept
+          : arena_(&arena)
+        {}
+        template<typename U>
+        arena_allocator(arena_allocator<U> const & that) noexcept
+          : arena_(that.arena_)
+        {}
+        T * allocate(std::size_t n)
+        {
+            if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+                throw std::bad_alloc{};
+            if(!arena_)
+                return static_cast<T *>(::operator new(n * sizeof(T)));
+            return static_cast<T *>(arena_->allocate(n * sizeof(T), alignof(T)));
+        }
+        void deallocate(T * p, std::size_t n) noexcept
+        {
+            if(!arena_)
+                ::operator delete(p);
+            else
+                arena_->deallocate(p, n * sizeof(T));
+        }
+        /// \return The arena, or \c nullptr for a default-constructed allocator.
+        monotonic_arena * arena() const noexcept
+        {
+            return arena_;
+        }
+        template<typename U>
+        friend bool operator==(arena_allocator const & a,
+                               arena_allocator<U> const & b) noexcept
+        {
+            return a.arena() == b.arena();
+        }
+        template<typename U>
+        friend bool operator!=(arena_allocator const & a,
+                               arena_allocator<U> const & b) noexcept
+        {
+            return a.arena() != b.arena();
+        }
+    };
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,348 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_JAGGED_VECTOR_HPP
+#define RANGES_V3_UTILITY_JAGGED_VECTOR_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/iterator/basic_iterator.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/view/span.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        // clang-format off
+        CPP_def
+        (
+            template(typename Rng, typename T)
+            concept JaggedRow,
+                InputRange<Rng> && Constructible<T, range_reference_t<Rng>>
+        );
+
+        // Rows that can be appended with a single vector::insert of a
+        // pointer range.
+        CPP_def
+        (
+            template(typename Rng, typename T)
+            concept ContiguousJaggedRow,
+                ContiguousRange<Rng> && SizedRange<Rng> &&
+                Same<range_value_t<Rng>, T>
+        );
+        // clang-format on
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-utility
+    /// @{
+
+    /// A sequence of variable-length rows stored in compressed sparse row
+    /// form: one contiguous buffer holding the elements of every row, in
+    /// order, and an array of offsets into it. Each row is a `span` into the
+    /// buffer, so the container is a random-access range of contiguous
+    /// ranges that costs two allocations however many rows it holds.
+    /// `values()` is the whole buffer, i.e. every row joined together.
+    /// `view::join` is not specialized for the container and goes through
+    /// its rows one at a time, so use `values()` to read or copy the
+    /// elements of every row at contiguous-range speed.
+    ///
+    /// Rows are appended and removed at the back only. As with
+    /// `std::vector`, growing the container invalidates existing rows and
+    /// iterators.
+    template<typename T, typename Alloc = std::allocator<T>>
+    struct jagged_vector
+    {
+    public:
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = span<T>;
+        using const_reference = span<T const>;
+
+    private:
+        using offset_allocator_type =
+            typename std::allocator_traits<Alloc>::template rebind_alloc<size_type>;
+
+        std::vector<T, Alloc> values_;
+        // offsets_[i] is where row i starts and offsets_[i + 1] where it ends.
+        // Empty when there are no rows.
+        std::vector<size_type, offset_allocator_type> offsets_;
+
+        template<bool Const>
+        struct cursor
+        {
+        private:
+            template<bool>
+            friend struct cursor;
+            using element_t = meta::if_c<Const, T const, T>;
+            element_t * values_ = nullptr;
+            size_type const * offset_ = nullptr;
+
+        public:
+            cursor() = default;
+            cursor(element_t * values, size_type const * offset) noexcept
+              : values_(values)
+              , offset_(offset)
+            {}
+            CPP_template(bool Other)( //
+                requires Const && (!Other)) //
+                cursor(cursor<Other> that) noexcept
+              : values_(that.values_)
+              , offset_(that.offset_)
+            {}
+            span<element_t> read() const noexcept
+            {
+                return {values_ + offset_[0],
+                        static_cast<detail::span_index_t>(offset_[1] - offset_[0])};
+            }
+            void next() noexcept
+            {
+                ++offset_;
+            }
+            void prev() noexcept
+            {
+                --offset_;
+            }
+            void advance(difference_type n) noexcept
+            {
+                offset_ += n;
+            }
+            difference_type distance_to(cursor const & that) const noexcept
+            {
+                return that.offset_ - offset_;
+            }
+            bool equal(cursor const & that) const noexcept
+            {
+                return offset_ == that.offset_;
+            }
+        };
+
+        template<typename Rng>
+        void append_(Rng && row, std::true_type)
+        {
+            auto const first = ranges::data(row);
+            values_.insert(values_.end(), first, first + ranges::size(row));
+        }
+        template<typename Rng>
+        void append_(Rng && row, std::false_type)
+        {
+            auto first = ranges::begin(row);
+            auto const last = ranges::end(row);
+            for(; first != last; ++first)
+                values_.emplace_back(*first);
+        }
+        template<typename I, typename S>
+        void reserve_rows_(I const & first, S const & last, std::true_type)
+        {
+            offsets_.reserve(static_cast<size_type>(last - first) + 1);
+        }
+        template<typename I, typename S>
+        void reserve_rows_(I const &, S const &, std::false_type)
+        {}
+        void end_row_()
+        {
+            if(offsets_.empty())
+                offsets_.push_back(0);
+            offsets_.push_back(values_.size());
+        }
+
+    public:
+        using iterator = basic_iterator<cursor<false>>;
+        using const_iterator = basic_iterator<cursor<true>>;
+
+        jagged_vector() = default;
+        explicit jagged_vector(Alloc const & alloc)
+          : values_(alloc)
+          , offsets_(offset_allocator_type(alloc))
+        {}
+        /// Build the container in one pass over a range of rows, each of
+        /// which is itself traversed once.
+        CPP_template(typename I, typename S)( //
+            requires InputIterator<I> && Sentinel<S, I> &&
+                detail::JaggedRow<iter_reference_t<I>, T>) //
+            jagged_vector(I first, S last, Alloc const & alloc = Alloc{})
+          : jagged_vector(alloc)
+        {
+            assign(std::move(first), std::move(last));
+        }
+        jagged_vector(std::initializer_list<std::initializer_list<T>> rows,
+                      Alloc const & alloc = Alloc{})
+          : jagged_vector(rows.begin(), rows.end(), alloc)
+        {}
+
+        CPP_template(typename I, typename S)( //
+            requires InputIterator<I> && Sentinel<S, I> &&
+                detail::JaggedRow<iter_reference_t<I>, T>) //
+            void assign(I first, S last)
+        {
+            clear();
+            reserve_rows_(first, last, meta::bool_<SizedSentinel<S, I>>{});
+            for(; first != last; ++first)
+                push_back(*first);
+        }
+        /// Reserve room for \c rows rows holding \c values elements in all.
+        void reserve(size_type rows, size_type values = 0)
+        {
+            offsets_.reserve(rows + 1);
+            values_.reserve(values);
+        }
+        void shrink_to_fit()
+        {
+            offsets_.shrink_to_fit();
+            values_.shrink_to_fit();
+        }
+        void clear() noexcept
+        {
+            offsets_.clear();
+            values_.clear();
+        }
+
+        /// Append a copy of \c row as the last row.
+        template<typename Rng>
+        auto push_back(Rng && row) -> CPP_ret(void)( //
+            requires detail::JaggedRow<Rng, T>)
+        {
+            append_(row, meta::bool_<detail::ContiguousJaggedRow<Rng, T>>{});
+            end_row_();
+        }
+        void push_back(std::initializer_list<T> row)
+        {
+            values_.insert(values_.end(), row.begin(), row.end());
+            end_row_();
+        }
+        /// Append an empty row, to be filled with `push_back_value`.
+        void push_back_row()
+        {
+            end_row_();
+        }
+        /// Append \c value to the last row.
+        template<typename... Args>
+        void push_back_value(Args &&... args)
+        {
+            RANGES_EXPECT(!empty());
+            values_.emplace_back(static_cast<Args &&>(args)...);
+            ++offsets_.back();
+        }
+        void pop_back()
+        {
+            RANGES_EXPECT(!empty());
+            offsets_.pop_back();
+            values_.resize(offsets_.back());
+            if(offsets_.size() == 1)
+                offsets_.clear();
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator{cursor<false>{values_.data(), offsets_.data()}};
+        }
+        iterator end() noexcept
+        {
+            return iterator{cursor<false>{values_.data(), offsets_.data() + size()}};
+        }
+        const_iterator begin() const noexcept
+        {
+            return const_iterator{cursor<true>{values_.data(), offsets_.data()}};
+        }
+        const_iterator end() const noexcept
+        {
+            return const_iterator{
+                cursor<true>{values_.data(), offsets_.data() + size()}};
+        }
+
+        /// The number of rows.
+        size_type size() const noexcept
+        {
+            return offsets_.empty() ? 0 : offsets_.size() - 1;
+        }
+        bool empty() const noexcept
+        {
+            return offsets_.empty();
+        }
+        reference operator[](size_type i) noexcept
+        {
+            RANGES_EXPECT(i < size());
+            return begin()[static_cast<difference_type>(i)];
+        }
+        const_reference operator[](size_type i) const noexcept
+        {
+            RANGES_EXPECT(i < size());
+            return begin()[static_cast<difference_type>(i)];
+        }
+        reference back() noexcept
+        {
+            return (*this)[size() - 1];
+        }
+        const_reference back() const noexcept
+        {
+            return (*this)[size() - 1];
+        }
+
+        /// Every element of every row, in order.
+        span<T> values() noexcept
+        {
+            return {values_.data(), static_cast<detail::span_index_t>(values_.size())};
+        }
+        span<T const> values() const noexcept
+        {
+            return {values_.data(), static_cast<detail::span_index_t>(values_.size())};
+        }
+        /// The `size() + 1` row boundaries in `values()`, or nothing when
+        /// there are no rows.
+        span<size_type const> offsets() const noexcept
+        {
+            return {offsets_.data(), static_cast<detail::span_index_t>(offsets_.size())};
+        }
+
+        allocator_type get_allocator() const
+        {
+            return values_.get_allocator();
+        }
+        void swap(jagged_vector & that) noexcept
+        {
+            values_.swap(that.values_);
+            offsets_.swap(that.offsets_);
+        }
+        friend void swap(jagged_vector & a, jagged_vector & b) noexcept
+        {
+            a.swap(b);
+        }
+        friend bool operator==(jagged_vector const & a, jagged_vector const & b)
+        {
+            return a.offsets_ == b.offsets_ && a.values_ == b.values_;
+        }
+        friend bool operator!=(jagged_vector const & a, jagged_vector const & b)
+        {
+            return !(a == b);
+        }
+    };
+    /// @}
+} // namespace ranges
+
+#endif
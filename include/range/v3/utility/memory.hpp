@@ -42,8 +42,7 @@ namespace ranges
         std::pair<T *, std::ptrdiff_t> get_temporary_buffer_impl(
             std::size_t count) noexcept
         {
-            RANGES_EXPECT(count >= 0);
-            std::size_t n = static_cast<std::size_t>(count);
+            std::size_t n = count;
             if(n > PTRDIFF_MAX / sizeof(T))
                 n = PTRDIFF_MAX / sizeof(T);
 
@@ -0,0 +1,183 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_PARALLEL_HPP
+#define RANGES_V3_UTILITY_PARALLEL_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <range/v3/detail/config.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-utility
+    /// @{
+
+    /// An execution policy requesting that an algorithm spread its work over
+    /// several threads. \c concurrency is the maximum number of threads to use
+    /// (0 means \c std::thread::hardware_concurrency()), and \c grain is the
+    /// minimum number of elements worth handing to a thread (0 means the
+    /// algorithm's own default).
+    struct parallel_policy
+    {
+        std::size_t concurrency = 0;
+        std::size_t grain = 0;
+
+        /// \return A copy of this policy with the given thread count and grain.
+        constexpr parallel_policy operator()(std::size_t threads,
+                                             std::size_t min_grain = 0) const noexcept
+        {
+            return parallel_policy{threads, min_grain};
+        }
+    };
+
+    /// \ingroup group-utility
+    /// \sa `parallel_policy`
+    RANGES_INLINE_VARIABLE(parallel_policy, par)
+
+    /// \cond
+    namespace detail
+    {
+        /// The default grain of the parallel algorithms that filter, partition
+        /// or merge sequences, which do little work per element.
+        constexpr std::size_t compact_grain = std::size_t{1} << 14;
+
+        /// The number of blocks into which \c n elements should be split when
+        /// running under the policy \c pol, given that blocks of fewer than
+        /// \c default_grain elements are not worth a thread of their own.
+        inline std::size_t parallel_block_count(parallel_policy pol, std::size_t n,
+                                                std::size_t default_grain) noexcept
+        {
+            std::size_t threads =
+                pol.concurrency ? pol.concurrency : std::thread::hardware_concurrency();
+            std::size_t const grain = pol.grain ? pol.grain : default_grain;
+            if(threads == 0)
+                threads = 1;
+            if(grain > 1 && n / grain < threads)
+                threads = n / grain;
+            if(threads > n)
+                threads = n;
+            return threads ? threads : 1;
+        }
+
+        /// The half-open bounds of the \c i -th of \c count nearly equal blocks
+        /// of <tt>[0, n)</tt>.
+        inline std::pair<std::size_t, std::size_t> parallel_block_bounds(
+            std::size_t n, std::size_t count, std::size_t i) noexcept
+        {
+            RANGES_EXPECT(i < count);
+            std::size_t const q = n / count, r = n % count;
+            std::size_t const lo = i * q + (i < r ? i : r);
+            return {lo, lo + q + (i < r)};
+        }
+
+        /// Calls \c fun(i) for every \c i in <tt>[0, count)</tt>, each on its own
+        /// thread except \c fun(0), which runs on the calling thread. Returns
+        /// when all calls have finished. If a thread cannot be started, its
+        /// work is done on the calling thread instead. The first exception
+        /// thrown by any call is rethrown.
+        template<typename Fun>
+        void parallel_invoke_n(std::size_t count, Fun && fun)
+        {
+            if(count <= 1)
+            {
+                if(count)
+                    fun(std::size_t{0});
+                return;
+            }
+            std::vector<std::exception_ptr> errors(count);
+            auto run = [&](std::size_t i) noexcept {
+                try
+                {
+                    fun(i);
+                }
+                catch(...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            };
+            std::vector<std::thread> threads;
+            std::size_t started = 1;
+            try
+            {
+                threads.reserve(count - 1);
+                for(; started < count; ++started)
+                    threads.emplace_back(run, started);
+            }
+            catch(...)
+            {}
+            for(std::size_t i = started; i < count; ++i)
+                run(i);
+            run(0);
+            for(auto & t : threads)
+                t.join();
+            for(auto & e : errors)
+                if(e)
+                    std::rethrow_exception(e);
+        }
+
+        /// The number of elements a thread of a parallel search tests before
+        /// it checks whether another thread has found a match first.
+        constexpr std::size_t search_grain = std::size_t{1} << 14;
+
+        /// The least \c i in <tt>[0, n)</tt> at which there is a match, or \c n
+        /// if there is none, where <tt>test(lo, hi)</tt> returns the first
+        /// match in <tt>[lo, hi)</tt>, or \c hi. Splits <tt>[0, n)</tt> into
+        /// chunks of \c pol.grain elements, or \c search_grain, which the
+        /// threads take in turn, so that they all work near the front. The
+        /// lowest match found so far is kept in an atomic, and a thread stops
+        /// at its first match, or at a chunk past the lowest match. When
+        /// \c any is set, the threads stop at any match, and the result is
+        /// some match rather than the first.
+        template<typename Test>
+        std::size_t parallel_find_first(parallel_policy pol, std::size_t n, Test && test,
+                                        bool any = false)
+        {
+            std::size_t const chunk = pol.grain ? pol.grain : search_grain;
+            std::size_t const count = parallel_block_count(pol, n, chunk);
+            if(count <= 1)
+                return test(std::size_t{0}, n);
+            std::size_t const chunks = (n - 1) / chunk + 1;
+            std::atomic<std::size_t> found{n};
+            parallel_invoke_n(count, [&](std::size_t t) {
+                for(std::size_t c = t; c < chunks; c += count)
+                {
+                    std::size_t const lo = c * chunk;
+                    std::size_t const hi = n - lo > chunk ? lo + chunk : n;
+                    std::size_t best = found.load(std::memory_order_relaxed);
+                    if(any ? best != n : lo >= best)
+                        return;
+                    std::size_t const i = test(lo, hi);
+                    if(i != hi)
+                    {
+                        while(i < best &&
+                              !found.compare_exchange_weak(
+                                  best, i, std::memory_order_relaxed))
+                        {}
+                        return;
+                    }
+                }
+            });
+            return found.load(std::memory_order_relaxed);
+        }
+    } // namespace detail
+    /// \endcond
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,247 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_SCRATCH_BUFFER_HPP
+#define RANGES_V3_UTILITY_SCRATCH_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include <range/v3/detail/config.hpp>
+#include <range/v3/utility/memory.hpp>
+
+#if defined(__linux__) && !defined(RANGES_NO_HUGE_PAGES)
+#include <sys/mman.h>
+#define RANGES_HUGE_PAGES 1
+#endif
+
+namespace ranges
+{
+    /// \addtogroup group-utility
+    /// @{
+
+    /// How a `scratch_buffer` gets its memory from the system.
+    enum class scratch_pages
+    {
+        /// With <tt>::operator new</tt>.
+        normal,
+        /// On Linux, buffers of a huge page (2 MiB) or more are mapped at a
+        /// huge page boundary and marked for transparent huge pages, which
+        /// saves TLB misses when they are large; elsewhere, as \c normal.
+        huge
+    };
+
+    /// Memory for the temporary buffers of `stable_sort`, `stable_partition`
+    /// and `inplace_merge`, which take one as their first argument, that is
+    /// kept from one call to the next. The buffer only grows, so that after
+    /// the first few calls it no longer allocates. It can start out as
+    /// storage given by the caller, like an array on the stack, which it uses
+    /// until a call needs more and never frees. It holds no objects between
+    /// calls, and is not thread-safe: give each thread its own.
+    struct scratch_buffer
+    {
+    private:
+        enum class source : unsigned char
+        {
+            none,
+            caller,
+            heap,
+            mapped
+        };
+        static constexpr std::size_t huge_page_size = std::size_t{1} << 21;
+
+        void * data_ = nullptr;
+        std::size_t size_ = 0;
+        void * mapping_ = nullptr;
+        std::size_t mapping_size_ = 0;
+        source source_ = source::none;
+        scratch_pages pages_ = scratch_pages::normal;
+
+        void free_() noexcept
+        {
+#ifdef RANGES_HUGE_PAGES
+            if(source_ == source::mapped)
+                ::munmap(mapping_, mapping_size_);
+#endif
+            if(source_ == source::heap)
+                ::operator delete(data_);
+            data_ = mapping_ = nullptr;
+            size_ = mapping_size_ = 0;
+            source_ = source::none;
+        }
+#ifdef RANGES_HUGE_PAGES
+        // Maps bytes rounded up to whole huge pages, at a huge page boundary.
+        bool map_(std::size_t bytes) noexcept
+        {
+            std::size_t const size = (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+            if(size < bytes || size + huge_page_size < size)
+                return false;
+            std::size_t const span = size + huge_page_size;
+            void * const p = ::mmap(nullptr, span, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(p == MAP_FAILED)
+                return false;
+            auto const addr = reinterpret_cast<std::uintptr_t>(p);
+            std::size_t const head =
+                (huge_page_size - addr % huge_page_size) % huge_page_size;
+            char * const aligned = static_cast<char *>(p) + head;
+            if(head)
+                ::munmap(p, head);
+            if(span - head > size)
+                ::munmap(aligned + size, span - head - size);
+#ifdef MADV_HUGEPAGE
+            ::madvise(aligned, size, MADV_HUGEPAGE);
+#endif
+            free_();
+            data_ = mapping_ = aligned;
+            size_ = mapping_size_ = size;
+            source_ = source::mapped;
+            return true;
+        }
+#endif
+        bool allocate_(std::size_t bytes) noexcept
+        {
+#ifdef RANGES_HUGE_PAGES
+            if(pages_ == scratch_pages::huge && bytes >= huge_page_size && map_(bytes))
+                return true;
+#endif
+            void * const p = ::operator new(bytes, std::nothrow);
+            if(!p)
+                return false;
+            free_();
+            data_ = p;
+            size_ = bytes;
+            source_ = source::heap;
+            return true;
+        }
+
+    public:
+        scratch_buffer() = default;
+        explicit scratch_buffer(scratch_pages pages) noexcept
+          : pages_(pages)
+        {}
+        /// Starts out with the \c bytes bytes at \c storage, which must
+        /// outlive the buffer or its first growth.
+        scratch_buffer(void * storage, std::size_t bytes,
+                       scratch_pages pages = scratch_pages::normal) noexcept
+          : data_(storage)
+          , size_(storage ? bytes : 0)
+          , source_(storage ? source::caller : source::none)
+          , pages_(pages)
+        {}
+        scratch_buffer(scratch_buffer && that) noexcept
+          : data_(that.data_)
+          , size_(that.size_)
+          , mapping_(that.mapping_)
+          , mapping_size_(that.mapping_size_)
+          , source_(that.source_)
+          , pages_(that.pages_)
+        {
+            that.data_ = that.mapping_ = nullptr;
+            that.size_ = that.mapping_size_ = 0;
+            that.source_ = source::none;
+        }
+        scratch_buffer & operator=(scratch_buffer && that) noexcept
+        {
+            if(this != &that)
+            {
+                free_();
+                data_ = that.data_;
+                size_ = that.size_;
+                mapping_ = that.mapping_;
+                mapping_size_ = that.mapping_size_;
+                source_ = that.source_;
+                pages_ = that.pages_;
+                that.data_ = that.mapping_ = nullptr;
+                that.size_ = that.mapping_size_ = 0;
+                that.source_ = source::none;
+            }
+            return *this;
+        }
+        ~scratch_buffer()
+        {
+            free_();
+        }
+
+        void * data() const noexcept
+        {
+            return data_;
+        }
+        /// The size of the buffer in bytes.
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+        /// Makes the buffer at least \c bytes long. When it must grow, it at
+        /// least doubles, and its contents are lost.
+        /// \return \c false, leaving the buffer as it was, if there is no
+        /// memory for it.
+        bool reserve(std::size_t bytes) noexcept
+        {
+            if(bytes <= size_)
+                return true;
+            std::size_t const twice = size_ * 2;
+            return (twice > bytes && allocate_(twice)) || allocate_(bytes);
+        }
+        /// Returns the memory to the system, or to the caller that gave it.
+        void release() noexcept
+        {
+            free_();
+        }
+        /// Uninitialized storage for \c n objects of type \c T, or as many as
+        /// fit if the buffer cannot grow, like `std::get_temporary_buffer`.
+        template<typename T>
+        std::pair<T *, std::ptrdiff_t> get(std::ptrdiff_t n) noexcept
+        {
+            RANGES_EXPECT(n >= 0);
+            if(n <= 0)
+                return {nullptr, 0};
+            std::size_t const limit = (PTRDIFF_MAX - alignof(T)) / sizeof(T);
+            std::size_t const count =
+                static_cast<std::size_t>(n) < limit ? static_cast<std::size_t>(n) : limit;
+            void * p = data_;
+            std::size_t space = size_;
+            if(!p || !std::align(alignof(T), count * sizeof(T), p, space))
+            {
+                reserve(count * sizeof(T) + alignof(T) - 1);
+                p = data_;
+                space = size_;
+                if(!p || !std::align(alignof(T), sizeof(T), p, space))
+                    return {nullptr, 0};
+            }
+            std::size_t const fit = space / sizeof(T);
+            return {static_cast<T *>(p),
+                    static_cast<std::ptrdiff_t>(fit < count ? fit : count)};
+        }
+    };
+
+    /// \cond
+    namespace detail
+    {
+        // Storage from scratch if it is not null, or else a temporary buffer
+        // that the caller must return.
+        template<typename T, typename D>
+        std::pair<T *, std::ptrdiff_t> get_temporary_buffer(scratch_buffer * scratch,
+                                                            D count) noexcept
+        {
+            return scratch ? scratch->get<T>(static_cast<std::ptrdiff_t>(count))
+                           : detail::get_temporary_buffer<T>(count);
+        }
+    } // namespace detail
+    /// \endcond
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,229 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_SOA_VECTOR_HPP
+#define RANGES_V3_UTILITY_SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/utility/common_tuple.hpp>
+#include <range/v3/utility/tuple_algorithm.hpp>
+#include <range/v3/view/span.hpp>
+#include <range/v3/view/zip.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-utility
+    /// @{
+
+    /// A sequence of rows <tt>(T0, T1, ...)</tt> stored as one contiguous
+    /// column per element type. `column<I>()` is a `span` over the \c I -th
+    /// column, and the container itself is the random-access range
+    /// <tt>view::zip(column<0>(), column<1>(), ...)</tt>, whose iterators
+    /// hold a single index for all the columns. Sorting it, or any other
+    /// zip of its columns, permutes every column together.
+    ///
+    /// Each column is a `std::vector`, so `bool` columns are not allowed:
+    /// they would not be contiguous.
+    template<typename... Ts>
+    struct soa_vector
+    {
+        static_assert(sizeof...(Ts) != 0, "soa_vector needs at least one column");
+        static_assert(meta::and_c<!std::is_same<Ts, bool>::value...>::value,
+                      "soa_vector columns cannot be bool; use a one-byte integer");
+
+    private:
+        using columns_t = meta::list<Ts...>;
+        using indices_t = meta::make_index_sequence<sizeof...(Ts)>;
+        std::tuple<std::vector<Ts>...> columns_;
+
+        template<std::size_t... Is>
+        zip_view<span<Ts>...> rows_(meta::index_sequence<Is...>) noexcept
+        {
+            return zip_view<span<Ts>...>{column<Is>()...};
+        }
+        template<std::size_t... Is>
+        zip_view<span<Ts const>...> rows_(meta::index_sequence<Is...>) const noexcept
+        {
+            return zip_view<span<Ts const>...>{column<Is>()...};
+        }
+        template<std::size_t... Is, typename... Us>
+        void emplace_back_(meta::index_sequence<Is...>, Us &&... us)
+        {
+            std::size_t done = 0;
+            try
+            {
+                (void)std::initializer_list<int>{
+                    (std::get<Is>(columns_).emplace_back(static_cast<Us &&>(us)),
+                     ++done,
+                     0)...};
+            }
+            catch(...)
+            {
+                (void)std::initializer_list<int>{
+                    (Is < done ? std::get<Is>(columns_).pop_back() : void(), 0)...};
+                throw;
+            }
+        }
+
+    public:
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = common_tuple<Ts &...>;
+        using const_reference = common_tuple<Ts const &...>;
+        using iterator = iterator_t<zip_view<span<Ts>...> const>;
+        using const_iterator = iterator_t<zip_view<span<Ts const>...> const>;
+
+        /// The element type of the \c I -th column.
+        template<std::size_t I>
+        using column_type = meta::at_c<columns_t, I>;
+
+        soa_vector() = default;
+        explicit soa_vector(size_type n)
+        {
+            resize(n);
+        }
+
+        size_type size() const noexcept
+        {
+            return std::get<0>(columns_).size();
+        }
+        bool empty() const noexcept
+        {
+            return std::get<0>(columns_).empty();
+        }
+        void reserve(size_type n)
+        {
+            tuple_for_each(columns_, [n](auto & col) { col.reserve(n); });
+        }
+        void resize(size_type n)
+        {
+            tuple_for_each(columns_, [n](auto & col) { col.resize(n); });
+        }
+        void shrink_to_fit()
+        {
+            tuple_for_each(columns_, [](auto & col) { col.shrink_to_fit(); });
+        }
+        void clear() noexcept
+        {
+            tuple_for_each(columns_, [](auto & col) { col.clear(); });
+        }
+
+        /// Append the row <tt>(us...)</tt>, one value per column. If
+        /// constructing any of them throws, the container is unchanged.
+        template<typename... Us>
+        auto emplace_back(Us &&... us) -> CPP_ret(void)( //
+            requires(sizeof...(Us) == sizeof...(Ts)) && And<Constructible<Ts, Us>...>)
+        {
+            emplace_back_(indices_t{}, static_cast<Us &&>(us)...);
+        }
+        void push_back(Ts const &... ts)
+        {
+            emplace_back_(indices_t{}, ts...);
+        }
+        void pop_back()
+        {
+            RANGES_EXPECT(!empty());
+            tuple_for_each(columns_, [](auto & col) { col.pop_back(); });
+        }
+
+        /// The \c I -th column.
+        template<std::size_t I>
+        span<column_type<I>> column() noexcept
+        {
+            auto & col = std::get<I>(columns_);
+            return {col.data(), static_cast<detail::span_index_t>(col.size())};
+        }
+        /// \overload
+        template<std::size_t I>
+        span<column_type<I> const> column() const noexcept
+        {
+            auto & col = std::get<I>(columns_);
+            return {col.data(), static_cast<detail::span_index_t>(col.size())};
+        }
+        /// All the columns, zipped.
+        zip_view<span<Ts>...> rows() noexcept
+        {
+            return rows_(indices_t{});
+        }
+        /// \overload
+        zip_view<span<Ts const>...> rows() const noexcept
+        {
+            return rows_(indices_t{});
+        }
+
+        // The zip views are copied to const locals so that the iterators
+        // hold their (empty) function object by value rather than referring
+        // to the temporary.
+        iterator begin() noexcept
+        {
+            auto const rng = rows();
+            return rng.begin();
+        }
+        iterator end() noexcept
+        {
+            auto const rng = rows();
+            return rng.end();
+        }
+        const_iterator begin() const noexcept
+        {
+            auto const rng = rows();
+            return rng.begin();
+        }
+        const_iterator end() const noexcept
+        {
+            auto const rng = rows();
+            return rng.end();
+        }
+        reference operator[](size_type i) noexcept
+        {
+            RANGES_EXPECT(i < size());
+            return begin()[static_cast<difference_type>(i)];
+        }
+        const_reference operator[](size_type i) const noexcept
+        {
+            RANGES_EXPECT(i < size());
+            return begin()[static_cast<difference_type>(i)];
+        }
+
+        void swap(soa_vector & that) noexcept
+        {
+            columns_.swap(that.columns_);
+        }
+        friend void swap(soa_vector & a, soa_vector & b) noexcept
+        {
+            a.swap(b);
+        }
+        friend bool operator==(soa_vector const & a, soa_vector const & b)
+        {
+            return a.columns_ == b.columns_;
+        }
+        friend bool operator!=(soa_vector const & a, soa_vector const & b)
+        {
+            return !(a == b);
+        }
+    };
+    /// @}
+} // namespace ranges
+
+#endif
@@ -23,6 +23,8 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/adjacent_remove_if.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/any_view.hpp>
+#include <range/v3/view/async_stage.hpp>
+#include <range/v3/view/cache1.hpp>
 #include <range/v3/view/c_str.hpp>
 #include <range/v3/view/cartesian_product.hpp>
 #include <range/v3/view/chunk.hpp>
@@ -32,6 +34,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/cycle.hpp>
 #include <range/v3/view/delimit.hpp>
+#include <range/v3/view/distinct.hpp>
 #include <range/v3/view/drop.hpp>
 #include <range/v3/view/drop_exactly.hpp>
 #include <range/v3/view/drop_last.hpp>
@@ -39,6 +42,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/empty.hpp>
 #include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/exclusive_scan.hpp>
+#include <range/v3/view/external_sort.hpp>
 #include <range/v3/view/facade.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/for_each.hpp>
@@ -47,14 +51,19 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/getlines.hpp>
 #include <range/v3/view/group_by.hpp>
 #include <range/v3/view/indices.hpp>
+#include <range/v3/view/indexed_scan.hpp>
 #include <range/v3/view/indirect.hpp>
 #include <range/v3/view/intersperse.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/istream.hpp>
 #include <range/v3/view/join.hpp>
+#include <range/v3/view/join_random_access.hpp>
+#include <range/v3/view/lex.hpp>
 #include <range/v3/view/linear_distribute.hpp>
 #include <range/v3/view/map.hpp>
+#include <range/v3/view/memoize.hpp>
 #include <range/v3/view/move.hpp>
+#include <range/v3/view/par_transform.hpp>
 #include <range/v3/view/partial_sum.hpp>
 #include <range/v3/view/ref.hpp>
 #include <range/v3/view/remove_if.hpp>
@@ -0,0 +1,583 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_ASYNC_STAGE_HPP
+#define RANGES_V3_VIEW_ASYNC_STAGE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/functional/pipeable.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// Whether a `view::async_stage` with more than one thread delivers the
+    /// elements in the order of the source, or in the order its threads
+    /// finish them.
+    enum class async_order
+    {
+        ordered,
+        unordered
+    };
+
+    /// \cond
+    namespace detail
+    {
+        // Waits for another thread: spins at first, then yields, then sleeps,
+        // so that a short wait is cheap and a long one does not burn a core.
+        struct async_backoff
+        {
+            unsigned n_ = 0;
+
+            void operator()()
+            {
+                if(n_ < 64)
+                    ++n_;
+                else if(n_ < 128)
+                {
+                    ++n_;
+                    std::this_thread::yield();
+                }
+                else
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        };
+
+        // A bounded ring of T without locks, after Vyukov's bounded queue.
+        // Every write and read has a ticket, and each slot records the ticket
+        // it awaits, doubled so that a full slot and an empty one never look
+        // alike, even with one slot: a writer with ticket t may construct
+        // into slot t % capacity once its sequence is 2t, and publishes
+        // 2t + 1; the one reader of ticket t waits for 2t + 1, moves the
+        // value out and publishes 2(t + capacity) for the next writer. Writers
+        // may finish in any order and the reader still sees them in ticket
+        // order, and a writer whose slot has not been read yet waits, which
+        // is the backpressure.
+        template<typename T>
+        struct async_ring
+        {
+        private:
+            struct slot
+            {
+                std::atomic<std::size_t> seq_;
+                meta::_t<std::aligned_storage<sizeof(T), alignof(T)>> buf_;
+
+                T * get() noexcept
+                {
+                    return static_cast<T *>(static_cast<void *>(&buf_));
+                }
+            };
+
+            std::unique_ptr<slot[]> slots_;
+            std::size_t capacity_;
+
+            slot & at(std::size_t t) const noexcept
+            {
+                return slots_[t % capacity_];
+            }
+
+        public:
+            // \pre capacity > 0
+            explicit async_ring(std::size_t capacity)
+              : slots_(new slot[capacity])
+              , capacity_(capacity)
+            {
+                RANGES_EXPECT(capacity > 0);
+                for(std::size_t i = 0; i < capacity; ++i)
+                    slots_[i].seq_.store(2 * i, std::memory_order_relaxed);
+            }
+            async_ring(async_ring const &) = delete;
+            async_ring & operator=(async_ring const &) = delete;
+            // Destroys the values that were written and never read. There must
+            // be no writer or reader left.
+            ~async_ring()
+            {
+                for(std::size_t i = 0; i < capacity_; ++i)
+                    if(slots_[i].seq_.load(std::memory_order_relaxed) % 2 == 1)
+                        slots_[i].get()->~T();
+            }
+            bool writable(std::size_t t) const noexcept
+            {
+                return at(t).seq_.load(std::memory_order_acquire) == 2 * t;
+            }
+            bool readable(std::size_t t) const noexcept
+            {
+                return at(t).seq_.load(std::memory_order_acquire) == 2 * t + 1;
+            }
+            // \pre writable(t)
+            void write(std::size_t t, T && value)
+            {
+                slot & s = at(t);
+                ::new(static_cast<void *>(s.get())) T(std::move(value));
+                s.seq_.store(2 * t + 1, std::memory_order_release);
+            }
+            // Moves the value with ticket t into out, and frees its slot even
+            // if the move throws. \pre readable(t)
+            void read(std::size_t t, optional<T> & out)
+            {
+                struct release
+                {
+                    slot & s_;
+                    std::size_t seq_;
+
+                    ~release()
+                    {
+                        s_.get()->~T();
+                        s_.seq_.store(seq_, std::memory_order_release);
+                    }
+                } r{at(t), 2 * (t + capacity_)};
+                out.reset();
+                out.emplace(std::move(*r.s_.get()));
+            }
+        };
+
+        // Makes the value of an element from its reference.
+        template<typename T>
+        struct async_stage_copy
+        {
+            template<typename U>
+            T operator()(U && u) const
+            {
+                return T(static_cast<U &&>(u));
+            }
+        };
+
+        // The element of an input range is read into a copy that belongs to
+        // the thread, so the function may take it as an rvalue if it can.
+        template<typename Fun, typename T>
+        auto async_invoke_owned(Fun const & fun, T & t)
+            -> CPP_ret(invoke_result_t<Fun const &, T>)( //
+                requires Invocable<Fun const &, T>)
+        {
+            return invoke(fun, std::move(t));
+        }
+        template<typename Fun, typename T>
+        auto async_invoke_owned(Fun const & fun, T & t)
+            -> CPP_ret(invoke_result_t<Fun const &, T &>)( //
+                requires(!Invocable<Fun const &, T>))
+        {
+            return invoke(fun, t);
+        }
+
+        // What an async_stage_view or a par_transform_view shares with its
+        // threads. The threads take positions from the source under a lock,
+        // apply Fun to the elements, and write the results to the ring; the
+        // consumer reads the ring. In ordered mode a thread gets its ticket
+        // with its position, so the results come out in source order; in
+        // unordered mode it gets one when its result is ready. The last
+        // thread to leave publishes how many tickets there were, and a
+        // failure publishes the ticket it failed at, so the consumer stops
+        // there and rethrows.
+        template<typename Rng, typename Fun>
+        struct async_stage_state
+        {
+        private:
+            using value_type_ = range_value_t<Rng>;
+            using result_type_ =
+                detail::decay_t<invoke_result_t<Fun const &, range_reference_t<Rng>>>;
+
+            Rng rng_;
+            Fun fun_;
+            iterator_t<Rng> it_;
+            sentinel_t<Rng> end_;
+            async_order order_;
+            async_ring<result_type_> ring_;
+            std::mutex claim_mutex_;
+            bool exhausted_ = false;
+            std::atomic<std::size_t> tickets_{0};
+            std::atomic<std::size_t> last_{static_cast<std::size_t>(-1)};
+            std::atomic<std::size_t> live_{0};
+            std::atomic<bool> stop_{false};
+            std::mutex error_mutex_;
+            std::exception_ptr error_;
+            std::size_t error_ticket_ = static_cast<std::size_t>(-1);
+            std::vector<std::thread> threads_;
+            // The consumer's.
+            std::size_t next_ticket_ = 0;
+            optional<result_type_> current_;
+
+            void lower_last_(std::size_t t) noexcept
+            {
+                std::size_t last = last_.load(std::memory_order_relaxed);
+                while(t < last && !last_.compare_exchange_weak(
+                                      last, t, std::memory_order_release,
+                                      std::memory_order_relaxed))
+                {}
+            }
+            void fail_(std::size_t t) noexcept
+            {
+                std::lock_guard<std::mutex> lock(error_mutex_);
+                if(!error_ || t < error_ticket_)
+                {
+                    error_ = std::current_exception();
+                    error_ticket_ = t;
+                }
+            }
+
+            // Under the claim lock. The element of a forward range can be read
+            // later from a copy of the iterator, by all the threads at once;
+            // that of an input range is gone once the iterator moves.
+            void claim_(optional<iterator_t<Rng>> & pos, optional<value_type_> &,
+                        std::true_type)
+            {
+                pos.emplace(it_);
+                ++it_;
+            }
+            void claim_(optional<iterator_t<Rng>> &, optional<value_type_> & value,
+                        std::false_type)
+            {
+                value.emplace(*it_);
+                ++it_;
+            }
+            void apply_(optional<iterator_t<Rng>> & pos, optional<value_type_> &,
+                        optional<result_type_> & result, std::true_type)
+            {
+                result.emplace(invoke(fun_, **pos));
+            }
+            void apply_(optional<iterator_t<Rng>> &, optional<value_type_> & value,
+                        optional<result_type_> & result, std::false_type)
+            {
+                result.emplace(detail::async_invoke_owned(fun_, *value));
+            }
+
+            // False if the view is being destroyed.
+            bool wait_writable_(std::size_t t) const noexcept
+            {
+                async_backoff wait;
+                while(!ring_.writable(t))
+                {
+                    if(stop_.load(std::memory_order_relaxed))
+                        return false;
+                    wait();
+                }
+                return true;
+            }
+
+            void work_() noexcept
+            {
+                using forward = meta::bool_<(bool)ForwardRange<Rng>>;
+                for(;;)
+                {
+                    optional<iterator_t<Rng>> pos;
+                    optional<value_type_> value;
+                    optional<result_type_> result;
+                    std::size_t t = 0;
+                    {
+                        std::lock_guard<std::mutex> lock(claim_mutex_);
+                        if(exhausted_ || stop_.load(std::memory_order_relaxed))
+                            break;
+                        t = tickets_.load(std::memory_order_relaxed);
+                        try
+                        {
+                            if(it_ == end_)
+                            {
+                                exhausted_ = true;
+                                break;
+                            }
+                            claim_(pos, value, forward{});
+                        }
+                        catch(...)
+                        {
+                            // If the increment threw, the element was taken
+                            // before it and is still delivered. In unordered
+                            // mode, the elements claimed before may not have
+                            // their tickets yet, so the last thread out
+                            // publishes where they end.
+                            exhausted_ = true;
+                            bool const taken = pos || value;
+                            if(order_ == async_order::ordered)
+                            {
+                                fail_(t + taken);
+                                lower_last_(t + taken);
+                            }
+                            else
+                                fail_(static_cast<std::size_t>(-1));
+                            if(!taken)
+                                break;
+                        }
+                        if(order_ == async_order::ordered)
+                            tickets_.store(t + 1, std::memory_order_relaxed);
+                    }
+                    try
+                    {
+                        apply_(pos, value, result, forward{});
+                    }
+                    catch(...)
+                    {
+                        if(order_ == async_order::ordered)
+                        {
+                            fail_(t);
+                            lower_last_(t);
+                        }
+                        else
+                            fail_(static_cast<std::size_t>(-1));
+                        std::lock_guard<std::mutex> lock(claim_mutex_);
+                        exhausted_ = true;
+                        break;
+                    }
+                    if(order_ == async_order::unordered)
+                        t = tickets_.fetch_add(1, std::memory_order_relaxed);
+                    if(!wait_writable_(t))
+                        break;
+                    try
+                    {
+                        ring_.write(t, std::move(*result));
+                    }
+                    catch(...)
+                    {
+                        fail_(t);
+                        lower_last_(t);
+                        std::lock_guard<std::mutex> lock(claim_mutex_);
+                        exhausted_ = true;
+                        break;
+                    }
+                }
+                // Once a thread leaves, no more positions are handed out, so
+                // the last one out knows every ticket there will be.
+                if(live_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    lower_last_(tickets_.load(std::memory_order_relaxed));
+            }
+
+        public:
+            async_stage_state(Rng rng, Fun fun, std::size_t threads, std::size_t depth,
+                              async_order order)
+              : rng_(std::move(rng))
+              , fun_(std::move(fun))
+              , it_(ranges::begin(rng_))
+              , end_(ranges::end(rng_))
+              , order_(order)
+              , ring_(depth)
+            {
+                threads_.reserve(threads);
+                for(std::size_t i = 0; i < threads; ++i)
+                {
+                    live_.fetch_add(1, std::memory_order_relaxed);
+                    try
+                    {
+                        threads_.emplace_back([this] { work_(); });
+                    }
+                    catch(...)
+                    {
+                        // Make do with the threads there are, if any.
+                        if(live_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                            lower_last_(tickets_.load(std::memory_order_relaxed));
+                        if(threads_.empty())
+                            throw;
+                        break;
+                    }
+                }
+            }
+            async_stage_state(async_stage_state const &) = delete;
+            async_stage_state & operator=(async_stage_state const &) = delete;
+            ~async_stage_state()
+            {
+                stop_.store(true, std::memory_order_relaxed);
+                for(auto & t : threads_)
+                    t.join();
+            }
+
+            result_type_ & current() noexcept
+            {
+                return *current_;
+            }
+            bool done() const noexcept
+            {
+                return !current_;
+            }
+            // Waits for the next element, or for the end; rethrows what the
+            // source threw, after the elements that came before it.
+            void next()
+            {
+                async_backoff wait;
+                while(!ring_.readable(next_ticket_))
+                {
+                    if(next_ticket_ >= last_.load(std::memory_order_acquire))
+                    {
+                        current_.reset();
+                        std::lock_guard<std::mutex> lock(error_mutex_);
+                        if(error_)
+                            std::rethrow_exception(error_);
+                        return;
+                    }
+                    wait();
+                }
+                ring_.read(next_ticket_, current_);
+                ++next_ticket_;
+            }
+        };
+    } // namespace detail
+    /// \endcond
+
+    /// An input view of the elements of \c Rng, which are read from \c Rng on
+    /// other threads while the consumer works on the ones before them. This
+    /// splits a pipeline into stages that run at the same time: the adaptors
+    /// before the `async_stage` run on its threads, and those after it on the
+    /// consumer's.
+    ///
+    /// The threads start on the first call to \c begin, and take turns
+    /// advancing the iterator of \c Rng. When \c Rng is a forward range, each
+    /// dereferences its own copy of the iterator, so the work of reading the
+    /// elements, like the function of a `view::transform`, is spread over all
+    /// of them and must be safe to call concurrently; the work of advancing,
+    /// like the predicate of a `view::filter`, is not. Over an input range,
+    /// the elements are read in turn as well, and more than one thread does
+    /// not help.
+    ///
+    /// The elements are copied, as values, into a ring of exactly \c depth
+    /// slots, and the threads wait while it is full, so they never get more
+    /// than \c depth elements, plus the one each is reading, ahead of the
+    /// consumer. With
+    /// `async_order::unordered`, an element that takes long to read does not
+    /// hold back those after it. An exception thrown by \c Rng on a thread
+    /// is rethrown to the consumer from the increment that would have
+    /// reached the element. Destroying the view stops the threads and waits
+    /// for them to finish the element they are reading.
+    template<typename Rng>
+    struct async_stage_view
+      : view_facade<async_stage_view<Rng>,
+                    (range_cardinality<Rng>::value >= 0 ? finite
+                                                        : range_cardinality<Rng>::value)>
+    {
+    private:
+        friend range_access;
+        CPP_assert(View<Rng>);
+        CPP_assert(InputRange<Rng>);
+        CPP_assert(MoveConstructible<range_value_t<Rng>>);
+        CPP_assert(Constructible<range_value_t<Rng>, range_reference_t<Rng>>);
+
+        using value_type_ = range_value_t<Rng>;
+
+        RANGES_NO_UNIQUE_ADDRESS Rng rng_{};
+        std::size_t threads_ = 1;
+        std::size_t depth_ = 64;
+        async_order order_ = async_order::ordered;
+        using copy_t = detail::async_stage_copy<value_type_>;
+        using state_t = detail::async_stage_state<Rng, copy_t>;
+        std::shared_ptr<state_t> state_;
+
+        struct cursor
+        {
+        private:
+            friend range_access;
+            using single_pass = std::true_type;
+            state_t * state_ = nullptr;
+
+        public:
+            cursor() = default;
+            explicit cursor(state_t & state)
+              : state_(&state)
+            {}
+            value_type_ & read() const
+            {
+                return state_->current();
+            }
+            void next()
+            {
+                state_->next();
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return state_->done();
+            }
+        };
+        cursor begin_cursor()
+        {
+            if(!state_)
+            {
+                state_ = std::make_shared<state_t>(std::move(rng_), copy_t{}, threads_,
+                                                   depth_, order_);
+                state_->next();
+            }
+            return cursor{*state_};
+        }
+
+    public:
+        async_stage_view() = default;
+        async_stage_view(Rng rng, std::size_t threads, std::size_t depth,
+                         async_order order)
+          : rng_(std::move(rng))
+          , threads_(threads)
+          , depth_(depth)
+          , order_(order)
+        {
+            RANGES_EXPECT(threads > 0);
+            RANGES_EXPECT(depth > 0);
+        }
+    };
+
+    namespace view
+    {
+        /// The default number of elements a `view::async_stage` buffers.
+        constexpr std::size_t async_stage_depth = 64;
+
+        struct async_stage_fn
+        {
+        private:
+            friend view_access;
+            static auto bind(async_stage_fn async_stage, std::size_t threads,
+                             std::size_t depth = async_stage_depth,
+                             async_order order = async_order::ordered)
+            {
+                return make_pipeable(bind_back(async_stage, threads, depth, order));
+            }
+
+        public:
+            template<typename Rng>
+            auto operator()(Rng && rng, std::size_t threads = 1,
+                            std::size_t depth = async_stage_depth,
+                            async_order order = async_order::ordered) const
+                -> CPP_ret(async_stage_view<all_t<Rng>>)( //
+                    requires ViewableRange<Rng> && InputRange<Rng> &&
+                        MoveConstructible<range_value_t<Rng>> &&
+                        Constructible<range_value_t<Rng>, range_reference_t<Rng>>)
+            {
+                return {all(static_cast<Rng &&>(rng)), threads, depth, order};
+            }
+        };
+
+        /// \relates async_stage_fn
+        /// \ingroup group-views
+        /// \sa `async_stage_view`
+        RANGES_INLINE_VARIABLE(view<async_stage_fn>, async_stage)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,144 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_CACHE1_HPP
+#define RANGES_V3_VIEW_CACHE1_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// An input view of the elements of \c Rng in which dereferencing the
+    /// current position evaluates <tt>*it</tt> of the underlying iterator
+    /// at most once. The value is kept in the view until the iterator is
+    /// incremented, so an adaptor that reads each element more than once,
+    /// like `view::filter` testing it and then passing it on, sees the cached
+    /// value the second time. The reference type is an lvalue reference to
+    /// the cached value. The view is single-pass and not const-iterable.
+    template<typename Rng>
+    struct cache1_view : view_facade<cache1_view<Rng>, range_cardinality<Rng>::value>
+    {
+    private:
+        friend range_access;
+        CPP_assert(View<Rng>);
+        CPP_assert(InputRange<Rng>);
+        CPP_assert(Constructible<range_value_t<Rng>, range_reference_t<Rng>>);
+
+        RANGES_NO_UNIQUE_ADDRESS Rng rng_{};
+        detail::non_propagating_cache<iterator_t<Rng>> current_;
+        detail::non_propagating_cache<range_value_t<Rng>> value_;
+
+        range_value_t<Rng> & read_()
+        {
+            if(!value_)
+                value_.emplace(**current_);
+            return *value_;
+        }
+        void next_()
+        {
+            ++*current_;
+            value_.reset();
+        }
+
+        struct cursor
+        {
+        private:
+            friend range_access;
+            using single_pass = std::true_type;
+            cache1_view * parent_ = nullptr;
+
+        public:
+            cursor() = default;
+            explicit cursor(cache1_view & rng)
+              : parent_(&rng)
+            {}
+            range_value_t<Rng> & read() const
+            {
+                return parent_->read_();
+            }
+            void next()
+            {
+                parent_->next_();
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return *parent_->current_ == ranges::end(parent_->rng_);
+            }
+        };
+        cursor begin_cursor()
+        {
+            current_ = ranges::begin(rng_);
+            value_.reset();
+            return cursor{*this};
+        }
+
+    public:
+        cache1_view() = default;
+        explicit cache1_view(Rng rng)
+          : rng_(std::move(rng))
+        {}
+        CPP_member
+        constexpr auto CPP_fun(size)()(requires SizedRange<Rng>)
+        {
+            return ranges::size(rng_);
+        }
+        CPP_member
+        constexpr auto CPP_fun(size)()(const requires SizedRange<Rng const>)
+        {
+            return ranges::size(rng_);
+        }
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
+    namespace view
+    {
+        struct cache1_fn
+        {
+            template<typename Rng>
+            auto operator()(Rng && rng) const -> CPP_ret(cache1_view<all_t<Rng>>)( //
+                requires ViewableRange<Rng> && InputRange<Rng> &&
+                    Constructible<range_value_t<Rng>, range_reference_t<Rng>>)
+            {
+                return cache1_view<all_t<Rng>>{all(static_cast<Rng &&>(rng))};
+            }
+        };
+
+        /// \relates cache1_fn
+        /// \ingroup group-views
+        /// \sa `cache1_view`
+        RANGES_INLINE_VARIABLE(view<cache1_fn>, cache1)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
@@ -57,6 +57,21 @@ namespace ranges
             meta::fold<meta::list<range_cardinality<Rngs>...>,
                        std::integral_constant<cardinality, static_cast<cardinality>(0)>,
                        meta::quote<concat_cardinality_>>;
+
+        template<typename Rng0, typename Rng>
+        struct concat_same_iterator_
+          : std::is_same<iterator_t<Rng0>, iterator_t<Rng>>
+        {};
+        // Whether the ranges are common ranges that all have the same
+        // iterator type, so that concat_view can use flat_cursor. The
+        // iterator types are only looked at if they are all ranges. Over two
+        // ranges, the compiler turns the variant's dispatch into a loop per
+        // range, which beats flat_cursor's two compares per element.
+        template<typename... Rngs>
+        using concat_flat =
+            meta::and_<meta::bool_<(sizeof...(Rngs) > 2)>,
+                       meta::bool_<(bool)CommonRange<Rngs>>...,
+                       concat_same_iterator_<meta::front<meta::list<Rngs...>>, Rngs>...>;
     } // namespace detail
     /// \endcond
 
@@ -156,7 +171,8 @@ namespace ranges
                         ranges::emplace<N - 1>(
                             pos->its_,
                             ranges::next(ranges::begin(rng), ranges::end(rng)));
-                        pos->its_.visit_i(*this);
+                        detail::variant_visit_r<void>(
+                            pos->its_, *this, detail::indexed_element_fn{});
                     }
                     else
                         --it.get();
@@ -185,7 +201,9 @@ namespace ranges
                     auto rest = ranges::advance(it.get(), n, std::move(end));
                     pos->satisfy(meta::size_t<N>{});
                     if(rest != 0)
-                        pos->its_.visit_i(advance_fwd_fun{pos, rest});
+                        detail::variant_visit_r<void>(pos->its_,
+                                                      advance_fwd_fun{pos, rest},
+                                                      detail::indexed_element_fn{});
                 }
             };
             struct advance_rev_fun
@@ -209,13 +227,16 @@ namespace ranges
                         ranges::emplace<N - 1>(
                             pos->its_,
                             ranges::next(ranges::begin(rng), ranges::end(rng)));
-                        pos->its_.visit_i(*this);
+                        detail::variant_visit_r<void>(
+                            pos->its_, *this, detail::indexed_element_fn{});
                     }
                     else
                     {
                         auto rest = ranges::advance(it.get(), n, std::move(begin));
                         if(rest != 0)
-                            pos->its_.visit_i(advance_rev_fun{pos, rest});
+                            detail::variant_visit_r<void>(pos->its_,
+                                                          advance_rev_fun{pos, rest},
+                                                          detail::indexed_element_fn{});
                     }
                 }
             };
@@ -270,13 +291,13 @@ namespace ranges
             {}
             reference read() const
             {
-                // Kind of a dumb implementation. Surely there's a better way.
-                return ranges::get<0>(unique_variant(its_.visit(
-                    compose(convert_to<reference>{}, detail::dereference_fn{}))));
+                return detail::variant_visit_r<reference>(
+                    its_, compose(convert_to<reference>{}, detail::dereference_fn{}));
             }
             void next()
             {
-                its_.visit_i(next_fun{this});
+                detail::variant_visit_r<void>(
+                    its_, next_fun{this}, detail::indexed_element_fn{});
             }
             CPP_member
             auto equal(cursor const & pos) const -> CPP_ret(bool)( //
@@ -293,16 +314,19 @@ namespace ranges
             auto prev() -> CPP_ret(void)( //
                 requires And<BidirectionalRange<Rngs>...>)
             {
-                its_.visit_i(prev_fun{this});
+                detail::variant_visit_r<void>(
+                    its_, prev_fun{this}, detail::indexed_element_fn{});
             }
             CPP_member
             auto advance(difference_type n) -> CPP_ret(void)( //
                 requires And<RandomAccessRange<Rngs>...>)
             {
                 if(n > 0)
-                    its_.visit_i(advance_fwd_fun{this, n});
+                    detail::variant_visit_r<void>(
+                        its_, advance_fwd_fun{this, n}, detail::indexed_element_fn{});
                 else if(n < 0)
-                    its_.visit_i(advance_rev_fun{this, n});
+                    detail::variant_visit_r<void>(
+                        its_, advance_rev_fun{this, n}, detail::indexed_element_fn{});
             }
             CPP_member
             auto distance_to(cursor const & that) const -> CPP_ret(difference_type)( //
@@ -313,26 +337,180 @@ namespace ranges
                 return -cursor::distance_to_(meta::size_t<0>{}, that, *this);
             }
         };
-        cursor<meta::and_c<simple_view<Rngs>()...>::value> begin_cursor()
+        // When the ranges share an iterator type, a cursor holds one iterator
+        // and the bounds of the range it is in, and only dispatches on the
+        // range's index when it leaves the range. Otherwise the iterator is a
+        // variant, and every operation dispatches.
+        template<bool IsConst>
+        struct flat_cursor
+        {
+            using difference_type = common_type_t<range_difference_t<Rngs>...>;
+
+        private:
+            friend struct flat_cursor<!IsConst>;
+            template<typename T>
+            using constify_if = meta::const_if_c<IsConst, T>;
+            using concat_view_t = constify_if<concat_view>;
+            using I = iterator_t<constify_if<meta::front<meta::list<Rngs...>>>>;
+            concat_view_t * rng_ = nullptr;
+            std::size_t index_ = 0;
+            I it_{}, begin_{}, end_{};
+
+            struct bounds_fn
+            {
+                concat_view_t * rng;
+                template<std::size_t N>
+                std::pair<I, I> operator()(meta::size_t<N>) const
+                {
+                    auto && r = std::get<N>(rng->rngs_);
+                    return {ranges::begin(r), ranges::end(r)};
+                }
+            };
+            std::pair<I, I> bounds_(std::size_t n) const
+            {
+                bounds_fn fn{rng_};
+                return detail::variant_switch_<std::pair<I, I>, cranges>::call(n, fn);
+            }
+            void enter_(std::size_t n)
+            {
+                auto bounds = this->bounds_(n);
+                index_ = n;
+                begin_ = std::move(bounds.first);
+                end_ = std::move(bounds.second);
+            }
+            // Moves past the ends of the ranges, so that only the last range's
+            // end is ever a position.
+            void satisfy_()
+            {
+                while(it_ == end_ && index_ != cranges - 1)
+                {
+                    this->enter_(index_ + 1);
+                    it_ = begin_;
+                }
+            }
+
+        public:
+            using reference = common_reference_t<range_reference_t<constify_if<Rngs>>...>;
+            using single_pass = meta::bool_<SinglePass<I>>;
+            flat_cursor() = default;
+            flat_cursor(concat_view_t & rng, begin_tag)
+              : rng_(&rng)
+            {
+                this->enter_(0);
+                it_ = begin_;
+                this->satisfy_();
+            }
+            flat_cursor(concat_view_t & rng, end_tag)
+              : rng_(&rng)
+            {
+                this->enter_(cranges - 1);
+                it_ = end_;
+            }
+            CPP_template(bool Other)( //
+                requires IsConst && (!Other)) flat_cursor(flat_cursor<Other> that)
+              : rng_(that.rng_)
+              , index_(that.index_)
+              , it_(std::move(that.it_))
+              , begin_(std::move(that.begin_))
+              , end_(std::move(that.end_))
+            {}
+            reference read() const
+            {
+                return *it_;
+            }
+            void next()
+            {
+                RANGES_ASSERT(it_ != end_);
+                if(++it_ == end_)
+                    this->satisfy_();
+            }
+            bool equal(flat_cursor const & that) const
+            {
+                return index_ == that.index_ && it_ == that.it_;
+            }
+            CPP_member
+            auto prev() -> CPP_ret(void)( //
+                requires BidirectionalIterator<I>)
+            {
+                while(it_ == begin_)
+                {
+                    RANGES_EXPECT(index_ != 0);
+                    this->enter_(index_ - 1);
+                    it_ = end_;
+                }
+                --it_;
+            }
+            CPP_member
+            auto advance(difference_type n) -> CPP_ret(void)( //
+                requires RandomAccessIterator<I>)
+            {
+                if(n > 0)
+                {
+                    while(n > end_ - it_ && index_ != cranges - 1)
+                    {
+                        n -= end_ - it_;
+                        this->enter_(index_ + 1);
+                        it_ = begin_;
+                    }
+                    it_ += n;
+                    this->satisfy_();
+                }
+                else if(n < 0)
+                {
+                    while(-n > it_ - begin_)
+                    {
+                        RANGES_EXPECT(index_ != 0);
+                        n += it_ - begin_;
+                        this->enter_(index_ - 1);
+                        it_ = end_;
+                    }
+                    it_ += n;
+                }
+            }
+            CPP_member
+            auto distance_to(flat_cursor const & that) const
+                -> CPP_ret(difference_type)( //
+                    requires SizedSentinel<I, I>)
+            {
+                if(index_ > that.index_)
+                    return -that.distance_to(*this);
+                if(index_ == that.index_)
+                    return that.it_ - it_;
+                difference_type d = end_ - it_;
+                for(std::size_t n = index_ + 1; n != that.index_; ++n)
+                {
+                    auto const bounds = this->bounds_(n);
+                    d += bounds.second - bounds.first;
+                }
+                return d + (that.it_ - that.begin_);
+            }
+        };
+
+        template<bool IsConst>
+        using cursor_t =
+            meta::if_<detail::concat_flat<meta::const_if_c<IsConst, Rngs>...>,
+                      flat_cursor<IsConst>, cursor<IsConst>>;
+
+        cursor_t<meta::and_c<simple_view<Rngs>()...>::value> begin_cursor()
         {
             return {*this, begin_tag{}};
         }
         meta::if_<meta::and_c<(bool)CommonRange<Rngs>...>,
-                  cursor<meta::and_c<simple_view<Rngs>()...>::value>,
+                  cursor_t<meta::and_c<simple_view<Rngs>()...>::value>,
                   sentinel<meta::and_c<simple_view<Rngs>()...>::value>>
         end_cursor()
         {
             return {*this, end_tag{}};
         }
         CPP_member
-        auto begin_cursor() const -> CPP_ret(cursor<true>)( //
+        auto begin_cursor() const -> CPP_ret(cursor_t<true>)( //
             requires And<Range<Rngs const>...>)
         {
             return {*this, begin_tag{}};
         }
         CPP_member
         auto end_cursor() const -> CPP_ret(
-            meta::if_<meta::and_c<(bool)CommonRange<Rngs const>...>, cursor<true>,
+            meta::if_<meta::and_c<(bool)CommonRange<Rngs const>...>, cursor_t<true>,
                       sentinel<true>>)( //
             requires And<Range<Rngs const>...>)
         {
@@ -0,0 +1,167 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_DISTINCT_HPP
+#define RANGES_V3_VIEW_DISTINCT_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/detail/flat_hash.hpp>
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// An input view of the elements of \c Rng whose projections by \c proj
+    /// have not been seen before, so that each value appears once, in the
+    /// order it first appears. Unlike `view::unique`, which only drops the
+    /// repeats of the element before, it needs no sort first. The keys seen
+    /// so far are copied into an open-addressing hash table in the view,
+    /// using `std::hash` and \c ==, which starts over on each call to
+    /// \c begin; a copy of the view starts without it, so copies stay cheap.
+    /// An increment reads on until it finds a new key, so over an infinite
+    /// range with finitely many keys, the increment past the last of them
+    /// never returns. The view is single-pass and not const-iterable.
+    template<typename Rng, typename Proj>
+    struct distinct_view
+      : view_facade<distinct_view<Rng, Proj>,
+                    (range_cardinality<Rng>::value >= 0 ||
+                             range_cardinality<Rng>::value == finite
+                         ? finite
+                         : unknown)>
+    {
+    private:
+        friend range_access;
+        CPP_assert(View<Rng>);
+        CPP_assert(InputRange<Rng>);
+        using key_t = detail::decay_t<indirect_result_t<Proj &, iterator_t<Rng>>>;
+
+        RANGES_NO_UNIQUE_ADDRESS Rng rng_{};
+        RANGES_NO_UNIQUE_ADDRESS semiregular_t<Proj> proj_;
+        detail::non_propagating_cache<iterator_t<Rng>> current_;
+        detail::non_propagating_cache<detail::flat_hash_index<key_t>> seen_;
+
+        // Moves on to the next element with a new key, starting at the
+        // current one.
+        void satisfy_()
+        {
+            auto & it = *current_;
+            auto & seen = *seen_;
+            auto const last = ranges::end(rng_);
+            for(; it != last; ++it)
+                if(seen.insert(invoke(proj_, *it)).second)
+                    break;
+        }
+
+        struct cursor
+        {
+        private:
+            friend range_access;
+            using single_pass = std::true_type;
+            distinct_view * parent_ = nullptr;
+
+        public:
+            cursor() = default;
+            explicit cursor(distinct_view & rng)
+              : parent_(&rng)
+            {}
+            range_reference_t<Rng> read() const
+            {
+                return **parent_->current_;
+            }
+            void next()
+            {
+                ++*parent_->current_;
+                parent_->satisfy_();
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return *parent_->current_ == ranges::end(parent_->rng_);
+            }
+        };
+        cursor begin_cursor()
+        {
+            current_ = ranges::begin(rng_);
+            if(seen_)
+                seen_->clear();
+            else
+                seen_.emplace();
+            satisfy_();
+            return cursor{*this};
+        }
+
+    public:
+        distinct_view() = default;
+        distinct_view(Rng rng, Proj proj)
+          : rng_(std::move(rng))
+          , proj_(std::move(proj))
+        {}
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
+    namespace view
+    {
+        struct distinct_fn
+        {
+        private:
+            friend view_access;
+            template<typename Proj>
+            static constexpr auto CPP_fun(bind)(distinct_fn distinct, Proj proj)( //
+                requires(!Range<Proj>))
+            {
+                return bind_back(distinct, std::move(proj));
+            }
+
+        public:
+            template<typename Rng, typename Proj = identity>
+            constexpr auto operator()(Rng && rng, Proj proj = {}) const
+                -> CPP_ret(distinct_view<all_t<Rng>, Proj>)( //
+                    requires ViewableRange<Rng> && InputRange<Rng> &&
+                        IndirectUnaryInvocable<Proj, iterator_t<Rng>> &&
+                        CopyConstructible<detail::decay_t<
+                            indirect_result_t<Proj &, iterator_t<Rng>>>>)
+            {
+                return {all(static_cast<Rng &&>(rng)), std::move(proj)};
+            }
+        };
+
+        /// \relates distinct_fn
+        /// \ingroup group-views
+        /// \sa `distinct_view`
+        RANGES_INLINE_VARIABLE(view<distinct_fn>, distinct)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
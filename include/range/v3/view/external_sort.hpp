@@ -0,0 +1,144 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_EXTERNAL_SORT_HPP
+#define RANGES_V3_VIEW_EXTERNAL_SORT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/external_sort.hpp>
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/functional/identity.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// The sorted elements of an input range, merged lazily from the runs
+    /// that `view::external_sort` wrote to temporary files. Copies of the
+    /// view share the same position, as with `istream_view`, and the files
+    /// are removed when the last copy is destroyed.
+    template<typename T, typename C, typename P>
+    struct external_sort_view : view_facade<external_sort_view<T, C, P>, unknown>
+    {
+    private:
+        friend range_access;
+        struct state
+        {
+            detail::external_sort_state<T, C, P> runs_;
+            detail::external_merger<T, C, P> merger_;
+
+            template<typename... Args>
+            explicit state(Args &&... args)
+              : runs_(static_cast<Args &&>(args)...)
+              , merger_(runs_.merge())
+            {}
+        };
+        std::shared_ptr<state> state_;
+
+        struct cursor
+        {
+        private:
+            friend range_access;
+            using single_pass = std::true_type;
+            state * state_ = nullptr;
+
+        public:
+            cursor() = default;
+            explicit cursor(state & s)
+              : state_(&s)
+            {}
+            void next()
+            {
+                state_->merger_.pop();
+            }
+            T const & read() const noexcept
+            {
+                return state_->merger_.front();
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return state_->merger_.empty();
+            }
+        };
+        cursor begin_cursor()
+        {
+            return cursor{*state_};
+        }
+
+    public:
+        external_sort_view() = default;
+        template<typename I, typename S>
+        external_sort_view(I first, S last, std::size_t memory_budget, std::string tmp_dir,
+                           C pred, P proj, size_bounds hint = {})
+          : state_(std::make_shared<state>(first, std::move(last), memory_budget,
+                                           std::move(tmp_dir), std::move(pred),
+                                           std::move(proj), nullptr, hint))
+        {}
+    };
+
+    namespace view
+    {
+        struct external_sort_fn
+        {
+        private:
+            friend view_access;
+            template<typename C = less, typename P = identity>
+            static auto CPP_fun(bind)(external_sort_fn external_sort,
+                                      std::size_t memory_budget, std::string tmp_dir = {},
+                                      C pred = C{}, P proj = P{})( //
+                requires(!Range<C>))
+            {
+                return make_pipeable(bind_back(external_sort, memory_budget,
+                                               std::move(tmp_dir), std::move(pred),
+                                               std::move(proj)));
+            }
+
+        public:
+            template<typename Rng, typename C = less, typename P = identity>
+            auto operator()(Rng && rng, std::size_t memory_budget,
+                            std::string tmp_dir = {}, C pred = C{}, P proj = P{}) const
+                -> CPP_ret(external_sort_view<range_value_t<Rng>, C, P>)( //
+                    requires InputRange<Rng> && ExternallySortable<iterator_t<Rng>, C, P>)
+            {
+                return {begin(rng), end(rng), memory_budget, std::move(tmp_dir),
+                        std::move(pred), std::move(proj), ranges::size_hint(rng)};
+            }
+        };
+
+        /// \relates external_sort_fn
+        /// \ingroup group-views
+        /// Reads the whole input range when called, spilling sorted runs of
+        /// at most \c memory_budget bytes to temporary files in \c tmp_dir,
+        /// and returns an `external_sort_view` that merges them as it is
+        /// iterated. See `ranges::external_sort` for the details.
+        RANGES_INLINE_VARIABLE(view<external_sort_fn>, external_sort)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,302 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_INDEXED_SCAN_HPP
+#define RANGES_V3_VIEW_INDEXED_SCAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/arithmetic.hpp>
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/exclusive_scan.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/partial_sum.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// A random-access version of `partial_sum_view` (when \c Exclusive is
+    /// false) or `exclusive_scan_view` (when it is true) over a sized,
+    /// random-access range. The first jump to position \c k computes the scan
+    /// up to \c k sequentially and records the running sum at every
+    /// \c block_size -th position; after that, reaching any position already
+    /// indexed costs at most \c block_size applications of \c Fun. The results
+    /// are exactly those of the sequential scan, so \c Fun need not be
+    /// associative. The index lives in the view, which is therefore not
+    /// const-iterable.
+    template<typename Rng, typename T, typename Fun, bool Exclusive>
+    struct indexed_scan_view
+      : view_facade<indexed_scan_view<Rng, T, Fun, Exclusive>, finite>
+    {
+    private:
+        friend range_access;
+        CPP_assert(View<Rng>);
+        CPP_assert(RandomAccessRange<Rng> && SizedRange<Rng>);
+
+        using difference_type_ = range_difference_t<Rng>;
+
+        RANGES_NO_UNIQUE_ADDRESS Rng base_{};
+        RANGES_NO_UNIQUE_ADDRESS semiregular_t<T> init_;
+        RANGES_NO_UNIQUE_ADDRESS semiregular_t<Fun> fun_;
+        difference_type_ block_ = 64;
+        detail::non_propagating_cache<std::vector<T>> index_;
+
+        // The scan at position pos is sum; make it the scan at pos + 1.
+        void step_(T & sum, iterator_t<Rng> const & it) // it is base_[pos]
+        {
+            auto & f = static_cast<Fun &>(fun_);
+            if(Exclusive)
+                sum = invoke(f, sum, *it);
+            else
+                sum = invoke(f, sum, *(it + 1));
+        }
+        T first_()
+        {
+            return Exclusive ? static_cast<T const &>(init_)
+                             : static_cast<T>(*ranges::begin(base_));
+        }
+        // Make sure the running sum at position b * block_ is recorded.
+        T const & index_at_(std::size_t b)
+        {
+            if(!index_)
+                index_.emplace(1, first_());
+            auto & sums = *index_;
+            auto const first = ranges::begin(base_);
+            while(sums.size() <= b)
+            {
+                T sum = sums.back();
+                auto it = first + static_cast<difference_type_>(sums.size() - 1) * block_;
+                for(difference_type_ i = 0; i < block_; ++i, ++it)
+                    step_(sum, it);
+                sums.push_back(std::move(sum));
+            }
+            return sums[b];
+        }
+
+        struct cursor
+        {
+        private:
+            indexed_scan_view * parent_ = nullptr;
+            difference_type_ pos_ = 0;
+            RANGES_NO_UNIQUE_ADDRESS iterator_t<Rng> current_{};
+            RANGES_NO_UNIQUE_ADDRESS semiregular_t<T> sum_;
+
+            difference_type_ size_() const
+            {
+                return static_cast<difference_type_>(ranges::size(parent_->base_));
+            }
+            void seek_(difference_type_ pos)
+            {
+                RANGES_EXPECT(0 <= pos && pos <= size_());
+                auto & sum = static_cast<T &>(sum_);
+                auto const block = parent_->block_;
+                if(pos == size_())
+                {
+                    // The end position has no value to compute.
+                }
+                else if(pos_ <= pos && pos - pos_ <= block && pos_ < size_())
+                {
+                    // Close enough ahead to walk there.
+                    for(; pos_ != pos; ++pos_, ++current_)
+                        parent_->step_(sum, current_);
+                }
+                else
+                {
+                    auto const b = static_cast<std::size_t>(pos / block);
+                    sum = parent_->index_at_(b);
+                    pos_ = static_cast<difference_type_>(b) * block;
+                    current_ = ranges::begin(parent_->base_) + pos_;
+                    for(; pos_ != pos; ++pos_, ++current_)
+                        parent_->step_(sum, current_);
+                }
+                pos_ = pos;
+                current_ = ranges::begin(parent_->base_) + pos;
+            }
+
+        public:
+            cursor() = default;
+            cursor(indexed_scan_view & rng, difference_type_ pos)
+              : parent_{detail::addressof(rng)}
+              , pos_{pos}
+              , current_(ranges::begin(rng.base_) + pos)
+            {
+                if(pos == 0 && pos != size_())
+                    sum_ = rng.first_();
+            }
+            T read() const
+            {
+                RANGES_EXPECT(pos_ != size_());
+                return sum_;
+            }
+            void next()
+            {
+                RANGES_EXPECT(pos_ != size_());
+                if(pos_ + 1 != size_())
+                    parent_->step_(static_cast<T &>(sum_), current_);
+                ++pos_;
+                ++current_;
+            }
+            void prev()
+            {
+                seek_(pos_ - 1);
+            }
+            void advance(difference_type_ n)
+            {
+                if(n == 1)
+                    next();
+                else if(n != 0)
+                    seek_(pos_ + n);
+            }
+            difference_type_ distance_to(cursor const & that) const
+            {
+                RANGES_EXPECT(parent_ == that.parent_);
+                return that.pos_ - pos_;
+            }
+            bool equal(cursor const & that) const
+            {
+                RANGES_EXPECT(parent_ == that.parent_);
+                return pos_ == that.pos_;
+            }
+        };
+
+        cursor begin_cursor()
+        {
+            return {*this, 0};
+        }
+        cursor end_cursor()
+        {
+            return {*this, static_cast<difference_type_>(ranges::size(base_))};
+        }
+
+    public:
+        indexed_scan_view() = default;
+        indexed_scan_view(Rng rng, T init, Fun fun, std::ptrdiff_t block_size)
+          : base_(std::move(rng))
+          , init_(std::move(init))
+          , fun_(std::move(fun))
+          , block_(static_cast<difference_type_>(block_size))
+        {
+            RANGES_EXPECT(block_size > 0);
+        }
+        CPP_member
+        constexpr auto CPP_fun(size)()(requires SizedRange<Rng>)
+        {
+            return ranges::size(base_);
+        }
+        CPP_member
+        constexpr auto CPP_fun(size)()(const requires SizedRange<Rng const>)
+        {
+            return ranges::size(base_);
+        }
+        Rng base() const
+        {
+            return base_;
+        }
+    };
+
+    namespace view
+    {
+        /// The default distance between the recorded running sums of an
+        /// `indexed_scan_view`.
+        constexpr std::ptrdiff_t scan_index_block = 64;
+
+        struct indexed_partial_sum_fn
+        {
+        private:
+            friend view_access;
+            template<typename Fun = plus>
+            static constexpr auto bind(indexed_partial_sum_fn indexed_partial_sum,
+                                       Fun fun = {},
+                                       std::ptrdiff_t block_size = scan_index_block)
+            {
+                return make_pipeable(
+                    bind_back(indexed_partial_sum, std::move(fun), block_size));
+            }
+
+        public:
+            template<typename Rng, typename Fun = plus>
+            auto operator()(Rng && rng, Fun fun = {},
+                            std::ptrdiff_t block_size = scan_index_block) const
+                -> CPP_ret(indexed_scan_view<all_t<Rng>, range_value_t<Rng>, Fun,
+                                             false>)( //
+                    requires detail::PartialSumViewable<all_t<Rng>, Fun> &&
+                        RandomAccessRange<Rng> && SizedRange<Rng>)
+            {
+                return {all(static_cast<Rng &&>(rng)),
+                        range_value_t<Rng>{},
+                        std::move(fun),
+                        block_size};
+            }
+        };
+
+        struct indexed_exclusive_scan_fn
+        {
+        private:
+            friend view_access;
+            template<typename T, typename Fun = plus>
+            static constexpr auto bind(indexed_exclusive_scan_fn indexed_exclusive_scan,
+                                       T init, Fun fun = {},
+                                       std::ptrdiff_t block_size = scan_index_block)
+            {
+                return make_pipeable(bind_back(
+                    indexed_exclusive_scan, std::move(init), std::move(fun), block_size));
+            }
+
+        public:
+            template<typename Rng, typename T, typename Fun = plus>
+            auto operator()(Rng && rng, T init, Fun fun = {},
+                            std::ptrdiff_t block_size = scan_index_block) const
+                -> CPP_ret(indexed_scan_view<all_t<Rng>, T, Fun, true>)( //
+                    requires ExclusiveScanConstraint<Rng, T, Fun> &&
+                        RandomAccessRange<Rng> && SizedRange<Rng>)
+            {
+                return {all(static_cast<Rng &&>(rng)),
+                        std::move(init),
+                        std::move(fun),
+                        block_size};
+            }
+        };
+
+        /// \relates indexed_partial_sum_fn
+        /// \ingroup group-views
+        /// A random-access `view::partial_sum`. \sa `indexed_scan_view`
+        RANGES_INLINE_VARIABLE(view<indexed_partial_sum_fn>, indexed_partial_sum)
+
+        /// \relates indexed_exclusive_scan_fn
+        /// \ingroup group-views
+        /// A random-access `view::exclusive_scan`. \sa `indexed_scan_view`
+        RANGES_INLINE_VARIABLE(view<indexed_exclusive_scan_fn>, indexed_exclusive_scan)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
@@ -25,6 +25,7 @@
 #include <range/v3/iterator/default_sentinel.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/range_for.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -355,6 +356,14 @@ namespace ranges
           : outer_(view::all(std::move(rng)))
           , val_(view::all(std::move(val)))
         {}
+        /// Every gap between two inner ranges holds a copy of the delimiter.
+        size_bounds size_hint() const
+        {
+            auto const outer = ranges::size_hint(outer_);
+            return {outer.lower != 0 ? (outer.lower - 1) * ranges::size_hint(val_).lower
+                                     : 0,
+                    size_bounds::unbounded};
+        }
         CPP_member
         static constexpr auto size() -> CPP_ret(std::size_t)( //
             requires(detail::join_cardinality<Rng, ValRng>() >= 0))
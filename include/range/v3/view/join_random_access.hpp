@@ -0,0 +1,244 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_JOIN_RANDOM_ACCESS_HPP
+#define RANGES_V3_VIEW_JOIN_RANDOM_ACCESS_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/algorithm/upper_bound.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \cond
+    namespace detail
+    {
+        CPP_def
+        (
+            template(typename Rng)
+            concept RandomAccessJoinable,
+                RandomAccessRange<Rng> && SizedRange<Rng> &&
+                std::is_lvalue_reference<range_reference_t<Rng>>::value &&
+                RandomAccessRange<range_reference_t<Rng>> &&
+                SizedRange<range_reference_t<Rng>>
+        );
+    } // namespace detail
+    /// \endcond
+
+    /// \addtogroup group-views
+    /// @{
+
+    /// A random-access version of `join_view` over a sized, random-access
+    /// range of sized, random-access ranges. The first call to \c begin,
+    /// \c end or \c size records where each inner range starts in the
+    /// flattened sequence; after that, a jump to any position is a binary
+    /// search over those offsets. The offsets live in the view, which is
+    /// therefore not const-iterable, and are not updated if the inner ranges
+    /// later change size.
+    template<typename Rng>
+    struct join_random_access_view
+      : view_facade<join_random_access_view<Rng>, finite>
+    {
+    private:
+        friend range_access;
+        CPP_assert(View<Rng>);
+        CPP_assert(detail::RandomAccessJoinable<Rng>);
+
+        using inner_t = range_reference_t<Rng>;
+        using difference_type_ = range_difference_t<inner_t>;
+
+        RANGES_NO_UNIQUE_ADDRESS Rng outer_{};
+        detail::non_propagating_cache<std::vector<difference_type_>> index_;
+
+        // starts[i] is the position of the first element of the i-th inner
+        // range; starts.back() is the total size.
+        std::vector<difference_type_> const & starts_()
+        {
+            if(!index_)
+            {
+                std::vector<difference_type_> starts;
+                starts.reserve(ranges::size(outer_) + 1);
+                starts.push_back(0);
+                for(auto && inner : outer_)
+                    starts.push_back(starts.back() +
+                                     static_cast<difference_type_>(ranges::size(inner)));
+                index_.emplace(std::move(starts));
+            }
+            return *index_;
+        }
+        inner_t segment_(std::size_t i)
+        {
+            return *(ranges::begin(outer_) + static_cast<range_difference_t<Rng>>(i));
+        }
+
+        struct cursor
+        {
+        private:
+            join_random_access_view * parent_ = nullptr;
+            std::size_t seg_ = 0;
+            difference_type_ pos_ = 0;
+            RANGES_NO_UNIQUE_ADDRESS iterator_t<inner_t> current_{};
+
+            std::vector<difference_type_> const & starts_() const
+            {
+                return *parent_->index_;
+            }
+            std::size_t segments_() const
+            {
+                return starts_().size() - 1;
+            }
+            void seek_(difference_type_ pos)
+            {
+                auto const & starts = starts_();
+                RANGES_EXPECT(0 <= pos && pos <= starts.back());
+                if(seg_ < segments_() && starts[seg_] <= pos && pos < starts[seg_ + 1])
+                {
+                    // Still inside the current inner range.
+                    current_ += pos - pos_;
+                }
+                else if(pos == starts.back())
+                {
+                    seg_ = segments_();
+                    current_ = iterator_t<inner_t>{};
+                }
+                else
+                {
+                    // The last inner range starting at or before pos; it is
+                    // not empty, because pos is not the end.
+                    seg_ = static_cast<std::size_t>(
+                               ranges::upper_bound(starts, pos) - starts.begin()) -
+                           1;
+                    current_ = ranges::begin(parent_->segment_(seg_)) +
+                               (pos - starts[seg_]);
+                }
+                pos_ = pos;
+            }
+
+        public:
+            cursor() = default;
+            cursor(join_random_access_view & rng, difference_type_ pos)
+              : parent_{detail::addressof(rng)}
+              , seg_{rng.starts_().size() - 1}
+            {
+                seek_(pos);
+            }
+            range_reference_t<inner_t> read() const
+            {
+                RANGES_EXPECT(seg_ != segments_());
+                return *current_;
+            }
+            void next()
+            {
+                RANGES_EXPECT(seg_ != segments_());
+                ++pos_;
+                ++current_;
+                auto const & starts = starts_();
+                if(pos_ != starts[seg_ + 1])
+                    return;
+                // Skip over any empty inner ranges.
+                while(++seg_ != segments_() && starts[seg_ + 1] == pos_)
+                    ;
+                current_ = seg_ != segments_() ? ranges::begin(parent_->segment_(seg_))
+                                               : iterator_t<inner_t>{};
+            }
+            void prev()
+            {
+                if(seg_ != segments_() && starts_()[seg_] < pos_)
+                {
+                    --pos_;
+                    --current_;
+                }
+                else
+                    seek_(pos_ - 1);
+            }
+            void advance(difference_type_ n)
+            {
+                if(n != 0)
+                    seek_(pos_ + n);
+            }
+            difference_type_ distance_to(cursor const & that) const
+            {
+                RANGES_EXPECT(parent_ == that.parent_);
+                return that.pos_ - pos_;
+            }
+            bool equal(cursor const & that) const
+            {
+                RANGES_EXPECT(parent_ == that.parent_);
+                return pos_ == that.pos_;
+            }
+        };
+
+        cursor begin_cursor()
+        {
+            return {*this, 0};
+        }
+        cursor end_cursor()
+        {
+            return {*this, starts_().back()};
+        }
+
+    public:
+        join_random_access_view() = default;
+        explicit join_random_access_view(Rng rng)
+          : outer_(std::move(rng))
+        {}
+        std::size_t size()
+        {
+            return static_cast<std::size_t>(starts_().back());
+        }
+        Rng base() const
+        {
+            return outer_;
+        }
+    };
+
+    namespace view
+    {
+        struct join_random_access_fn
+        {
+            template<typename Rng>
+            auto operator()(Rng && rng) const
+                -> CPP_ret(join_random_access_view<all_t<Rng>>)( //
+                    requires ViewableRange<Rng> &&
+                        detail::RandomAccessJoinable<all_t<Rng>>)
+            {
+                return join_random_access_view<all_t<Rng>>{all(static_cast<Rng &&>(rng))};
+            }
+        };
+
+        /// \relates join_random_access_fn
+        /// \ingroup group-views
+        /// A random-access `view::join`. \sa `join_random_access_view`
+        RANGES_INLINE_VARIABLE(view<join_random_access_fn>, join_random_access)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
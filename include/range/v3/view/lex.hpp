@@ -0,0 +1,949 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_LEX_HPP
+#define RANGES_V3_VIEW_LEX_HPP
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/iterator/concepts.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/interface.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// Thrown by the constructors of `lexer` for a pattern that is not in
+    /// the supported subset of regular expressions, or whose automaton
+    /// would be too large.
+    struct lex_error : std::invalid_argument
+    {
+        lex_error(std::string const & what, std::size_t pos)
+          : std::invalid_argument(what + " at offset " + std::to_string(pos))
+          , pos_(pos)
+        {}
+        /// The offset in the pattern at which the error was found.
+        std::size_t position() const noexcept
+        {
+            return pos_;
+        }
+
+    private:
+        std::size_t pos_;
+    };
+
+    /// \cond
+    namespace detail
+    {
+        using lex_byte_set = std::bitset<256>;
+
+        // A Thompson automaton: every node either moves to next on a byte of
+        // set, or has only epsilon moves.
+        struct lex_nfa
+        {
+            struct node
+            {
+                lex_byte_set set;
+                int next = -1;
+                std::vector<int> eps;
+                int rule = -1;
+            };
+            struct fragment
+            {
+                int in, out;
+            };
+            std::vector<node> nodes;
+
+            int add()
+            {
+                nodes.emplace_back();
+                return static_cast<int>(nodes.size()) - 1;
+            }
+            void link(int from, int to)
+            {
+                nodes[static_cast<std::size_t>(from)].eps.push_back(to);
+            }
+        };
+
+        // Recursive-descent parser for the pattern subset, building the
+        // automaton fragment for each piece as it goes. Repetition counts
+        // re-parse their operand, which is simpler than copying fragments.
+        struct lex_parser
+        {
+            static constexpr std::size_t max_repeat = 1000;
+            static constexpr std::size_t max_depth = 200;
+
+            std::string const & pat_;
+            lex_nfa & nfa_;
+            std::size_t pos_ = 0;
+            std::size_t depth_ = 0;
+
+            lex_parser(std::string const & pat, lex_nfa & nfa)
+              : pat_(pat)
+              , nfa_(nfa)
+            {}
+
+            [[noreturn]] void fail(char const * what) const
+            {
+                throw lex_error(what, pos_);
+            }
+            bool done() const
+            {
+                return pos_ == pat_.size();
+            }
+            char peek() const
+            {
+                return pat_[pos_];
+            }
+            unsigned char get()
+            {
+                if(done())
+                    fail("unexpected end of pattern");
+                return static_cast<unsigned char>(pat_[pos_++]);
+            }
+
+            lex_nfa::fragment set_(lex_byte_set const & set)
+            {
+                int const in = nfa_.add(), out = nfa_.add();
+                nfa_.nodes[static_cast<std::size_t>(in)].set = set;
+                nfa_.nodes[static_cast<std::size_t>(in)].next = out;
+                return {in, out};
+            }
+            lex_nfa::fragment empty_()
+            {
+                int const in = nfa_.add(), out = nfa_.add();
+                nfa_.link(in, out);
+                return {in, out};
+            }
+
+            static lex_byte_set range_(unsigned char lo, unsigned char hi)
+            {
+                lex_byte_set set;
+                for(unsigned c = lo; c <= hi; ++c)
+                    set.set(c);
+                return set;
+            }
+            static lex_byte_set class_of_(char c)
+            {
+                switch(c)
+                {
+                case 'd':
+                    return range_('0', '9');
+                case 'w':
+                    return range_('0', '9') | range_('A', 'Z') | range_('a', 'z') |
+                           range_('_', '_');
+                case 's':
+                    return range_(' ', ' ') | range_('\t', '\r');
+                default:
+                    return ~class_of_(static_cast<char>(c - 'A' + 'a'));
+                }
+            }
+            // The set matched by the escape sequence after a backslash.
+            lex_byte_set escape_()
+            {
+                unsigned char const c = get();
+                switch(c)
+                {
+                case 'd':
+                case 'w':
+                case 's':
+                case 'D':
+                case 'W':
+                case 'S':
+                    return class_of_(static_cast<char>(c));
+                case 'n':
+                    return range_('\n', '\n');
+                case 't':
+                    return range_('\t', '\t');
+                case 'r':
+                    return range_('\r', '\r');
+                case 'f':
+                    return range_('\f', '\f');
+                case 'v':
+                    return range_('\v', '\v');
+                case '0':
+                    return range_('\0', '\0');
+                case 'x':
+                {
+                    unsigned v = 0;
+                    for(int i = 0; i != 2; ++i)
+                    {
+                        unsigned char const h = get();
+                        if(h >= '0' && h <= '9')
+                            v = v * 16 + (h - '0');
+                        else if(h >= 'a' && h <= 'f')
+                            v = v * 16 + (h - 'a' + 10);
+                        else if(h >= 'A' && h <= 'F')
+                            v = v * 16 + (h - 'A' + 10);
+                        else
+                            fail("expected two hexadecimal digits after \\x");
+                    }
+                    return range_(static_cast<unsigned char>(v),
+                                  static_cast<unsigned char>(v));
+                }
+                default:
+                    // Anchors, back-references and the like are not
+                    // supported; other punctuation stands for itself.
+                    if((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') ||
+                       (c >= 'a' && c <= 'z'))
+                        fail("unsupported escape sequence");
+                    return range_(c, c);
+                }
+            }
+            // [...], after the opening bracket.
+            lex_byte_set bracket_()
+            {
+                lex_byte_set set;
+                bool const negate = !done() && peek() == '^';
+                if(negate)
+                    ++pos_;
+                bool first = true;
+                while(first || done() || peek() != ']')
+                {
+                    first = false;
+                    unsigned char lo = get();
+                    if(lo == '\\')
+                    {
+                        auto const s = escape_();
+                        if(s.count() != 1)
+                        {
+                            set |= s;
+                            continue;
+                        }
+                        lo = static_cast<unsigned char>(lowest_(s));
+                    }
+                    if(pos_ + 1 < pat_.size() && peek() == '-' && pat_[pos_ + 1] != ']')
+                    {
+                        ++pos_;
+                        unsigned char hi = get();
+                        if(hi == '\\')
+                        {
+                            auto const s = escape_();
+                            if(s.count() != 1)
+                                fail("a class escape cannot end a range");
+                            hi = static_cast<unsigned char>(lowest_(s));
+                        }
+                        if(hi < lo)
+                            fail("character range out of order");
+                        set |= range_(lo, hi);
+                    }
+                    else
+                        set.set(lo);
+                }
+                ++pos_;
+                return negate ? ~set : set;
+            }
+            static std::size_t lowest_(lex_byte_set const & s)
+            {
+                std::size_t i = 0;
+                while(!s.test(i))
+                    ++i;
+                return i;
+            }
+
+            lex_nfa::fragment atom_()
+            {
+                unsigned char const c = get();
+                switch(c)
+                {
+                case '(':
+                {
+                    if(pat_.compare(pos_, 2, "?:") == 0)
+                        pos_ += 2;
+                    if(++depth_ > max_depth)
+                        fail("pattern nested too deeply");
+                    auto const f = alternation_();
+                    --depth_;
+                    if(done() || get() != ')')
+                        fail("missing )");
+                    return f;
+                }
+                case '[':
+                    return set_(bracket_());
+                case '.':
+                    return set_(~range_('\n', '\n'));
+                case '\\':
+                    return set_(escape_());
+                case ')':
+                case '*':
+                case '+':
+                case '?':
+                case '{':
+                    --pos_;
+                    fail("unexpected metacharacter");
+                case '^':
+                case '$':
+                    --pos_;
+                    fail("anchors are not supported");
+                default:
+                    return set_(range_(c, c));
+                }
+            }
+            std::size_t number_()
+            {
+                if(done() || peek() < '0' || peek() > '9')
+                    fail("expected a repetition count");
+                std::size_t n = 0;
+                while(!done() && peek() >= '0' && peek() <= '9')
+                {
+                    n = n * 10 + static_cast<std::size_t>(get() - '0');
+                    if(n > max_repeat)
+                        fail("repetition count too large");
+                }
+                return n;
+            }
+            lex_nfa::fragment star_(lex_nfa::fragment f)
+            {
+                int const in = nfa_.add(), out = nfa_.add();
+                nfa_.link(in, f.in);
+                nfa_.link(in, out);
+                nfa_.link(f.out, f.in);
+                nfa_.link(f.out, out);
+                return {in, out};
+            }
+            lex_nfa::fragment plus_(lex_nfa::fragment f)
+            {
+                int const out = nfa_.add();
+                nfa_.link(f.out, f.in);
+                nfa_.link(f.out, out);
+                return {f.in, out};
+            }
+            lex_nfa::fragment optional_(lex_nfa::fragment f)
+            {
+                int const in = nfa_.add();
+                nfa_.link(in, f.in);
+                nfa_.link(in, f.out);
+                return {in, f.out};
+            }
+            lex_nfa::fragment concat_(lex_nfa::fragment a, lex_nfa::fragment b)
+            {
+                nfa_.link(a.out, b.in);
+                return {a.in, b.out};
+            }
+            lex_nfa::fragment repeat_()
+            {
+                std::size_t const start = pos_;
+                auto f = atom_();
+                std::size_t const end = pos_;
+                if(done())
+                    return f;
+                char const q = peek();
+                if(q == '*' || q == '+' || q == '?')
+                {
+                    ++pos_;
+                    f = q == '*' ? star_(f) : q == '+' ? plus_(f) : optional_(f);
+                }
+                else if(q == '{')
+                {
+                    ++pos_;
+                    std::size_t const lo = number_();
+                    std::size_t hi = lo;
+                    bool unbounded = false;
+                    if(!done() && peek() == ',')
+                    {
+                        ++pos_;
+                        if(!done() && peek() == '}')
+                            unbounded = true;
+                        else
+                            hi = number_();
+                    }
+                    if(done() || get() != '}')
+                        fail("missing }");
+                    if(hi < lo)
+                        fail("repetition bounds out of order");
+                    std::size_t const after = pos_;
+                    f = counted_(f, start, end, lo, hi, unbounded);
+                    pos_ = after;
+                }
+                else
+                    return f;
+                if(!done() && (peek() == '*' || peek() == '+' || peek() == '?' ||
+                               peek() == '{'))
+                    fail("lazy and repeated quantifiers are not supported");
+                return f;
+            }
+            // f repeated lo to hi times, or at least lo times. Each copy
+            // after the first is made by parsing [start, end) again.
+            lex_nfa::fragment counted_(lex_nfa::fragment f, std::size_t start,
+                                       std::size_t end, std::size_t lo, std::size_t hi,
+                                       bool unbounded)
+            {
+                auto copy = [&] {
+                    if(nfa_.nodes.size() > max_nodes)
+                        fail("pattern too large");
+                    pos_ = start;
+                    auto g = atom_();
+                    RANGES_EXPECT(pos_ == end);
+                    return g;
+                };
+                if(lo == 0 && hi == 0 && !unbounded)
+                    return empty_();
+                lex_nfa::fragment result = lo == 0 ? optional_(f) : f;
+                for(std::size_t i = 1; i < lo; ++i)
+                    result = concat_(result, copy());
+                if(unbounded)
+                    result = lo == 0 ? star_(f) : concat_(result, star_(copy()));
+                else
+                    for(std::size_t i = lo == 0 ? 1 : lo; i < hi; ++i)
+                        result = concat_(result, optional_(copy()));
+                return result;
+            }
+            lex_nfa::fragment concatenation_()
+            {
+                lex_nfa::fragment f = empty_();
+                while(!done() && peek() != '|' && peek() != ')')
+                    f = concat_(f, repeat_());
+                return f;
+            }
+            lex_nfa::fragment alternation_()
+            {
+                auto f = concatenation_();
+                if(done() || peek() != '|')
+                    return f;
+                int const in = nfa_.add(), out = nfa_.add();
+                nfa_.link(in, f.in);
+                nfa_.link(f.out, out);
+                while(!done() && peek() == '|')
+                {
+                    ++pos_;
+                    auto const g = concatenation_();
+                    nfa_.link(in, g.in);
+                    nfa_.link(g.out, out);
+                }
+                return {in, out};
+            }
+
+            static constexpr std::size_t max_nodes = 1u << 20;
+
+            lex_nfa::fragment parse()
+            {
+                auto const f = alternation_();
+                if(!done())
+                    fail("unmatched )");
+                return f;
+            }
+        };
+
+        // The deterministic automaton for a list of patterns. State 0 is
+        // the dead state and state 1 the start state. Bytes that no pattern
+        // tells apart share a class, and each state has one row of
+        // transitions indexed by class.
+        struct lex_dfa
+        {
+            static constexpr std::size_t max_states = 1u << 16;
+
+            std::array<std::uint8_t, 256> class_{};
+            std::size_t classes_ = 1;
+            std::vector<std::uint32_t> next_;
+            std::vector<int> accept_;
+            std::size_t rules_ = 0;
+
+            explicit lex_dfa(std::vector<std::string> const & patterns)
+              : rules_(patterns.size())
+            {
+                lex_nfa nfa;
+                int const start = nfa.add();
+                for(std::size_t r = 0; r != patterns.size(); ++r)
+                {
+                    auto const f = lex_parser{patterns[r], nfa}.parse();
+                    nfa.link(start, f.in);
+                    nfa.nodes[static_cast<std::size_t>(f.out)].rule = static_cast<int>(r);
+                }
+                build_(nfa, start);
+            }
+
+            std::size_t states() const noexcept
+            {
+                return accept_.size();
+            }
+            std::uint32_t step(std::uint32_t state, unsigned char c) const noexcept
+            {
+                return next_[state * classes_ + class_[c]];
+            }
+
+        private:
+            void classify_(lex_nfa const & nfa, std::vector<unsigned char> & reps)
+            {
+                // Refine the partition of the bytes by every set the
+                // automaton tests.
+                std::array<unsigned, 256> cls{};
+                unsigned count = 1;
+                for(auto const & n : nfa.nodes)
+                {
+                    if(n.next < 0)
+                        continue;
+                    // The new class of a byte depends on its old class and
+                    // on whether it is in the set.
+                    std::array<unsigned, 512> split;
+                    split.fill(256);
+                    unsigned next = 0;
+                    for(unsigned c = 0; c != 256; ++c)
+                    {
+                        auto & id = split[cls[c] * 2 + n.set.test(c)];
+                        if(id == 256)
+                            id = next++;
+                        cls[c] = id;
+                    }
+                    count = next;
+                }
+                classes_ = count;
+                reps.assign(count, 0);
+                for(unsigned c = 256; c-- != 0;)
+                {
+                    class_[c] = static_cast<std::uint8_t>(cls[c]);
+                    reps[cls[c]] = static_cast<unsigned char>(c);
+                }
+            }
+            static void close_(lex_nfa const & nfa, std::vector<int> & set,
+                               std::vector<char> & seen)
+            {
+                for(std::size_t i = 0; i != set.size(); ++i)
+                    for(int e : nfa.nodes[static_cast<std::size_t>(set[i])].eps)
+                        if(!seen[static_cast<std::size_t>(e)])
+                        {
+                            seen[static_cast<std::size_t>(e)] = 1;
+                            set.push_back(e);
+                        }
+                for(int n : set)
+                    seen[static_cast<std::size_t>(n)] = 0;
+                std::sort(set.begin(), set.end());
+            }
+            void build_(lex_nfa const & nfa, int start)
+            {
+                std::vector<unsigned char> reps;
+                classify_(nfa, reps);
+
+                std::map<std::vector<int>, std::uint32_t> ids;
+                std::vector<std::vector<int>> sets;
+                std::vector<char> seen(nfa.nodes.size(), 0);
+                auto intern = [&](std::vector<int> set) {
+                    auto const it = ids.emplace(set, std::uint32_t(sets.size()));
+                    if(it.second)
+                    {
+                        if(sets.size() == max_states)
+                            throw lex_error("automaton too large", 0);
+                        sets.push_back(std::move(set));
+                    }
+                    return it.first->second;
+                };
+                intern({});
+                std::vector<int> init{start};
+                seen[static_cast<std::size_t>(start)] = 1;
+                close_(nfa, init, seen);
+                intern(std::move(init));
+
+                for(std::size_t s = 0; s != sets.size(); ++s)
+                {
+                    for(std::size_t c = 0; c != classes_; ++c)
+                    {
+                        std::vector<int> to;
+                        for(int n : sets[s])
+                        {
+                            auto const & node = nfa.nodes[static_cast<std::size_t>(n)];
+                            if(node.next >= 0 && node.set.test(reps[c]) &&
+                               !seen[static_cast<std::size_t>(node.next)])
+                            {
+                                seen[static_cast<std::size_t>(node.next)] = 1;
+                                to.push_back(node.next);
+                            }
+                        }
+                        close_(nfa, to, seen);
+                        auto const id = intern(std::move(to));
+                        next_.push_back(id);
+                    }
+                    // The first pattern wins when several match the same
+                    // text.
+                    int rule = -1;
+                    for(int n : sets[s])
+                    {
+                        int const r = nfa.nodes[static_cast<std::size_t>(n)].rule;
+                        if(r >= 0 && (rule < 0 || r < rule))
+                            rule = r;
+                    }
+                    accept_.push_back(rule);
+                }
+            }
+        };
+
+        // clang-format off
+        CPP_def
+        (
+            template(typename I)
+            concept LexCharIterator,
+                ForwardIterator<I> &&
+                std::is_integral<iter_value_t<I>>::value &&
+                sizeof(iter_value_t<I>) == 1
+        );
+        CPP_def
+        (
+            template(typename I, typename S)
+            concept LexBytes,
+                ContiguousIterator<I> && SizedSentinel<S, I>
+        );
+        // clang-format on
+    } // namespace detail
+    /// \endcond
+
+    /// A set of patterns compiled to a deterministic automaton, to be run
+    /// with `view::lex`. Patterns use a subset of the ECMAScript regular
+    /// expression syntax: literal characters, `.` (any character but a
+    /// newline), bracket expressions such as `[a-z_]` and `[^,]`, the
+    /// escapes `\d \w \s \D \W \S \n \t \r \f \v \0 \xHH`, grouping with
+    /// `(...)` or `(?:...)`, alternation with `|`, and repetition with
+    /// `* + ? {n} {n,} {n,m}`. Anchors, back-references, lookaround and
+    /// lazy repetition are not supported and throw `lex_error`. Patterns
+    /// work on bytes, not on decoded code points.
+    ///
+    /// Building the automaton is done once, in the constructor; copies of
+    /// a `lexer` share it.
+    struct lexer
+    {
+    private:
+        std::shared_ptr<detail::lex_dfa const> dfa_;
+
+    public:
+        /// A lexer that matches nothing.
+        lexer()
+          : lexer(std::vector<std::string>{})
+        {}
+        /// One pattern.
+        explicit lexer(std::string const & pattern)
+          : lexer(std::vector<std::string>{pattern})
+        {}
+        /// Several patterns, or rules. A token is the longest text that
+        /// any of them matches; if several match it, the token belongs to
+        /// the first of those.
+        lexer(std::initializer_list<std::string> rules)
+          : lexer(std::vector<std::string>(rules))
+        {}
+        /// \overload
+        explicit lexer(std::vector<std::string> const & rules)
+          : dfa_(std::make_shared<detail::lex_dfa const>(rules))
+        {}
+
+        /// The number of rules.
+        std::size_t rules() const noexcept
+        {
+            return dfa_->rules_;
+        }
+        /// The number of states of the automaton, including the dead state.
+        std::size_t states() const noexcept
+        {
+            return dfa_->states();
+        }
+
+        /// The end of the longest non-empty prefix of [first, last) that
+        /// one of the rules matches, and the index of that rule; or
+        /// <tt>{first, -1}</tt> if there is none.
+        template<typename I, typename S>
+        auto match(I first, S last) const -> CPP_ret(std::pair<I, int>)( //
+            requires detail::LexCharIterator<I> && Sentinel<S, I>)
+        {
+            return match_(std::move(first), std::move(last),
+                          meta::bool_<detail::LexBytes<I, S>>{});
+        }
+
+        /// Whether a match can begin with the byte \c c.
+        bool can_start(unsigned char c) const noexcept
+        {
+            return dfa_->step(1, c) != 0;
+        }
+
+    private:
+        template<typename I, typename S>
+        std::pair<I, int> match_(I first, S last, std::true_type) const
+        {
+            auto const n = last - first;
+            if(n == 0)
+                return {first, -1};
+            auto const p =
+                reinterpret_cast<unsigned char const *>(detail::addressof(*first));
+            auto const q = match_(p, p + n, std::false_type{});
+            return {first + (q.first - p), q.second};
+        }
+        template<typename I, typename S>
+        std::pair<I, int> match_(I first, S last, std::false_type) const
+        {
+            auto const & dfa = *dfa_;
+            auto const next = dfa.next_.data();
+            auto const accept = dfa.accept_.data();
+            auto const classes = dfa.classes_;
+            std::pair<I, int> result{first, -1};
+            std::uint32_t state = 1;
+            while(first != last)
+            {
+                auto const c = static_cast<unsigned char>(*first);
+                state = next[state * classes + dfa.class_[c]];
+                if(state == 0)
+                    break;
+                ++first;
+                if(accept[state] >= 0)
+                    result = {first, accept[state]};
+            }
+            return result;
+        }
+    };
+
+    /// A token found by `view::lex`: a subrange of the input, and the
+    /// index of the rule that matched it.
+    template<typename I>
+    struct lex_token : view_interface<lex_token<I>>
+    {
+    private:
+        I first_{};
+        I last_{};
+        std::size_t rule_ = 0;
+
+    public:
+        lex_token() = default;
+        lex_token(I first, I last, std::size_t rule)
+          : first_(std::move(first))
+          , last_(std::move(last))
+          , rule_(rule)
+        {}
+        I begin() const
+        {
+            return first_;
+        }
+        I end() const
+        {
+            return last_;
+        }
+        std::size_t rule() const noexcept
+        {
+            return rule_;
+        }
+        // A token refers to the input, so a temporary one can be passed to
+        // ranges::begin and ranges::end.
+        friend I begin(lex_token && tok)
+        {
+            return tok.first_;
+        }
+        friend I begin(lex_token const && tok)
+        {
+            return tok.first_;
+        }
+        friend I end(lex_token && tok)
+        {
+            return tok.last_;
+        }
+        friend I end(lex_token const && tok)
+        {
+            return tok.last_;
+        }
+    };
+
+    /// The tokens of a forward range of characters, according to a
+    /// `lexer`. At each position the longest match of any rule is a
+    /// token; characters at which no rule matches are skipped. Unlike
+    /// `view::tokenize`, nothing is allocated or copied per token, and each
+    /// character is examined a bounded number of times unless the text has
+    /// long partial matches that fail.
+    template<typename Rng>
+    struct lex_view
+      : view_facade<lex_view<Rng>, is_finite<Rng>::value ? finite : unknown>
+    {
+    private:
+        friend range_access;
+        CPP_assert(View<Rng>);
+        CPP_assert(ForwardRange<Rng>);
+        CPP_assert(detail::LexCharIterator<iterator_t<Rng>>);
+
+        Rng rng_{};
+        lexer lexer_{};
+
+        template<bool Const>
+        struct cursor
+        {
+        private:
+            template<bool>
+            friend struct cursor;
+            using Base = meta::const_if_c<Const, Rng>;
+            using Parent = meta::const_if_c<Const, lex_view>;
+            Parent * parent_ = nullptr;
+            iterator_t<Base> first_{};
+            iterator_t<Base> last_{};
+            int rule_ = -1;
+
+            // Find the next token at or after pos.
+            void find_(iterator_t<Base> pos)
+            {
+                auto const end = ranges::end(parent_->rng_);
+                auto const & lx = parent_->lexer_;
+                for(;; ++pos)
+                {
+                    while(pos != end && !lx.can_start(static_cast<unsigned char>(*pos)))
+                        ++pos;
+                    if(pos == end)
+                        break;
+                    auto m = lx.match(pos, end);
+                    if(m.second >= 0)
+                    {
+                        first_ = std::move(pos);
+                        last_ = std::move(m.first);
+                        rule_ = m.second;
+                        return;
+                    }
+                }
+                first_ = last_ = std::move(pos);
+                rule_ = -1;
+            }
+
+        public:
+            cursor() = default;
+            cursor(Parent & parent, iterator_t<Base> pos, bool at_end)
+              : parent_(detail::addressof(parent))
+            {
+                if(at_end)
+                    first_ = last_ = std::move(pos);
+                else
+                    find_(std::move(pos));
+            }
+            CPP_template(bool Other)( //
+                requires Const && (!Other) &&
+                ConvertibleTo<iterator_t<Rng>, iterator_t<Base>>) //
+                cursor(cursor<Other> that)
+              : parent_(that.parent_)
+              , first_(std::move(that.first_))
+              , last_(std::move(that.last_))
+              , rule_(that.rule_)
+            {}
+            lex_token<iterator_t<Base>> read() const
+            {
+                RANGES_EXPECT(rule_ >= 0);
+                return {first_, last_, static_cast<std::size_t>(rule_)};
+            }
+            void next()
+            {
+                RANGES_EXPECT(rule_ >= 0);
+                find_(last_);
+            }
+            bool equal(cursor const & that) const
+            {
+                return first_ == that.first_;
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return rule_ < 0;
+            }
+        };
+
+        cursor<simple_view<Rng>()> begin_cursor()
+        {
+            return {*this, ranges::begin(rng_), false};
+        }
+        CPP_member
+        auto begin_cursor() const -> CPP_ret(cursor<true>)( //
+            requires Range<Rng const>)
+        {
+            return {*this, ranges::begin(rng_), false};
+        }
+        CPP_member
+        auto end_cursor() -> CPP_ret(cursor<simple_view<Rng>()>)( //
+            requires CommonRange<Rng>)
+        {
+            return {*this, ranges::end(rng_), true};
+        }
+        CPP_member
+        auto end_cursor() -> CPP_ret(default_sentinel_t)( //
+            requires(!CommonRange<Rng>))
+        {
+            return {};
+        }
+        CPP_member
+        auto end_cursor() const -> CPP_ret(cursor<true>)( //
+            requires CommonRange<Rng const>)
+        {
+            return {*this, ranges::end(rng_), true};
+        }
+        CPP_member
+        auto end_cursor() const -> CPP_ret(default_sentinel_t)( //
+            requires Range<Rng const> && (!CommonRange<Rng const>))
+        {
+            return {};
+        }
+
+    public:
+        lex_view() = default;
+        lex_view(Rng rng, lexer lx)
+          : rng_(std::move(rng))
+          , lexer_(std::move(lx))
+        {}
+        Rng base() const
+        {
+            return rng_;
+        }
+        lexer const & get_lexer() const noexcept
+        {
+            return lexer_;
+        }
+    };
+
+    namespace view
+    {
+        struct lex_fn
+        {
+        private:
+            friend view_access;
+            static auto bind(lex_fn lex, lexer lx)
+            {
+                return make_pipeable(bind_back(lex, std::move(lx)));
+            }
+
+        public:
+            template<typename Rng>
+            auto operator()(Rng && rng, lexer lx) const
+                -> CPP_ret(lex_view<all_t<Rng>>)( //
+                    requires ViewableRange<Rng> && ForwardRange<Rng> &&
+                        detail::LexCharIterator<iterator_t<Rng>>)
+            {
+                return {all(static_cast<Rng &&>(rng)), std::move(lx)};
+            }
+        };
+
+        /// \relates lex_fn
+        /// \ingroup group-views
+        /// \sa `lex_view`, `lexer`
+        RANGES_INLINE_VARIABLE(view<lex_fn>, lex)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,200 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MEMOIZE_HPP
+#define RANGES_V3_VIEW_MEMOIZE_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <meta/meta.hpp>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// A forward view of the elements of \c Rng that remembers the values of
+    /// the most recently read positions, so that dereferencing iterators to
+    /// the same position, whether the same iterator twice or copies of it,
+    /// evaluates <tt>*it</tt> of the underlying iterator once. The cache has
+    /// \c capacity slots and position \c i lives in slot
+    /// <tt>i % capacity</tt>, so a position is recomputed only after
+    /// \c capacity later positions have been read. Elements are returned by
+    /// value, since a slot can be reused while an earlier reference to it is
+    /// still alive. The cache lives in the view, which is therefore not
+    /// const-iterable.
+    template<typename Rng>
+    struct memoize_view
+      : view_facade<memoize_view<Rng>, range_cardinality<Rng>::value>
+    {
+    private:
+        friend range_access;
+        CPP_assert(View<Rng>);
+        CPP_assert(ForwardRange<Rng>);
+        CPP_assert(CopyConstructible<range_value_t<Rng>>);
+        CPP_assert(Constructible<range_value_t<Rng>, range_reference_t<Rng>>);
+
+        using value_type_ = range_value_t<Rng>;
+
+        // A position of the cache, and its value if pos is not -1.
+        struct slot
+        {
+            std::ptrdiff_t pos = -1;
+            optional<value_type_> value;
+        };
+
+        RANGES_NO_UNIQUE_ADDRESS Rng rng_{};
+        std::size_t capacity_ = 16;
+        // Direct-mapped from positions; a copy of the view starts without it.
+        detail::non_propagating_cache<std::vector<slot>> cache_;
+
+        value_type_ const & read_(std::ptrdiff_t pos, iterator_t<Rng> const & it)
+        {
+            if(!cache_)
+                cache_.emplace(capacity_);
+            auto & slots = *cache_;
+            auto & s = slots[static_cast<std::size_t>(pos) % capacity_];
+            if(s.pos != pos)
+            {
+                s.pos = -1;
+                s.value.emplace(*it);
+                s.pos = pos;
+            }
+            return *s.value;
+        }
+
+        struct sentinel
+        {
+            sentinel_t<Rng> end_;
+        };
+
+        struct cursor
+        {
+        private:
+            memoize_view * parent_ = nullptr;
+            iterator_t<Rng> it_{};
+            std::ptrdiff_t pos_ = 0;
+
+        public:
+            cursor() = default;
+            cursor(memoize_view & rng, iterator_t<Rng> it)
+              : parent_(detail::addressof(rng))
+              , it_(std::move(it))
+            {}
+            value_type_ read() const
+            {
+                return parent_->read_(pos_, it_);
+            }
+            void next()
+            {
+                ++it_;
+                ++pos_;
+            }
+            bool equal(cursor const & that) const
+            {
+                return it_ == that.it_;
+            }
+            bool equal(sentinel const & that) const
+            {
+                return it_ == that.end_;
+            }
+        };
+        cursor begin_cursor()
+        {
+            return {*this, ranges::begin(rng_)};
+        }
+        // The end position is never read, so its index does not matter.
+        cursor end_(std::true_type)
+        {
+            return {*this, ranges::end(rng_)};
+        }
+        sentinel end_(std::false_type)
+        {
+            return {ranges::end(rng_)};
+        }
+        meta::if_c<(bool)CommonRange<Rng>, cursor, sentinel> end_cursor()
+        {
+            return end_(meta::bool_<(bool)CommonRange<Rng>>{});
+        }
+
+    public:
+        memoize_view() = default;
+        memoize_view(Rng rng, std::size_t capacity)
+          : rng_(std::move(rng))
+          , capacity_(capacity)
+        {
+            RANGES_EXPECT(capacity > 0);
+        }
+        CPP_member
+        constexpr auto CPP_fun(size)()(requires SizedRange<Rng>)
+        {
+            return ranges::size(rng_);
+        }
+        Rng base() const
+        {
+            return rng_;
+        }
+    };
+
+    namespace view
+    {
+        /// The default number of values a `memoize_view` remembers.
+        constexpr std::size_t memoize_capacity = 16;
+
+        struct memoize_fn
+        {
+        private:
+            friend view_access;
+            static auto bind(memoize_fn memoize, std::size_t capacity)
+            {
+                return make_pipeable(bind_back(memoize, capacity));
+            }
+
+        public:
+            template<typename Rng>
+            auto operator()(Rng && rng, std::size_t capacity = memoize_capacity) const
+                -> CPP_ret(memoize_view<all_t<Rng>>)( //
+                    requires ViewableRange<Rng> && ForwardRange<Rng> &&
+                        CopyConstructible<range_value_t<Rng>> &&
+                        Constructible<range_value_t<Rng>, range_reference_t<Rng>>)
+            {
+                return {all(static_cast<Rng &&>(rng)), capacity};
+            }
+        };
+
+        /// \relates memoize_fn
+        /// \ingroup group-views
+        /// \sa `memoize_view`
+        RANGES_INLINE_VARIABLE(view<memoize_fn>, memoize)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
@@ -0,0 +1,178 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_PAR_TRANSFORM_HPP
+#define RANGES_V3_VIEW_PAR_TRANSFORM_HPP
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <range/v3/range_fwd.hpp>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/functional/invoke.hpp>
+#include <range/v3/functional/pipeable.hpp>
+#include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/async_stage.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    /// \addtogroup group-views
+    /// @{
+
+    /// An input view of the results of applying \c fun to the elements of
+    /// \c Rng, in order, which are computed ahead of the consumer on a pool
+    /// of threads. Use it in place of `view::transform` when \c fun is
+    /// expensive, like decoding or decompressing a record.
+    ///
+    /// The threads start on the first call to \c begin. They take the
+    /// elements of \c Rng in turn and call \c fun on them at the same time,
+    /// so \c fun is called through a const reference and must be safe to
+    /// call concurrently. Over an input range, like `getlines`, each element
+    /// is copied before the next is read, and \c fun gets the copy as an
+    /// rvalue if it can take one. The results wait for the consumer in a
+    /// window of exactly \c window slots, and a thread whose result does not
+    /// fit waits for the consumer, so there are never more than \c window
+    /// results, plus one per thread and the current one, alive at once. The
+    /// reference type is an lvalue reference to the current result.
+    ///
+    /// An exception thrown by \c fun or by \c Rng is rethrown to the consumer
+    /// from the increment that would have reached the element. Destroying
+    /// the view stops the threads and waits for the calls in progress.
+    template<typename Rng, typename Fun>
+    struct par_transform_view
+      : view_facade<par_transform_view<Rng, Fun>,
+                    (range_cardinality<Rng>::value >= 0 ? finite
+                                                        : range_cardinality<Rng>::value)>
+    {
+    private:
+        friend range_access;
+        using state_t = detail::async_stage_state<Rng, semiregular_t<Fun>>;
+        using result_t =
+            detail::decay_t<invoke_result_t<Fun const &, range_reference_t<Rng>>>;
+
+        RANGES_NO_UNIQUE_ADDRESS Rng rng_{};
+        RANGES_NO_UNIQUE_ADDRESS semiregular_t<Fun> fun_;
+        std::size_t window_ = 64;
+        std::size_t threads_ = 1;
+        std::shared_ptr<state_t> state_;
+
+        struct cursor
+        {
+        private:
+            friend range_access;
+            using single_pass = std::true_type;
+            state_t * state_ = nullptr;
+
+        public:
+            cursor() = default;
+            explicit cursor(state_t & state)
+              : state_(&state)
+            {}
+            result_t & read() const
+            {
+                return state_->current();
+            }
+            void next()
+            {
+                state_->next();
+            }
+            bool equal(default_sentinel_t) const
+            {
+                return state_->done();
+            }
+        };
+        cursor begin_cursor()
+        {
+            if(!state_)
+            {
+                state_ = std::make_shared<state_t>(std::move(rng_), fun_, threads_,
+                                                   window_, async_order::ordered);
+                state_->next();
+            }
+            return cursor{*state_};
+        }
+
+    public:
+        par_transform_view() = default;
+        par_transform_view(Rng rng, Fun fun, std::size_t window, std::size_t threads)
+          : rng_(std::move(rng))
+          , fun_(std::move(fun))
+          , window_(window)
+          , threads_(threads)
+        {
+            RANGES_EXPECT(window > 0);
+            RANGES_EXPECT(threads > 0);
+        }
+    };
+
+    namespace view
+    {
+        /// The default number of results a `view::par_transform` computes
+        /// ahead of the consumer.
+        constexpr std::size_t par_transform_window = 64;
+
+        struct par_transform_fn
+        {
+        private:
+            friend view_access;
+            template<typename Fun>
+            static auto bind(par_transform_fn par_transform, Fun fun,
+                             std::size_t window = par_transform_window,
+                             std::size_t threads = 0)
+            {
+                return make_pipeable(
+                    bind_back(par_transform, std::move(fun), window, threads));
+            }
+
+        public:
+            /// \param threads The number of threads; 0 means
+            /// \c std::thread::hardware_concurrency().
+            template<typename Rng, typename Fun>
+            auto operator()(Rng && rng, Fun fun,
+                            std::size_t window = par_transform_window,
+                            std::size_t threads = 0) const
+                -> CPP_ret(par_transform_view<all_t<Rng>, Fun>)( //
+                    requires ViewableRange<Rng> && InputRange<Rng> &&
+                        CopyConstructible<Fun> &&
+                        Invocable<Fun const &, range_reference_t<Rng>> &&
+                        Constructible<range_value_t<Rng>, range_reference_t<Rng>> &&
+                        MoveConstructible<detail::decay_t<
+                            invoke_result_t<Fun const &, range_reference_t<Rng>>>>)
+            {
+                if(threads == 0)
+                    threads = std::thread::hardware_concurrency();
+                return {all(static_cast<Rng &&>(rng)), std::move(fun), window,
+                        threads ? threads : 1};
+            }
+        };
+
+        /// \relates par_transform_fn
+        /// \ingroup group-views
+        /// \sa `par_transform_view`
+        RANGES_INLINE_VARIABLE(view<par_transform_fn>, par_transform)
+    } // namespace view
+    /// @}
+} // namespace ranges
+
+#endif
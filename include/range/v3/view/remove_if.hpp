@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_VIEW_REMOVE_IF_HPP
 #define RANGES_V3_VIEW_REMOVE_IF_HPP
 
+#include <cstddef>
 #include <type_traits>
 #include <utility>
 
@@ -21,12 +22,16 @@
 
 #include <range/v3/range_fwd.hpp>
 
+#include <range/v3/detail/simd_compact.hpp>
 #include <range/v3/functional/bind_back.hpp>
 #include <range/v3/functional/compose.hpp>
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/range/access.hpp>
+#include <range/v3/range/primitives.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
 #include <range/v3/utility/box.hpp>
 #include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/semiregular.hpp>
@@ -51,10 +56,43 @@ namespace ranges
           : remove_if_view::view_adaptor{detail::move(rng)}
           , remove_if_view::box(detail::move(pred))
         {}
+        /// At most as many elements as the underlying range.
+        constexpr size_bounds size_hint() const
+        {
+            return ranges::size_hint(this->base()).at_most();
+        }
 
     private:
         friend range_access;
 
+        template<typename Cont>
+        using simd_collectable_ = meta::bool_<
+            detail::simd_compactable_<iterator_t<Rng>, sentinel_t<Rng>,
+                                      semiregular_t<Pred>, identity>::value &&
+            ContiguousRange<Cont> && Same<range_value_t<Cont>, range_value_t<Rng>>>;
+
+        // Lets ranges::to pick the elements out of a contiguous base with
+        // the kernels remove_if uses, rather than push them back one by one.
+        template<typename Cont,
+                 typename = decltype(std::declval<Cont &>().resize(std::size_t{}))>
+        friend auto to_container_append_(Cont & c, remove_if_view & rng)
+            -> CPP_ret(void)( //
+                requires simd_collectable_<Cont>::value)
+        {
+            auto first = ranges::begin(rng.base());
+            auto const n = ranges::end(rng.base()) - first;
+            if(n <= 0)
+                return;
+            auto const size = c.size();
+            c.resize(size + static_cast<std::size_t>(n));
+            std::size_t const k = detail::simd_compact<false, false>(
+                detail::addressof(*first),
+                static_cast<std::size_t>(n),
+                ranges::data(c) + size,
+                rng.remove_if_view::box::get());
+            c.resize(size + k);
+        }
+
         struct adaptor : adaptor_base
         {
             adaptor() = default;
@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_VIEW_SPLIT_HPP
 #define RANGES_V3_VIEW_SPLIT_HPP
 
+#include <cstddef>
+#include <cstring>
 #include <type_traits>
 #include <utility>
 
@@ -24,13 +26,17 @@
 #include <range/v3/algorithm/mismatch.hpp>
 #include <range/v3/functional/bind_back.hpp>
 #include <range/v3/iterator/default_sentinel.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
+#include <range/v3/utility/addressof.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/interface.hpp>
 #include <range/v3/view/single.hpp>
+#include <range/v3/view/subrange.hpp>
 #include <range/v3/view/view.hpp>
 
 namespace ranges
@@ -52,7 +58,153 @@ namespace ranges
                     std::remove_reference_t<R>::size()>> &&
                 (std::remove_reference_t<R>::size() <= 1)
         );
+
+        // Contiguous sequences of one-byte integers, in which a search for
+        // the pattern is a search for its bytes.
+        CPP_def
+        (
+            template(typename I, typename S, typename PI, typename PS)
+            concept split_bytes_,
+                ContiguousIterator<I> && SizedSentinel<S, I> &&
+                ContiguousIterator<PI> && SizedSentinel<PS, PI> &&
+                Same<iter_value_t<I>, iter_value_t<PI>> &&
+                std::is_integral<iter_value_t<I>>::value &&
+                sizeof(iter_value_t<I>) == 1
+        );
         // clang-format on
+
+        template<typename I, typename S, typename PI, typename PS>
+        using split_bytes = meta::bool_<split_bytes_<I, S, PI, PS>>;
+
+        // Patterns at least this long are searched for with Horspool's
+        // algorithm; shorter ones by looking for their first byte with
+        // memchr and comparing the rest.
+        constexpr std::ptrdiff_t split_horspool_min = 5;
+
+        struct split_no_table
+        {
+            split_no_table() = default;
+            template<typename P>
+            constexpr explicit split_no_table(P const &) noexcept
+            {}
+        };
+
+        // How far Horspool's algorithm can move the pattern along when the
+        // text under its last element is a given byte. Shifts are capped at
+        // 255, which is only ever too cautious.
+        struct split_horspool_table
+        {
+            unsigned char shift_[256] = {};
+
+            constexpr split_horspool_table() noexcept
+            {
+                for(auto & s : shift_)
+                    s = 1;
+            }
+            template<typename P>
+            constexpr explicit split_horspool_table(P const & pattern)
+              : split_horspool_table()
+            {
+                auto const m = ranges::distance(pattern);
+                if(m < split_horspool_min)
+                    return;
+                for(auto & s : shift_)
+                    s = static_cast<unsigned char>(m < 255 ? m : 255);
+                std::ptrdiff_t i = 0;
+                for(auto first = ranges::begin(pattern); i != m - 1; ++first, ++i)
+                {
+                    auto const shift = m - 1 - i;
+                    shift_[static_cast<unsigned char>(*first)] =
+                        static_cast<unsigned char>(shift < 255 ? shift : 255);
+                }
+            }
+        };
+
+        template<typename V, typename Pattern>
+        using split_table_t =
+            if_then_t<split_bytes<iterator_t<V>, sentinel_t<V>, iterator_t<Pattern>,
+                                  sentinel_t<Pattern>>::value &&
+                          !tiny_range<Pattern>,
+                      split_horspool_table, split_no_table>;
+
+        // The offset of the first occurrence of the m-byte pattern in the
+        // n-byte text, or n.
+        inline std::ptrdiff_t split_search_bytes(unsigned char const * text,
+                                                 std::ptrdiff_t n,
+                                                 unsigned char const * pat,
+                                                 std::ptrdiff_t m, split_no_table)
+        {
+            if(m == 1)
+            {
+                void const * const p =
+                    std::memchr(text, pat[0], static_cast<std::size_t>(n));
+                return p ? static_cast<unsigned char const *>(p) - text : n;
+            }
+            for(std::ptrdiff_t i = 0; n - i >= m; ++i)
+            {
+                auto const room = static_cast<std::size_t>(n - i - m + 1);
+                void const * const p = std::memchr(text + i, pat[0], room);
+                if(!p)
+                    break;
+                i = static_cast<unsigned char const *>(p) - text;
+                if(std::memcmp(text + i + 1, pat + 1, static_cast<std::size_t>(m - 1)) ==
+                   0)
+                    return i;
+            }
+            return n;
+        }
+        inline std::ptrdiff_t split_search_bytes(unsigned char const * text,
+                                                 std::ptrdiff_t n,
+                                                 unsigned char const * pat,
+                                                 std::ptrdiff_t m,
+                                                 split_horspool_table const & table)
+        {
+            if(m < split_horspool_min)
+                return split_search_bytes(text, n, pat, m, split_no_table{});
+            unsigned char const last = pat[m - 1];
+            for(std::ptrdiff_t i = 0; n - i >= m; i += table.shift_[text[i + m - 1]])
+            {
+                if(text[i + m - 1] == last &&
+                   std::memcmp(text + i, pat, static_cast<std::size_t>(m - 1)) == 0)
+                    return i;
+            }
+            return n;
+        }
+
+        // Find the first occurrence of the non-empty pattern [pfirst, plast)
+        // in [first, last), and return where it begins and ends, or last
+        // twice.
+        template<typename I, typename S, typename PI, typename PS, typename Table>
+        std::pair<I, I> split_find(I first, S last, PI pfirst, PS plast,
+                                   Table const & table, std::true_type) // bytes
+        {
+            auto const n = static_cast<std::ptrdiff_t>(last - first);
+            auto const m = static_cast<std::ptrdiff_t>(plast - pfirst);
+            if(n < m)
+            {
+                auto const end = first + n;
+                return {end, end};
+            }
+            auto const pos = split_search_bytes(
+                reinterpret_cast<unsigned char const *>(detail::addressof(*first)),
+                n,
+                reinterpret_cast<unsigned char const *>(detail::addressof(*pfirst)),
+                m,
+                table);
+            return {first + pos, first + (pos == n ? n : pos + m)};
+        }
+        template<typename I, typename S, typename PI, typename PS, typename Table>
+        constexpr std::pair<I, I> split_find(I first, S last, PI pfirst, PS plast,
+                                             Table const &, std::false_type)
+        {
+            for(; first != last; ++first)
+            {
+                auto const ret = ranges::mismatch(first, last, pfirst, plast);
+                if(ret.in2 == plast)
+                    return {first, ret.in1};
+            }
+            return {first, first};
+        }
     } // namespace detail
 
     template<typename V, typename Pattern>
@@ -290,9 +442,34 @@ namespace ranges
             }
         };
 
+        // A forward outer iterator remembers where its piece ends and where
+        // the next one begins, so that the pattern is looked for once per
+        // piece.
+        template<typename It>
+        struct split_piece
+        {
+            It curr_ = It();
+            It next_ = It();
+            It after_ = It();
+        };
+
+        template<bool>
+        struct split_piece_or_there_
+        {
+            template<typename>
+            using invoke = there;
+        };
+
+        template<>
+        struct split_piece_or_there_<true>
+        {
+            template<typename It>
+            using invoke = split_piece<It>;
+        };
+
         template<typename It>
         using split_outer_iterator_base =
-            meta::invoke<here_or_there_<ForwardIterator<It>>, It>;
+            meta::invoke<split_piece_or_there_<ForwardIterator<It>>, It>;
 
         template<typename JoinView, bool Const>
         struct split_outer_iterator;
@@ -320,6 +497,60 @@ namespace ranges
             {
                 return (parent_->base_);
             }
+            // Find the end of the piece starting at curr_, and the start of
+            // the next one.
+            constexpr void find_next_()
+            {
+                auto const end = ranges::end(base_());
+                auto const pbegin = ranges::begin(parent_->pattern_);
+                auto const pend = ranges::end(parent_->pattern_);
+                if(this->curr_ == end)
+                    this->next_ = this->after_ = this->curr_;
+                else if(pbegin == pend)
+                    this->next_ = this->after_ = ranges::next(this->curr_);
+                else
+                {
+                    auto ret = detail::split_find(
+                        this->curr_,
+                        end,
+                        pbegin,
+                        pend,
+                        parent_->table_,
+                        split_bytes<iterator_t<Base>, sentinel_t<Base>,
+                                    iterator_t<meta::const_if_c<Const, Pattern>>,
+                                    sentinel_t<meta::const_if_c<Const, Pattern>>>{});
+                    this->next_ = std::move(ret.first);
+                    this->after_ = std::move(ret.second);
+                }
+            }
+            constexpr void pre_inc(std::true_type) // Forward
+            {
+                if(this->curr_ == ranges::end(base_()))
+                    return;
+                this->curr_ = this->after_;
+                find_next_();
+            }
+            constexpr void pre_inc(std::false_type) // Input
+            {
+                auto & current = current_();
+                const auto end = ranges::end(base_());
+                if(current == end)
+                    return;
+                auto const pbegin = ranges::begin(parent_->pattern_);
+                auto const pend = ranges::end(parent_->pattern_);
+                if(pbegin == pend)
+                    ++current;
+                else
+                    do
+                    {
+                        const auto ret = ranges::mismatch(current, end, pbegin, pend);
+                        if(ret.in2 == pend)
+                        {
+                            current = ret.in1; // The pattern matched; skip it
+                            break;
+                        }
+                    } while(++current != end);
+            }
 #if RANGES_CXX_IF_CONSTEXPR < RANGES_CXX_IF_CONSTEXPR_17
             constexpr split_outer_iterator post_inc(std::true_type) // Forward
             {
@@ -338,14 +569,16 @@ namespace ranges
                 if_then_t<ForwardRange<Base>, std::forward_iterator_tag,
                           std::input_iterator_tag>;
             using iterator_category = std::input_iterator_tag;
-            struct value_type : view_interface<value_type>
+            /// The pieces of an input range are read through the outer
+            /// iterator.
+            struct input_value_type : view_interface<input_value_type>
             {
             private:
                 split_outer_iterator i_ = split_outer_iterator();
 
             public:
-                value_type() = default;
-                constexpr explicit value_type(split_outer_iterator i)
+                input_value_type() = default;
+                constexpr explicit input_value_type(split_outer_iterator i)
                   : i_(std::move(i))
                 {}
                 constexpr split_inner_iterator<split_view<V, Pattern>, Const> begin()
@@ -358,6 +591,10 @@ namespace ranges
                     return default_sentinel;
                 }
             };
+            /// The pieces of a forward range are subranges of it, which are
+            /// contiguous if it is.
+            using value_type = if_then_t<ForwardRange<Base>, subrange<iterator_t<Base>>,
+                                         input_value_type>;
             using difference_type = range_difference_t<Base>;
             using reference = value_type; // Not to spec
             using pointer = value_type *; // Not to spec
@@ -376,42 +613,35 @@ namespace ranges
                 requires ForwardRange<Base>)
               : Current{std::move(current)}
               , parent_(&parent)
-            {}
+            {
+                find_next_();
+            }
 
             CPP_template(bool Other)( //
                 requires Const && (!Other) &&
                 ConvertibleTo<iterator_t<V>, iterator_t<Base>>) //
                 constexpr split_outer_iterator(
                     split_outer_iterator<split_view<V, Pattern>, Other> i)
-              : Current{std::move(i.curr_)}
+              : Current{std::move(i.curr_), std::move(i.next_), std::move(i.after_)}
               , parent_(i.parent_)
             {}
 
-            constexpr value_type operator*() const
+            CPP_member
+            constexpr auto operator*() const -> CPP_ret(value_type)( //
+                requires ForwardRange<Base>)
+            {
+                return {this->curr_, this->next_};
+            }
+            CPP_member
+            constexpr auto operator*() const -> CPP_ret(value_type)( //
+                requires(!ForwardRange<Base>))
             {
                 return value_type{*this};
             }
 
             constexpr split_outer_iterator & operator++()
             {
-                auto & current = current_();
-                const auto end = ranges::end(base_());
-                if(current == end)
-                    return *this;
-                auto const pbegin = ranges::begin(parent_->pattern_);
-                auto const pend = ranges::end(parent_->pattern_);
-                if(pbegin == pend)
-                    ++current;
-                else
-                    do
-                    {
-                        const auto ret = ranges::mismatch(current, end, pbegin, pend);
-                        if(ret.in2 == pend)
-                        {
-                            current = ret.in1; // The pattern matched; skip it
-                            break;
-                        }
-                    } while(++current != end);
+                pre_inc(meta::bool_<ForwardRange<Base>>{});
                 return *this;
             }
 
@@ -502,6 +732,7 @@ namespace ranges
 
         V base_ = V();
         Pattern pattern_ = Pattern();
+        RANGES_NO_UNIQUE_ADDRESS detail::split_table_t<V, Pattern> table_{};
         template<bool Const>
         using outer_iterator = detail::split_outer_iterator<split_view, Const>;
 
@@ -532,6 +763,7 @@ namespace ranges
         constexpr split_view(V base, Pattern pattern)
           : base_((V &&) base)
           , pattern_((Pattern &&) pattern)
+          , table_(pattern_)
         {}
 
         CPP_member
@@ -539,12 +771,19 @@ namespace ranges
             requires Constructible<Pattern, range_value_t<V>>)
           : base_(std::move(base))
           , pattern_(e)
+          , table_(pattern_)
         {}
 
         constexpr V base() const
         {
             return base_;
         }
+        /// There is at most one more piece than there are elements.
+        constexpr size_bounds size_hint() const
+        {
+            auto const b = ranges::size_hint(base_);
+            return {0, b.bounded() ? b.upper + 1 : size_bounds::unbounded};
+        }
 
         constexpr auto begin()
         {
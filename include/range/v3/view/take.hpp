@@ -23,6 +23,7 @@
 #include <range/v3/iterator/counted_iterator.hpp>
 #include <range/v3/iterator/default_sentinel.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/all.hpp>
@@ -157,6 +158,11 @@ namespace ranges
         {
             return base_;
         }
+        constexpr size_bounds size_hint() const
+        {
+            return detail::size_bounds_min(ranges::size_hint(base_),
+                                           static_cast<std::size_t>(count_));
+        }
 
         CPP_member
         constexpr auto CPP_fun(begin)()(requires(!simple_view<Rng>()))
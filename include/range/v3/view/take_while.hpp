@@ -27,6 +27,7 @@
 #include <range/v3/functional/invoke.hpp>
 #include <range/v3/iterator/concepts.hpp>
 #include <range/v3/range/concepts.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/adaptor.hpp>
@@ -86,6 +87,11 @@ namespace ranges
           : iter_take_while_view::view_adaptor{std::move(rng)}
           , pred_(std::move(pred))
         {}
+        /// At most as many elements as the underlying range.
+        constexpr size_bounds size_hint() const
+        {
+            return ranges::size_hint(this->base()).at_most();
+        }
     };
 
     template<typename Rng, typename Pred>
@@ -30,6 +30,7 @@
 #include <range/v3/iterator/operations.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/range/size_hint.hpp>
 #include <range/v3/range/traits.hpp>
 #include <range/v3/utility/move.hpp>
 #include <range/v3/utility/semiregular.hpp>
@@ -168,6 +169,10 @@ namespace ranges
           : iter_transform_view::view_adaptor{std::move(rng)}
           , fun_(std::move(fun))
         {}
+        constexpr size_bounds size_hint() const
+        {
+            return ranges::size_hint(this->base());
+        }
         CPP_member
         constexpr auto CPP_fun(size)()(requires SizedRange<Rng>)
         {
@@ -0,0 +1,111 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the cost per element of driving many concurrent streams, each of
+// which waits one tick of an event_loop before every element, through a
+// filter, a transform and a for_each, on one thread; against the same
+// pipeline over synchronous generators that never wait.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include <range/v3/experimental/utility/async_algorithm.hpp>
+#include <range/v3/experimental/utility/async_generator.hpp>
+#include <range/v3/experimental/utility/event_loop.hpp>
+#include <range/v3/experimental/utility/generator.hpp>
+#include <range/v3/experimental/utility/task.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/transform.hpp>
+
+#if RANGES_CXX_COROUTINES < RANGES_CXX_COROUTINES_TS1
+#error This benchmark uses coroutines.
+#endif
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    namespace async = ranges::experimental::async;
+    using ranges::experimental::async_generator;
+    using ranges::experimental::event_loop;
+    using ranges::experimental::generator;
+    using ranges::experimental::task;
+
+    // Keeps the optimizer from discarding the sums.
+    volatile std::int64_t sink;
+
+    constexpr int elements = 100;
+
+    auto const is_odd = [](int i) { return i % 2 == 1; };
+    auto const square = [](int i) { return i * i; };
+
+    async_generator<int> stream(event_loop & loop)
+    {
+        for(int i = 0; i < elements; ++i)
+        {
+            co_await loop.delay(1);
+            co_yield i;
+        }
+    }
+
+    task<> consume(event_loop & loop, std::int64_t & sum)
+    {
+        co_await async::for_each(stream(loop) | async::filter(is_odd) |
+                                     async::transform(square),
+                                 [&](int i) { sum += i; });
+    }
+
+    generator<int> sync_stream()
+    {
+        for(int i = 0; i < elements; ++i)
+            co_yield i;
+    }
+
+    template<typename Fun>
+    void report(char const * name, int streams, Fun fun)
+    {
+        auto const start = clock_t::now();
+        sink = fun();
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(8) << name << std::setw(10) << streams << std::setw(12)
+                  << d.count() / (double(streams) * elements) << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "#   source   streams  ns/element\n";
+    for(int streams : {100, 1000, 10000, 100000})
+    {
+        report("async", streams, [=] {
+            event_loop loop;
+            std::vector<std::int64_t> sums(static_cast<std::size_t>(streams));
+            for(auto & sum : sums)
+                loop.spawn(consume(loop, sum));
+            loop.run();
+            std::int64_t total = 0;
+            for(auto sum : sums)
+                total += sum;
+            return total;
+        });
+    }
+    report("sync", 10000, [] {
+        std::int64_t total = 0;
+        for(int s = 0; s < 10000; ++s)
+            for(int i : sync_stream() | ranges::view::filter(is_odd) |
+                            ranges::view::transform(square))
+                total += i;
+        return total;
+    });
+}
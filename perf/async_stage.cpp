@@ -0,0 +1,98 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures a pipeline with an expensive parse before a filter and an
+// expensive enrichment after it, run on one thread, and split by
+// view::async_stage so that the parse runs on 1, 2 or 4 other threads; and
+// the cost per element of passing cheap elements through a stage.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/async_stage.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using namespace ranges;
+
+    // Keeps the optimizer from discarding the sums.
+    volatile std::uint64_t sink;
+    // Keeps it from computing the sum of the cheap elements at compile time.
+    volatile int cheap_elements = 10000000;
+
+    // About a microsecond of arithmetic that cannot be folded away.
+    std::uint64_t churn(std::uint64_t x)
+    {
+        for(int i = 0; i < 300; ++i)
+            x = x * 6364136223846793005u + 1442695040888963407u;
+        return x;
+    }
+
+    auto const parse = [](int i) { return churn(static_cast<std::uint64_t>(i)); };
+    auto const valid = [](std::uint64_t x) { return x % 4 != 0; };
+    auto const enrich = [](std::uint64_t x) { return churn(x) >> 32; };
+
+    template<typename Fun>
+    void report(char const * name, int n, Fun fun)
+    {
+        auto const start = clock_t::now();
+        sink = fun();
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(16) << name << std::setw(12) << d.count() / n << '\n';
+    }
+} // namespace
+
+int main()
+{
+    int const n = 200000;
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "# " << std::thread::hardware_concurrency() << " hardware threads\n";
+    std::cout << "#       pipeline  ns/element\n";
+    report("serial", n, [=] {
+        return accumulate(view::iota(0, n) | view::transform(parse) |
+                              view::filter(valid) | view::transform(enrich),
+                          std::uint64_t{0});
+    });
+    for(std::size_t threads : {1u, 2u, 4u})
+    {
+        char const * const name = threads == 1 ? "stage(1)" : threads == 2 ? "stage(2)"
+                                                                             : "stage(4)";
+        report(name, n, [=] {
+            return accumulate(view::iota(0, n) | view::transform(parse) |
+                                  view::async_stage(threads, 256) | view::filter(valid) |
+                                  view::transform(enrich),
+                              std::uint64_t{0});
+        });
+    }
+    report("stage(4) any", n, [=] {
+        return accumulate(view::iota(0, n) | view::transform(parse) |
+                              view::async_stage(4, 256, async_order::unordered) |
+                              view::filter(valid) | view::transform(enrich),
+                          std::uint64_t{0});
+    });
+
+    int const m = cheap_elements;
+    report("serial ints", m, [=] {
+        return accumulate(view::iota(0, m), std::uint64_t{0});
+    });
+    report("stage(1) ints", m, [=] {
+        return accumulate(view::iota(0, m) | view::async_stage(1, 1024),
+                          std::uint64_t{0});
+    });
+}
@@ -0,0 +1,91 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures view::transform(expensive) | view::filter(pred), which evaluates
+// the transform once when the filter tests an element and again when the
+// loop reads it, against the same pipeline with view::cache1 or
+// view::memoize between the two adaptors.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <range/v3/all.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+
+    constexpr int n = 1 << 18;
+    constexpr int reps = 10;
+
+    // Keeps the optimizer from discarding the sums.
+    volatile std::uint64_t sink;
+    std::uint64_t calls = 0;
+
+    // A few dozen rounds of a 64-bit mixing function.
+    std::uint64_t expensive(int i)
+    {
+        ++calls;
+        auto x = static_cast<std::uint64_t>(i);
+        for(int r = 0; r < 32; ++r)
+        {
+            x ^= x >> 33;
+            x *= 0xff51afd7ed558ccdULL;
+            x ^= x >> 29;
+        }
+        return x;
+    }
+
+    bool keep(std::uint64_t x)
+    {
+        return (x & 3) != 0;
+    }
+
+    template<typename MakeRng>
+    void run(char const * name, MakeRng make)
+    {
+        calls = 0;
+        auto const start = clock_t::now();
+        for(int r = 0; r < reps; ++r)
+        {
+            auto rng = make();
+            std::uint64_t sum = 0;
+            auto const last = ranges::end(rng);
+            for(auto it = ranges::begin(rng); it != last; ++it)
+                sum += *it;
+            sink = sum;
+        }
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(10) << name << std::setw(16)
+                  << double(calls) / (double(n) * reps) << std::setw(16)
+                  << d.count() / (double(n) * reps) << '\n';
+    }
+} // namespace
+
+int main()
+{
+    using namespace ranges;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "#  adaptor  calls/element    ns/element\n";
+    run("none", [] {
+        return view::iota(0, n) | view::transform(expensive) | view::filter(keep);
+    });
+    run("cache1", [] {
+        return view::iota(0, n) | view::transform(expensive) | view::cache1 |
+               view::filter(keep);
+    });
+    run("memoize", [] {
+        return view::iota(0, n) | view::transform(expensive) | view::memoize |
+               view::filter(keep);
+    });
+}
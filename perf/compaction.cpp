@@ -0,0 +1,91 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures copy_if, remove_if, unique, partition and stable_partition on ten
+// million ints, on one thread and with par(threads) for 2, 4 and all
+// hardware threads, at a selectivity of one half.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/remove_if.hpp>
+#include <range/v3/algorithm/stable_partition.hpp>
+#include <range/v3/algorithm/unique.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using namespace ranges;
+
+    // Keeps the optimizer from discarding the results.
+    volatile std::ptrdiff_t sink;
+
+    auto const odd = [](int i) { return (i & 1) != 0; };
+
+    // Runs fun on a fresh copy of v and reports the time per element.
+    template<typename Fun>
+    void report(char const * name, std::size_t threads, std::vector<int> const & v,
+                Fun fun)
+    {
+        std::vector<int> w = v;
+        auto const start = clock_t::now();
+        sink = fun(w);
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(18) << name << std::setw(8) << threads << std::setw(12)
+                  << d.count() / static_cast<double>(v.size()) << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::size_t const n = 10000000;
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist(0, 1 << 20);
+    std::vector<int> v(n);
+    for(auto & i : v)
+        i = dist(gen);
+    // Runs of up to four equal elements, for unique.
+    std::vector<int> runs(n);
+    for(std::size_t i = 0; i < n; ++i)
+        runs[i] = static_cast<int>(i / (1 + i % 4));
+
+    std::size_t const hw = (std::max)(std::thread::hardware_concurrency(), 1u);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "# " << hw << " hardware threads\n";
+    std::cout << "#        algorithm threads  ns/element\n";
+    std::vector<int> out(n);
+    for(std::size_t threads : {std::size_t{1}, std::size_t{2}, std::size_t{4}, hw})
+    {
+        auto const pol = par(threads);
+        report("copy_if", threads, v, [&](std::vector<int> & w) {
+            return copy_if(pol, w, out.begin(), odd).out - out.begin();
+        });
+        report("remove_if", threads, v, [&](std::vector<int> & w) {
+            return remove_if(pol, w, odd) - w.begin();
+        });
+        report("unique", threads, runs, [&](std::vector<int> & w) {
+            return unique(pol, w) - w.begin();
+        });
+        report("partition", threads, v, [&](std::vector<int> & w) {
+            return partition(pol, w, odd) - w.begin();
+        });
+        report("stable_partition", threads, v, [&](std::vector<int> & w) {
+            return stable_partition(pol, w, odd) - w.begin();
+        });
+    }
+}
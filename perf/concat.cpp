@@ -0,0 +1,101 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the cost per element of iterating, dereferencing and comparing
+// the iterators of view::concat over N ranges against a plain loop over one
+// vector holding the same elements. Over N vectors, which share an iterator
+// type, concat holds a single iterator; over vectors alternating with spans
+// ("mixed"), it holds a variant of the two and dispatches on it.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include <range/v3/all.hpp>
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+
+    constexpr std::size_t total = std::size_t{1} << 22;
+    constexpr int reps = 20;
+
+    // Keeps the optimizer from discarding the sums.
+    volatile std::int64_t sink;
+
+    // The best of reps passes, which is steadier than the mean on a busy
+    // machine.
+    template<typename Rng>
+    double ns_per_element(Rng && rng)
+    {
+        double best = 0;
+        for(int r = 0; r < reps; ++r)
+        {
+            auto const start = clock_t::now();
+            std::int64_t sum = 0;
+            for(auto && i : rng)
+                sum += i;
+            sink = sum;
+            std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+            if(r == 0 || d.count() < best)
+                best = d.count();
+        }
+        return best / double(total);
+    }
+
+    // Every other part as a span, so that concat sees two iterator types.
+    template<std::size_t I>
+    meta::if_c<I % 2 == 0, std::vector<int> &, ranges::span<int>> part(
+        std::vector<int> & v)
+    {
+        return v;
+    }
+
+    template<std::size_t... Is>
+    void run(meta::index_sequence<Is...>)
+    {
+        constexpr std::size_t n = sizeof...(Is);
+        std::vector<std::vector<int>> parts(n);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            parts[i].resize(total / n);
+            std::iota(parts[i].begin(), parts[i].end(), int(i));
+        }
+        std::vector<int> flat;
+        for(auto const & p : parts)
+            flat.insert(flat.end(), p.begin(), p.end());
+
+        double const base = ns_per_element(flat);
+        double const concat = ns_per_element(ranges::view::concat(parts[Is]...));
+        double const mixed =
+            ns_per_element(ranges::view::concat(part<Is>(parts[Is])...));
+        std::cout << std::setw(8) << n << std::setw(16) << base << std::setw(16)
+                  << concat << std::setw(16) << mixed << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "#       N    flat ns/elem  concat ns/elem   mixed ns/elem\n";
+    run(meta::make_index_sequence<2>{});
+    run(meta::make_index_sequence<4>{});
+    run(meta::make_index_sequence<8>{});
+    run(meta::make_index_sequence<12>{});
+    run(meta::make_index_sequence<16>{});
+    run(meta::make_index_sequence<24>{});
+    run(meta::make_index_sequence<32>{});
+}
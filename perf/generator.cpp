@@ -0,0 +1,121 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the cost per element of summing a pseudo-random sequence produced
+// by view::generate, by a generator that yields one value at a time and by one
+// that yields blocks; and the cost per generator of creating many short
+// generators with frames from the global heap and from the frame pool.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <range/v3/all.hpp>
+#include <range/v3/experimental/utility/generator.hpp>
+
+#if RANGES_CXX_COROUTINES < RANGES_CXX_COROUTINES_TS1
+#error This benchmark uses coroutines.
+#endif
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using ranges::experimental::generator;
+
+    constexpr int n = 1 << 24;
+    constexpr int gens = 1 << 20;
+
+    // Keeps the optimizer from discarding the sums.
+    volatile std::int64_t sink;
+
+    // The next value of a linear congruential generator, which the optimizer
+    // cannot sum in closed form.
+    int next_value(std::uint64_t & x)
+    {
+        x = x * 6364136223846793005u + 1442695040888963407u;
+        return static_cast<int>(x >> 40);
+    }
+
+    template<typename Fun>
+    void report(char const * name, std::int64_t count, Fun fun)
+    {
+        auto const start = clock_t::now();
+        sink = fun();
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(12) << name << std::setw(12) << d.count() / double(count)
+                  << '\n';
+    }
+
+    generator<int> one_at_a_time(int count)
+    {
+        std::uint64_t x = 0;
+        for(int i = 0; i < count; ++i)
+            co_yield next_value(x);
+    }
+
+    generator<int> in_blocks(int count)
+    {
+        std::uint64_t x = 0;
+        int buf[256];
+        for(int i = 0; i < count;)
+        {
+            int k = 0;
+            for(; k < 256 && i < count; ++k, ++i)
+                buf[k] = next_value(x);
+            co_yield ranges::make_span(buf, k);
+        }
+    }
+
+    generator<int> heap_frame(std::allocator_arg_t, std::allocator<char>, int count)
+    {
+        std::uint64_t x = 0;
+        for(int i = 0; i < count; ++i)
+            co_yield next_value(x);
+    }
+
+    template<typename Rng>
+    std::int64_t sum(Rng && rng)
+    {
+        std::int64_t s = 0;
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+            s += *it;
+        return s;
+    }
+} // namespace
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "#     source  ns/element\n";
+    report("generate", n, [] {
+        std::uint64_t x = 0;
+        return sum(ranges::view::generate([x]() mutable { return next_value(x); }) |
+                   ranges::view::take_exactly(n));
+    });
+    report("co_yield", n, [] { return sum(one_at_a_time(n)); });
+    report("block", n, [] { return sum(in_blocks(n)); });
+
+    std::cout << "#      frame  ns/generator\n";
+    report("heap", gens, [] {
+        std::int64_t s = 0;
+        for(int i = 0; i < gens; ++i)
+            s += sum(heap_frame(std::allocator_arg, {}, 4));
+        return s;
+    });
+    report("pool", gens, [] {
+        std::int64_t s = 0;
+        for(int i = 0; i < gens; ++i)
+            s += sum(one_at_a_time(4));
+        return s;
+    });
+}
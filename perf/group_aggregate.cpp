@@ -0,0 +1,104 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures summing ten million values into 100,000 groups by an unsorted
+// key: by sorting on the key and folding each run, with group_aggregate on
+// one thread, and with par(threads) for 2, 4 and all hardware threads. Also
+// view::distinct over the keys.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/numeric/group_aggregate.hpp>
+#include <range/v3/range_for.hpp>
+#include <range/v3/view/distinct.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using namespace ranges;
+
+    struct row
+    {
+        std::uint32_t key;
+        std::int64_t value;
+    };
+
+    // Keeps the optimizer from discarding the results.
+    volatile std::ptrdiff_t sink;
+
+    // Runs fun and reports the time per input row.
+    template<typename Fun>
+    void report(char const * name, std::size_t threads, std::size_t n, Fun fun)
+    {
+        auto const start = clock_t::now();
+        sink = fun();
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(16) << name << std::setw(8) << threads << std::setw(12)
+                  << d.count() / static_cast<double>(n) << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::size_t const n = 10000000;
+    std::mt19937 gen;
+    std::uniform_int_distribution<std::uint32_t> keys(0, 99999);
+    std::vector<row> rows(n);
+    for(auto & r : rows)
+        r = {keys(gen), static_cast<std::int64_t>(gen() % 1000)};
+
+    std::size_t const hw = (std::max)(std::thread::hardware_concurrency(), 1u);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "# " << hw << " hardware threads\n";
+    std::cout << "#      algorithm threads      ns/row\n";
+    report("sort and fold", 1, n, [&] {
+        std::vector<row> sorted = rows;
+        sort(sorted, less{}, &row::key);
+        std::vector<std::pair<std::uint32_t, std::int64_t>> groups;
+        for(auto const & r : sorted)
+        {
+            if(groups.empty() || groups.back().first != r.key)
+                groups.emplace_back(r.key, 0);
+            groups.back().second += r.value;
+        }
+        return static_cast<std::ptrdiff_t>(groups.size());
+    });
+    report("group_aggregate", 1, n, [&] {
+        return static_cast<std::ptrdiff_t>(
+            group_aggregate(rows, &row::key, std::int64_t{0}, plus{}, &row::value)
+                .size());
+    });
+    for(std::size_t threads : {std::size_t{2}, std::size_t{4}, hw})
+        report("group_aggregate", threads, n, [&] {
+            return static_cast<std::ptrdiff_t>(group_aggregate(par(threads),
+                                                               rows,
+                                                               &row::key,
+                                                               std::int64_t{0},
+                                                               plus{},
+                                                               &row::value)
+                                                   .size());
+        });
+    report("view::distinct", 1, n, [&] {
+        std::ptrdiff_t count = 0;
+        auto distinct_keys = rows | view::distinct(&row::key);
+        RANGES_FOR(auto const & r, distinct_keys)
+            count += r.key != 0;
+        return count;
+    });
+}
@@ -0,0 +1,102 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures materializing the words of a text from view::split into a
+// jagged_vector<char> and into a vector<vector<char>>, and then copying all
+// the words back into one buffer: with view::join over either container,
+// and with jagged_vector::values(), which is one contiguous range.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/all.hpp>
+#include <range/v3/utility/jagged_vector.hpp>
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+
+    constexpr int reps = 5;
+
+    // Keeps the optimizer from discarding the results.
+    volatile std::int64_t sink;
+
+    std::string make_text(std::size_t words)
+    {
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<int> len{1, 12};
+        std::uniform_int_distribution<int> letter{'a', 'z'};
+        std::string text;
+        for(std::size_t w = 0; w < words; ++w)
+        {
+            for(int i = len(gen); i > 0; --i)
+                text.push_back(static_cast<char>(letter(gen)));
+            text.push_back(' ');
+        }
+        return text;
+    }
+
+    // The best of reps calls of fun, in milliseconds, which is steadier than
+    // the mean on a busy machine.
+    template<typename Fun>
+    void report(char const * name, Fun fun)
+    {
+        double best = 0;
+        for(int r = 0; r < reps; ++r)
+        {
+            auto const start = clock_t::now();
+            sink = fun();
+            std::chrono::duration<double, std::milli> const d = clock_t::now() - start;
+            if(r == 0 || d.count() < best)
+                best = d.count();
+        }
+        std::cout << std::setw(28) << name << std::setw(12) << best << '\n';
+    }
+
+    template<typename Rng>
+    std::int64_t copy_all(Rng && rng, std::vector<char> & out)
+    {
+        out.clear();
+        ranges::copy(rng, ranges::back_inserter(out));
+        return static_cast<std::int64_t>(out.size());
+    }
+} // namespace
+
+int main()
+{
+    using namespace ranges;
+    std::string const text = make_text(std::size_t{3} << 20);
+    auto words = text | view::split(' ');
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "#                    what          ms\n";
+    report("split to vector<vector>", [&] {
+        return (std::int64_t)(words | to<std::vector<std::vector<char>>>()).size();
+    });
+    report("split to jagged_vector", [&] {
+        return (std::int64_t)(words | to<jagged_vector<char>>()).size();
+    });
+
+    auto const nested = words | to<std::vector<std::vector<char>>>();
+    auto const jagged = words | to<jagged_vector<char>>();
+    std::vector<char> out;
+    out.reserve(text.size());
+    report("join vector<vector>", [&] { return copy_all(nested | view::join, out); });
+    report("join jagged_vector", [&] { return copy_all(jagged | view::join, out); });
+    report("jagged_vector::values", [&] { return copy_all(jagged.values(), out); });
+}
@@ -0,0 +1,84 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the cost per input byte of finding the words and numbers in
+// log-like text with view::tokenize, which uses std::regex, and with
+// view::lex, which uses a compiled automaton.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <range/v3/all.hpp>
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+
+    // Keeps the optimizer from discarding the counts.
+    volatile std::int64_t sink;
+
+    std::string make_log(std::size_t size)
+    {
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<int> pick{0, 5};
+        std::uniform_int_distribution<int> num{0, 99999};
+        char const * const words[] = {"GET", "POST", "user", "session", "timeout",
+                                      "ok"};
+        std::string text;
+        while(text.size() < size)
+        {
+            text += "2019-06-" + std::to_string(num(gen) % 28 + 1) + " ";
+            text += "10.0." + std::to_string(num(gen) % 256) + "." +
+                    std::to_string(num(gen) % 256) + " ";
+            text += std::string{"["} + words[pick(gen)] + "] ";
+            text += words[pick(gen)];
+            text += " id=" + std::to_string(num(gen)) + " took " +
+                    std::to_string(num(gen) % 1000) + "ms\n";
+        }
+        return text;
+    }
+
+    template<typename Rng, typename Length>
+    void report(char const * name, std::string const & text, Rng && tokens,
+                Length length)
+    {
+        auto const start = clock_t::now();
+        std::int64_t n = 0;
+        for(auto it = ranges::begin(tokens); it != ranges::end(tokens); ++it)
+            n += 1 + length(*it);
+        sink = n;
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(10) << name << std::setw(14) << n << std::setw(12)
+                  << d.count() / double(text.size()) << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::string const text = make_log(std::size_t{1} << 22);
+    char const * const pattern = R"([A-Za-z_]+|[0-9]+(?:\.[0-9]+)*)";
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "#   method      checksum     ns/byte\n";
+    std::regex const rx{pattern};
+    report("tokenize", text, text | ranges::view::tokenize(rx),
+           [](auto const & m) { return m.length(); });
+    ranges::lexer const lx{pattern};
+    report("lex", text, text | ranges::view::lex(lx),
+           [](auto const & tok) { return ranges::distance(tok); });
+}
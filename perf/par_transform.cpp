@@ -0,0 +1,92 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures summing an expensive function of each element of a vector and of
+// the lines of a stream, with view::transform on the consumer's thread and
+// with view::par_transform on 1, 2, 4 and 8 threads.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/getlines.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/par_transform.hpp>
+#include <range/v3/view/transform.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using namespace ranges;
+
+    // Keeps the optimizer from discarding the sums.
+    volatile std::uint64_t sink;
+
+    // About a microsecond of arithmetic that cannot be folded away.
+    std::uint64_t churn(std::uint64_t x)
+    {
+        for(int i = 0; i < 300; ++i)
+            x = x * 6364136223846793005u + 1442695040888963407u;
+        return x;
+    }
+
+    auto const decode = [](std::string const & line) {
+        return churn(std::stoull(line)) >> 32;
+    };
+
+    template<typename Fun>
+    void report(char const * name, std::size_t threads, int n, Fun fun)
+    {
+        auto const start = clock_t::now();
+        sink = fun();
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(10) << name << std::setw(9) << threads << std::setw(12)
+                  << d.count() / n << '\n';
+    }
+} // namespace
+
+int main()
+{
+    int const n = 200000;
+    std::vector<std::uint64_t> const v = view::iota(0, n) | to<std::vector<std::uint64_t>>;
+    std::string text;
+    for(int i = 0; i < n; ++i)
+        text += std::to_string(i) + '\n';
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "# " << std::thread::hardware_concurrency() << " hardware threads\n";
+    std::cout << "#   source  threads  ns/element\n";
+    report("vector", 0, n, [&] {
+        return accumulate(v | view::transform(churn), std::uint64_t{0});
+    });
+    for(std::size_t threads : {1u, 2u, 4u, 8u})
+        report("vector", threads, n, [&] {
+            return accumulate(v | view::par_transform(churn, 256, threads),
+                              std::uint64_t{0});
+        });
+    report("lines", 0, n, [&] {
+        std::istringstream sin{text};
+        return accumulate(getlines(sin) | view::transform(decode), std::uint64_t{0});
+    });
+    for(std::size_t threads : {1u, 2u, 4u, 8u})
+        report("lines", threads, n, [&] {
+            std::istringstream sin{text};
+            return accumulate(getlines(sin) | view::par_transform(decode, 256, threads),
+                              std::uint64_t{0});
+        });
+}
@@ -0,0 +1,82 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures find_if, any_of and search over fifty million ints with the match
+// near the start, in the middle and nowhere, on one thread and with
+// par(threads) for 2, 4 and all hardware threads. An early match should cost
+// little more than the sequential search; no match, a full parallel scan.
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <range/v3/algorithm/any_of.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/search.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using namespace ranges;
+
+    // Keeps the optimizer from discarding the results.
+    volatile std::ptrdiff_t sink;
+
+    // Runs fun and reports the time in milliseconds.
+    template<typename Fun>
+    void report(char const * name, char const * where, std::size_t threads, Fun fun)
+    {
+        auto const start = clock_t::now();
+        sink = fun();
+        std::chrono::duration<double, std::milli> const d = clock_t::now() - start;
+        std::cout << std::setw(10) << name << std::setw(8) << where << std::setw(8)
+                  << threads << std::setw(10) << d.count() << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::size_t const n = 50000000;
+    std::vector<int> v(n, 0);
+    int const needle[] = {1, 2, 3};
+    auto const is_one = [](int i) { return i == 1; };
+
+    std::size_t const hw = (std::max)(std::thread::hardware_concurrency(), 1u);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "# " << hw << " hardware threads\n";
+    std::cout << "# algorithm   match threads        ms\n";
+    struct
+    {
+        char const * name;
+        std::size_t at;
+    } const wheres[] = {{"start", 1000}, {"middle", n / 2}, {"none", n}};
+    for(auto const & where : wheres)
+    {
+        std::fill(v.begin(), v.end(), 0);
+        if(where.at < n)
+        {
+            auto const at = v.begin() + static_cast<std::ptrdiff_t>(where.at);
+            std::copy(needle, needle + 3, at);
+        }
+        for(std::size_t threads : {std::size_t{1}, std::size_t{2}, std::size_t{4}, hw})
+        {
+            auto const pol = par(threads);
+            report("find_if", where.name, threads,
+                   [&] { return find_if(pol, v, is_one) - v.begin(); });
+            report("any_of", where.name, threads,
+                   [&] { return static_cast<std::ptrdiff_t>(any_of(pol, v, is_one)); });
+            report("search", where.name, threads,
+                   [&] { return search(pol, v, needle).begin() - v.begin(); });
+        }
+    }
+}
@@ -0,0 +1,92 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures merge, the set algorithms and inplace_merge on two sorted runs of
+// ten million ints each, on one thread and with par(threads) for 2, 4 and all
+// hardware threads.
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/merge.hpp>
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include <range/v3/algorithm/sort.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using namespace ranges;
+
+    // Keeps the optimizer from discarding the results.
+    volatile std::ptrdiff_t sink;
+
+    // Runs fun and reports the time per input element.
+    template<typename Fun>
+    void report(char const * name, std::size_t threads, std::size_t n, Fun fun)
+    {
+        auto const start = clock_t::now();
+        sink = fun();
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(24) << name << std::setw(8) << threads << std::setw(12)
+                  << d.count() / static_cast<double>(n) << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::size_t const n = 10000000;
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist(0, 1 << 24);
+    std::vector<int> a(n), b(n);
+    for(auto & i : a)
+        i = dist(gen);
+    for(auto & i : b)
+        i = dist(gen);
+    sort(a);
+    sort(b);
+    std::vector<int> ab = a;
+    ab.insert(ab.end(), b.begin(), b.end());
+
+    std::size_t const hw = (std::max)(std::thread::hardware_concurrency(), 1u);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "# " << hw << " hardware threads\n";
+    std::cout << "#              algorithm threads  ns/element\n";
+    std::vector<int> out(2 * n);
+    for(std::size_t threads : {std::size_t{1}, std::size_t{2}, std::size_t{4}, hw})
+    {
+        auto const pol = par(threads);
+        report("merge", threads, 2 * n, [&] {
+            return merge(pol, a, b, out.begin()).out - out.begin();
+        });
+        report("set_union", threads, 2 * n, [&] {
+            return set_union(pol, a, b, out.begin()).out - out.begin();
+        });
+        report("set_intersection", threads, 2 * n, [&] {
+            return set_intersection(pol, a, b, out.begin()) - out.begin();
+        });
+        report("set_difference", threads, 2 * n, [&] {
+            return set_difference(pol, a, b, out.begin()).out - out.begin();
+        });
+        report("set_symmetric_difference", threads, 2 * n, [&] {
+            return set_symmetric_difference(pol, a, b, out.begin()).out - out.begin();
+        });
+        std::vector<int> w = ab;
+        report("inplace_merge", threads, 2 * n, [&] {
+            return inplace_merge(pol, w, w.begin() + static_cast<std::ptrdiff_t>(n)) -
+                   w.begin();
+        });
+    }
+}
@@ -0,0 +1,66 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures stable_sort of many small ranges, and of one large one, with a
+// temporary buffer per call and with one scratch_buffer for all calls, with
+// normal and with huge pages.
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/utility/scratch_buffer.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using namespace ranges;
+
+    // Sorts every run of len elements of a fresh copy of v with sort, and
+    // reports the time per element.
+    template<typename Sort>
+    void report(char const * name, std::vector<int> const & v, std::size_t len,
+                Sort sort)
+    {
+        std::vector<int> w = v;
+        auto const start = clock_t::now();
+        for(std::size_t i = 0; i < w.size(); i += len)
+            sort(w.begin() + static_cast<std::ptrdiff_t>(i),
+                 w.begin() + static_cast<std::ptrdiff_t>(i + len));
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(20) << name << std::setw(10) << len << std::setw(12)
+                  << d.count() / static_cast<double>(v.size()) << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::size_t const n = 1 << 24;
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist;
+    std::vector<int> v(n);
+    for(auto & i : v)
+        i = dist(gen);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "#             buffer    length  ns/element\n";
+    for(std::size_t len : {std::size_t{300}, std::size_t{4096}, n})
+    {
+        report("temporary", v, len, [](auto b, auto e) { stable_sort(b, e); });
+        scratch_buffer buf;
+        report("scratch_buffer", v, len, [&](auto b, auto e) { stable_sort(buf, b, e); });
+        scratch_buffer huge{scratch_pages::huge};
+        report("huge pages", v, len, [&](auto b, auto e) { stable_sort(huge, b, e); });
+    }
+}
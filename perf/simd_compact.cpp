@@ -0,0 +1,97 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures copy_if, remove_if and collecting a view::filter over ten million
+// random numbers, half of which pass, with a lambda and with the equivalent
+// ranges::pred predicate, which the algorithms hand to the AVX2 or AVX-512
+// kernels when the processor has them.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/algorithm/remove_if.hpp>
+#include <range/v3/detail/simd_compact.hpp>
+#include <range/v3/functional/pred.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/filter.hpp>
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+    using namespace ranges;
+
+    // Keeps the optimizer from discarding the results.
+    volatile std::size_t sink;
+
+    template<typename V, typename Fun>
+    void report(char const * name, std::vector<V> const & v, Fun fun)
+    {
+        std::vector<V> w = v;
+        auto const start = clock_t::now();
+        sink = fun(w);
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(24) << name << std::setw(12)
+                  << d.count() / static_cast<double>(v.size()) << '\n';
+    }
+
+    template<typename V>
+    void run(char const * type)
+    {
+        std::size_t const n = 10000000;
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> dist(0, 999);
+        std::vector<V> v(n);
+        for(auto & x : v)
+            x = static_cast<V>(dist(gen));
+        V const bound = 500;
+        auto const lambda = [bound](V x) { return x < bound; };
+        auto const simd = pred::lt(bound);
+        std::vector<V> out(n);
+
+        std::cout << "# " << type << '\n';
+        report("copy_if lambda", v, [&](std::vector<V> & w) {
+            return static_cast<std::size_t>(copy_if(w, out.data(), lambda).out -
+                                            out.data());
+        });
+        report("copy_if pred", v, [&](std::vector<V> & w) {
+            return static_cast<std::size_t>(copy_if(w, out.data(), simd).out -
+                                            out.data());
+        });
+        report("remove_if lambda", v, [&](std::vector<V> & w) {
+            return static_cast<std::size_t>(remove_if(w, lambda) - w.begin());
+        });
+        report("remove_if pred", v, [&](std::vector<V> & w) {
+            return static_cast<std::size_t>(remove_if(w, simd) - w.begin());
+        });
+        report("filter | to lambda", v, [&](std::vector<V> & w) {
+            return (w | view::filter(lambda) | to_vector).size();
+        });
+        report("filter | to pred", v, [&](std::vector<V> & w) {
+            return (w | view::filter(simd) | to_vector).size();
+        });
+    }
+} // namespace
+
+int main()
+{
+    char const * const isa[] = {"scalar", "AVX2", "AVX-512"};
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "# kernels: " << isa[static_cast<int>(detail::compact_isa())] << '\n';
+    std::cout << "#                   case  ns/element\n";
+    run<std::int32_t>("int32");
+    run<float>("float");
+    run<std::int64_t>("int64");
+}
@@ -0,0 +1,111 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the cost per input byte of splitting CSV-like text with
+// view::split on a one-character delimiter, a two-character one and a long
+// one, and counting the pieces and their lengths.
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <range/v3/all.hpp>
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+
+    constexpr int reps = 10;
+
+    // Keeps the optimizer from discarding the counts.
+    volatile std::int64_t sink;
+
+    std::string make_text(std::size_t size, std::string const & sep)
+    {
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<int> len{1, 12};
+        std::uniform_int_distribution<int> letter{'a', 'z'};
+        std::string text;
+        text.reserve(size + 32);
+        while(text.size() < size)
+        {
+            for(int i = len(gen); i > 0; --i)
+                text.push_back(static_cast<char>(letter(gen)));
+            text += sep;
+        }
+        return text;
+    }
+
+    template<typename Fun>
+    void report(char const * name, std::string const & text, Fun fun)
+    {
+        std::int64_t n = 0;
+        auto const start = clock_t::now();
+        for(int r = 0; r < reps; ++r)
+            sink = n = fun();
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        std::cout << std::setw(12) << name << std::setw(14) << n << std::setw(14)
+                  << d.count() / (double(text.size()) * reps) << '\n';
+    }
+
+    template<typename Pattern>
+    void run(char const * name, std::string const & text, Pattern pattern)
+    {
+        report(name, text, [&] {
+            std::int64_t n = 0;
+            for(auto && piece : text | ranges::view::split(pattern))
+                n += 1 + ranges::distance(piece);
+            return n;
+        });
+    }
+
+    // The same count for a one-character delimiter, by hand.
+    void run_memchr(std::string const & text, char c)
+    {
+        report("memchr", text, [&] {
+            std::int64_t n = 0;
+            char const * first = text.data();
+            char const * const last = first + text.size();
+            while(first != last)
+            {
+                auto p = static_cast<char const *>(
+                    std::memchr(first, c, static_cast<std::size_t>(last - first)));
+                p = p ? p : last;
+                n += 1 + (p - first);
+                first = p == last ? last : p + 1;
+            }
+            return n;
+        });
+    }
+} // namespace
+
+int main()
+{
+    constexpr std::size_t size = std::size_t{1} << 24;
+    std::string const comma = ",";
+    std::string const crlf = "\r\n";
+    std::string const sep = "<|field-end|>";
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "#    pattern     checksum   ns/byte\n";
+    std::string const csv = make_text(size, comma);
+    run_memchr(csv, ',');
+    run("','", csv, ',');
+    run("\",\"", csv, ranges::view::all(comma));
+    run("\"\\r\\n\"", make_text(size, crlf), ranges::view::all(crlf));
+    run("long", make_text(size, sep), ranges::view::all(sep));
+}
@@ -0,0 +1,86 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Measures the cost per row of iterating view::zip over N contiguous
+// columns and summing every field, against a hand-written loop that indexes
+// all the columns with one counter.
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include <range/v3/all.hpp>
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using clock_t = std::chrono::steady_clock;
+
+    constexpr std::size_t rows = std::size_t{1} << 20;
+    constexpr int reps = 20;
+
+    // Keeps the optimizer from discarding the sums.
+    volatile std::int64_t sink;
+
+    template<typename Fun>
+    double ns_per_row(Fun fun)
+    {
+        auto const start = clock_t::now();
+        for(int r = 0; r < reps; ++r)
+            sink = fun();
+        std::chrono::duration<double, std::nano> const d = clock_t::now() - start;
+        return d.count() / (double(rows) * reps);
+    }
+
+    template<std::size_t... Is>
+    void run(meta::index_sequence<Is...>)
+    {
+        constexpr std::size_t n = sizeof...(Is);
+        std::vector<std::vector<int>> cols(n);
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            cols[i].resize(rows);
+            std::iota(cols[i].begin(), cols[i].end(), int(i));
+        }
+
+        double const base = ns_per_row([&] {
+            std::int64_t sum = 0;
+            int const * const ps[] = {cols[Is].data()...};
+            for(std::size_t r = 0; r < rows; ++r)
+                for(std::size_t c = 0; c < n; ++c)
+                    sum += ps[c][r];
+            return sum;
+        });
+        double const zip = ns_per_row([&] {
+            std::int64_t sum = 0;
+            for(auto && row : ranges::view::zip(cols[Is]...))
+                sum += ranges::tuple_foldl(row, std::int64_t{0}, std::plus<>{});
+            return sum;
+        });
+        std::cout << std::setw(8) << n << std::setw(16) << base << std::setw(16) << zip
+                  << '\n';
+    }
+} // namespace
+
+int main()
+{
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "#       N    loop ns/row     zip ns/row\n";
+    run(meta::make_index_sequence<2>{});
+    run(meta::make_index_sequence<4>{});
+    run(meta::make_index_sequence<8>{});
+    run(meta::make_index_sequence<16>{});
+    run(meta::make_index_sequence<24>{});
+}
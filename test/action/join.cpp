@@ -13,6 +13,7 @@
 #include <range/v3/action/join.hpp>
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/utility/arena.hpp>
 #include <range/v3/view/transform.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -30,5 +31,11 @@ int main()
     static_assert(std::is_same<decltype(s2), std::vector<char>>::value, "");
     CHECK(std::string(s2.begin(), s2.end()) == "hello world");
 
+    monotonic_arena arena;
+    auto s3 = action::join(v, arena_allocator<char>{arena});
+    static_assert(std::is_same<decltype(s3), std::vector<char, arena_allocator<char>>>::value, "");
+    CHECK(std::string(s3.begin(), s3.end()) == "hello world");
+    CHECK(s3.get_allocator().arena() == &arena);
+
     return ::test_result();
 }
@@ -10,6 +10,7 @@
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/action/sort.hpp>
 #include <range/v3/action/remove_if.hpp>
@@ -28,5 +29,14 @@ int main()
     auto && v3 = v | move | action::remove_if(std::bind(std::less<int>{}, std::placeholders::_1, 10));
     check_equal(v3, {11,13,15,17,19});
 
+    // In parallel.
+    auto w = view::ints(0,5000) | to<std::vector>();
+    auto & w2 = action::remove_if(w, par(4, 64), [](int i){return i % 3 != 0;});
+    CHECK(&w2 == &w);
+    CHECK(w.size() == 1667u);
+    CHECK(w.back() == 4998);
+    w |= action::remove_if(par(4, 64), [](int i){return i % 2 != 0;});
+    check_equal(w, view::ints(0,834) | view::transform([](int i){return 6 * i;}));
+
     return ::test_result();
 }
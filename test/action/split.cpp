@@ -14,6 +14,7 @@
 #include <range/v3/action/split.hpp>
 #include <range/v3/action/split_when.hpp>
 #include <range/v3/algorithm/move.hpp>
+#include <range/v3/utility/arena.hpp>
 #include <range/v3/view/c_str.hpp>
 #include <range/v3/view/iota.hpp>
 #include "../simple_test.hpp"
@@ -77,5 +78,27 @@ int main()
         }
     }
 
+    {
+        monotonic_arena arena;
+        arena_allocator<int> alloc{arena};
+        auto v = view::ints(1,21) | to<std::vector>();
+        auto rgv = action::split(v, 10, alloc);
+        using inner_t = std::vector<int, arena_allocator<int>>;
+        static_assert(std::is_same<decltype(rgv),
+            std::vector<inner_t, arena_allocator<inner_t>>>::value, "");
+        CHECK(rgv.size() == 2u);
+        ::check_equal(rgv[0], {1,2,3,4,5,6,7,8,9});
+        ::check_equal(rgv[1], {11,12,13,14,15,16,17,18,19,20});
+        CHECK(rgv[1].get_allocator() == alloc);
+
+        using string_t = std::basic_string<char, std::char_traits<char>, arena_allocator<char>>;
+        string_t s{"This is his face", alloc};
+        auto rgs = action::split(s, view::c_str(" "), alloc);
+        static_assert(std::is_same<decltype(rgs),
+            std::vector<string_t, arena_allocator<string_t>>>::value, "");
+        CHECK(rgs.size() == 4u);
+        CHECK(rgs[3] == "face");
+    }
+
     return ::test_result();
 }
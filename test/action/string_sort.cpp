@@ -0,0 +1,46 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/action/string_sort.hpp>
+#include <range/v3/action/unique.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<std::string> v{"delta", "alpha", "charlie", "alpha", "", "bravo"};
+    auto v2 = v | copy | action::string_sort;
+    CHECK(is_sorted(v2));
+    CHECK(!is_sorted(v));
+    ::models<SameConcept>(v, v2);
+
+    v |= action::string_sort | action::unique;
+    ::check_equal(v, {"", "alpha", "bravo", "charlie", "delta"});
+
+    std::vector<std::pair<int, std::string>> p{{0, "b"}, {1, "c"}, {2, "a"}};
+    action::string_sort(p, &std::pair<int, std::string>::second);
+    CHECK(p[0].first == 2);
+    CHECK(p[1].first == 0);
+    CHECK(p[2].first == 1);
+
+    p |= action::string_sort([](std::pair<int, std::string> const & x) -> std::string const & {
+        return x.second;
+    });
+    CHECK(p[0].second == "a");
+
+    return ::test_result();
+}
@@ -40,5 +40,13 @@ int main()
     v |= action::sort | action::unique;
     CHECK(equal(v, view::ints(1,100)));
 
+    // In parallel.
+    auto w =
+        view::for_each(view::ints(1,100), [](int i){
+            return yield_from(view::repeat_n(i,i));
+        }) | to<std::vector>();
+    w |= action::unique(par(4, 64));
+    CHECK(equal(w, view::ints(1,100)));
+
     return ::test_result();
 }
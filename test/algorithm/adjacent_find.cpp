@@ -9,6 +9,7 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/adjacent_find.hpp>
 #include "../simple_test.hpp"
@@ -26,5 +27,24 @@ int main()
     static_assert(std::is_same<std::pair<int,int>*,
                                decltype(ranges::adjacent_find(v2, ranges::equal_to{},
                                     &std::pair<int, int>::second))>::value, "");
+
+    // In parallel, the first pair wherever it is, also across chunks.
+    std::vector<int> v(10000);
+    for(std::size_t threads : {1u, 2u, 3u, 8u})
+        for(int at : {0, 62, 63, 64, 5000, 9998, 9999})
+        {
+            for(int i = 0; i < 10000; ++i)
+                v[(std::size_t)i] = i;
+            if(at < 9999)
+                v[(std::size_t)at + 1] = at;
+            if(at + 300 < 9999)
+                v[(std::size_t)at + 301] = at + 300;
+            auto r = ranges::adjacent_find(ranges::par(threads, 64), v);
+            CHECK((r - v.begin()) == (at < 9999 ? at : 10000));
+        }
+    CHECK(ranges::adjacent_find(ranges::par(2, 1), v2, ranges::equal_to{},
+                                &std::pair<int, int>::second) == &v2[1]);
+    std::vector<int> one{1};
+    CHECK(ranges::adjacent_find(ranges::par, one) == one.end());
     return test_result();
 }
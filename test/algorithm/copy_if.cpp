@@ -0,0 +1,99 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/functional/pred.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+int main()
+{
+    auto const odd = [](int i) { return i % 2 == 1; };
+
+    {
+        int ia[] = {1, 2, 3, 4, 5, 6, 7};
+        int ib[7] = {};
+        auto r = ranges::copy_if(input_iterator<int const *>(ia),
+                                 sentinel<int const *>(ia + 7),
+                                 output_iterator<int *>(ib),
+                                 odd);
+        CHECK(base(r.in) == ia + 7);
+        CHECK(base(r.out) == ib + 4);
+        ::check_equal(ranges::make_subrange(ib, ib + 4), {1, 3, 5, 7});
+
+        S sa[] = {{1}, {2}, {3}, {4}};
+        std::vector<S> out;
+        ranges::copy_if(sa, ranges::back_inserter(out), odd, &S::i);
+        CHECK(out.size() == 2u);
+        CHECK(out[1].i == 3);
+    }
+
+    {
+        // In parallel, in blocks of 64 elements, the output is in order.
+        std::vector<int> v(5000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<int>(i * 7919 % 1009);
+        auto const small = [](int i) { return i < 300; };
+        std::vector<int> expected;
+        ranges::copy_if(v, ranges::back_inserter(expected), small);
+
+        for(std::size_t threads : {1u, 2u, 4u, 9u})
+        {
+            std::vector<int> out(v.size(), -1);
+            auto r = ranges::copy_if(ranges::par(threads, 64), v, out.begin(), small);
+            CHECK(r.in == v.end());
+            CHECK((r.out - out.begin()) == static_cast<std::ptrdiff_t>(expected.size()));
+            ::check_equal(ranges::make_subrange(out.begin(), r.out), expected);
+            CHECK(*r.out == -1);
+        }
+
+        std::vector<S> s(v.size());
+        for(std::size_t i = 0; i < v.size(); ++i)
+            s[i].i = v[i];
+        std::vector<S> out(s.size());
+        auto r = ranges::copy_if(ranges::par(4, 64), s.begin(), s.end(), out.begin(),
+                                 small, &S::i);
+        CHECK((r.out - out.begin()) == static_cast<std::ptrdiff_t>(expected.size()));
+        for(std::size_t i = 0; i < expected.size(); ++i)
+            CHECK(out[i].i == expected[i]);
+    }
+
+    {
+        // With a predicate from ranges::pred, contiguous ints are copied in
+        // bulk.
+        std::vector<int> v(1000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<int>(i * 37 % 101);
+        std::vector<int> expected;
+        ranges::copy_if(v, ranges::back_inserter(expected), [](int i) { return i > 70; });
+        std::vector<int> out(v.size(), -1);
+        auto r = ranges::copy_if(v, out.data(), ranges::pred::gt(70));
+        CHECK(r.in == v.end());
+        CHECK((r.out - out.data()) == static_cast<std::ptrdiff_t>(expected.size()));
+        ::check_equal(ranges::make_subrange(out.data(), r.out), expected);
+        CHECK(*r.out == -1);
+        auto rp =
+            ranges::copy_if(ranges::par(4, 64), v, out.begin(), ranges::pred::gt(70));
+        CHECK((rp.out - out.begin()) == static_cast<std::ptrdiff_t>(expected.size()));
+        ::check_equal(ranges::make_subrange(out.begin(), rp.out), expected);
+    }
+
+    return ::test_result();
+}
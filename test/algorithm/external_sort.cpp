@@ -0,0 +1,121 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <system_error>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/external_sort.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/view/istream.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    struct event
+    {
+        std::uint64_t key;
+        std::uint32_t seq;
+    };
+
+    std::vector<int> random_ints(std::size_t n, int hi)
+    {
+        std::mt19937 gen(static_cast<unsigned>(n));
+        std::uniform_int_distribution<int> dist(0, hi);
+        std::vector<int> v(n);
+        for(auto & i : v)
+            i = dist(gen);
+        return v;
+    }
+
+    void check_sorts(std::vector<int> const & in, std::size_t budget)
+    {
+        auto expected = in;
+        std::sort(expected.begin(), expected.end());
+        std::vector<int> out;
+        auto res = ranges::external_sort(in, ranges::back_inserter(out), budget);
+        CHECK(res.in == in.end());
+        CHECK(out == expected);
+
+        out.clear();
+        ranges::external_sort(ranges::par(4, 8), in, ranges::back_inserter(out), budget);
+        CHECK(out == expected);
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Fits in memory.
+    check_sorts({}, 1024);
+    check_sorts(random_ints(100, 1000), 1 << 20);
+    // Several runs.
+    check_sorts(random_ints(10000, 1000), 4096);
+    check_sorts(random_ints(10000, 3), 4096);
+    // More runs than are merged at once.
+    check_sorts(random_ints(5000, 1 << 30), 16);
+    // A budget smaller than one element still makes progress.
+    check_sorts(random_ints(300, 100), 1);
+
+    // Iterator/sentinel overload, named temporary files, a predicate and a
+    // projection.
+    {
+        std::vector<event> in;
+        for(std::uint32_t i = 0; i != 3000; ++i)
+            in.push_back({(i * 7919u) % 1000u, i});
+        std::vector<event> out(in.size());
+        auto res = external_sort(in.begin(), in.end(), out.begin(), 64 * sizeof(event),
+                                 ".", std::greater<std::uint64_t>{}, &event::key);
+        CHECK(res.in == in.end());
+        CHECK(res.out == out.end());
+        CHECK(std::is_sorted(out.begin(), out.end(), [](event const & a, event const & b) {
+            return a.key > b.key;
+        }));
+        std::vector<std::uint32_t> seqs;
+        for(auto const & e : out)
+            seqs.push_back(e.seq);
+        std::sort(seqs.begin(), seqs.end());
+        for(std::uint32_t i = 0; i != seqs.size(); ++i)
+            CHECK(seqs[i] == i);
+    }
+
+    // A single-pass input.
+    {
+        std::istringstream sin{"5 3 9 1 7 3 0 8 2"};
+        std::vector<int> out;
+        external_sort(istream<int>(sin), ranges::back_inserter(out), 3 * sizeof(int));
+        ::check_equal(out, {0, 1, 2, 3, 3, 5, 7, 8, 9});
+    }
+
+    // Temporary file errors are reported.
+    {
+        auto in = random_ints(100, 10);
+        std::vector<int> out;
+        bool thrown = false;
+        try
+        {
+            external_sort(in, ranges::back_inserter(out), 64, "/nonexistent/directory");
+        }
+        catch(std::system_error const &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    return ::test_result();
+}
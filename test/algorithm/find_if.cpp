@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <atomic>
 #include <utility>
 #include <vector>
 #include <range/v3/core.hpp>
@@ -94,5 +95,42 @@ int main()
         CHECK(ps == end(sa));
     }
 
+    {
+        // In parallel, the first match wherever it is, even with a later one
+        // in a chunk that another thread gets to first.
+        std::vector<int> v(100000, 0);
+        for(std::size_t threads : {1u, 2u, 3u, 8u})
+            for(std::size_t at : {0u, 1u, 63u, 64u, 5000u, 99999u, 100000u})
+            {
+                std::fill(v.begin(), v.end(), 0);
+                if(at < v.size())
+                    v[at] = 1;
+                if(at + 700 < v.size())
+                    v[at + 700] = 1;
+                auto r = ranges::find_if(ranges::par(threads, 64), v,
+                                         [](int i) { return i == 1; });
+                CHECK((r - v.begin()) == (std::ptrdiff_t)at);
+            }
+
+        std::fill(v.begin(), v.end(), 0);
+        v[10] = 1;
+        v[90000] = 1;
+        std::atomic<int> calls{0};
+        auto r = ranges::find_if(ranges::par(4, 1000), v.begin(), v.end(), [&](int i) {
+            ++calls;
+            return i == 1;
+        });
+        CHECK(r == v.begin() + 10);
+        // The thread with the match stops there; how far the others get
+        // depends on the scheduler.
+        CHECK(calls < (int)v.size());
+
+        auto const odd = [](int i) { return i % 2 != 0; };
+        S sa[] = {{0}, {1}, {2}, {3}, {1}};
+        CHECK(ranges::find_if(ranges::par(2, 1), sa, odd, &S::i_) == &sa[1]);
+        std::vector<int> const empty;
+        CHECK(ranges::find_if(ranges::par, empty, odd) == empty.end());
+    }
+
     return ::test_result();
 }
@@ -19,9 +19,15 @@
 //===----------------------------------------------------------------------===//
 
 #include <algorithm>
+#include <memory>
 #include <random>
+#include <utility>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/utility/scratch_buffer.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -138,5 +144,71 @@ int main()
     test<random_access_iterator<int*> >();
     test<int*>();
 
+    {
+        // The parallel overloads give the same result as the sequential
+        // algorithm, which is stable.
+        using P = std::pair<int, int>;
+        std::uniform_int_distribution<int> key(0, 300);
+        for(int n : {0, 1, 2, 10, 20000})
+            for(int m : {0, n / 5, n / 2, n})
+            {
+                std::vector<P> v;
+                for(int i = 0; i < n; ++i)
+                    v.push_back({key(gen), i});
+                ranges::sort(v.begin(), v.begin() + m);
+                ranges::sort(v.begin() + m, v.end());
+                auto expected = v;
+                ranges::inplace_merge(expected, expected.begin() + m, ranges::less{},
+                                      &P::first);
+                for(std::size_t threads : {1u, 2u, 3u, 8u})
+                {
+                    auto w = v;
+                    auto r = ranges::inplace_merge(ranges::par(threads, 1), w,
+                                                   w.begin() + m, ranges::less{},
+                                                   &P::first);
+                    CHECK(r == w.end());
+                    CHECK(w == expected);
+                }
+            }
+
+        // Elements that are not trivial, and a projection.
+        std::vector<std::unique_ptr<int>> u;
+        for(int i = 0; i < 10000; ++i)
+            u.push_back(std::make_unique<int>(i < 4000 ? 3 * i : 2 * (i - 4000)));
+        auto deref = [](std::unique_ptr<int> const & p) { return *p; };
+        ranges::inplace_merge(ranges::par(4, 1), u, u.begin() + 4000, ranges::less{},
+                              deref);
+        CHECK(ranges::is_sorted(u, ranges::less{}, deref));
+        CHECK(*u.front() == 0);
+        CHECK(*u.back() == 11998);
+    }
+
+    {
+        // With one scratch buffer for many calls.
+        ranges::scratch_buffer buf;
+        for(unsigned n : {0u, 1u, 5u, 100u, 1000u, 16u})
+        {
+            std::vector<int> v(n);
+            for(unsigned i = 0; i < n; ++i)
+                v[i] = (int)((i * 37) % 101);
+            auto const m = v.begin() + n / 3;
+            std::sort(v.begin(), m);
+            std::sort(m, v.end());
+            auto expected = v;
+            std::inplace_merge(expected.begin(), expected.begin() + n / 3, expected.end());
+            CHECK(ranges::inplace_merge(buf, v, m) == v.end());
+            CHECK(v == expected);
+            auto w = v;
+            std::sort(w.begin(), w.begin() + n / 2);
+            std::sort(w.begin() + n / 2, w.end());
+            CHECK(ranges::inplace_merge(buf, bidirectional_iterator<int *>(w.data()),
+                                        bidirectional_iterator<int *>(w.data() + n / 2),
+                                        bidirectional_iterator<int *>(w.data() + n)) ==
+                  bidirectional_iterator<int *>(w.data() + n));
+            CHECK(w == expected);
+        }
+        CHECK(buf.size() >= 333 * sizeof(int));
+    }
+
     return ::test_result();
 }
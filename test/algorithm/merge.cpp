@@ -16,8 +16,11 @@
 #include <memory>
 #include <utility>
 #include <algorithm>
+#include <random>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/merge.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -88,5 +91,44 @@ int main()
             ranges::merge_result<ranges::dangling, ranges::dangling, int *>>::value, "");
     }
 
+    {
+        // The parallel overloads give the same output as the sequential
+        // algorithm, taking from the first input on ties.
+        using P = std::pair<int, int>;
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> key(0, 500);
+        for(int n : {0, 1, 10, 20000})
+        {
+            std::vector<P> a, b;
+            for(int i = 0; i < n; ++i)
+                a.push_back({key(gen), i});
+            for(int i = 0; i < n / 3 + 1; ++i)
+                b.push_back({key(gen), -i});
+            ranges::sort(a);
+            ranges::sort(b);
+            std::vector<P> expected(a.size() + b.size()), out(expected.size());
+            ranges::merge(a, b, expected.begin(), ranges::less{}, &P::first, &P::first);
+            for(std::size_t threads : {1u, 2u, 3u, 8u})
+            {
+                auto r = ranges::merge(ranges::par(threads, 1), a, b, out.begin(),
+                                       ranges::less{}, &P::first, &P::first);
+                CHECK(r.in1 == a.end());
+                CHECK(r.in2 == b.end());
+                CHECK(r.out == out.end());
+                CHECK(out == expected);
+            }
+        }
+
+        std::vector<int> ia(3000), ib(5000), ic(8000);
+        for(int i = 0; i < 3000; ++i)
+            ia[i] = 2 * i;
+        for(int i = 0; i < 5000; ++i)
+            ib[i] = i;
+        auto r = ranges::merge(ranges::par(4, 1), ia.begin(), ia.end(), ib.begin(),
+                               ib.end(), ic.begin());
+        CHECK(r.out == ic.end());
+        CHECK(std::is_sorted(ic.begin(), ic.end()));
+    }
+
     return ::test_result();
 }
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/mismatch.hpp>
 #include "../simple_test.hpp"
@@ -135,5 +136,31 @@ int main()
     CHECK(ps2.in1->i == -4);
     CHECK(ps2.in2->i == 5);
 
+    // In parallel, the first mismatch, or the end of the shorter sequence.
+    {
+        std::vector<int> a(10000), b(12000);
+        for(std::size_t threads : {1u, 2u, 3u, 8u})
+            for(std::size_t at : {0u, 63u, 64u, 5000u, 9999u, 10000u})
+            {
+                for(std::size_t i = 0; i < b.size(); ++i)
+                    b[i] = (int)i;
+                std::copy(b.begin(), b.begin() + 10000, a.begin());
+                if(at < a.size())
+                    b[at] = -1;
+                if(at + 100 < a.size())
+                    b[at + 100] = -1;
+                auto r = ranges::mismatch(ranges::par(threads, 64), a, b);
+                CHECK((r.in1 - a.begin()) == (std::ptrdiff_t)at);
+                CHECK((r.in2 - b.begin()) == (std::ptrdiff_t)at);
+                auto r2 = ranges::mismatch(ranges::par(threads, 64), b.begin(), b.end(),
+                                           a.begin(), a.end());
+                CHECK((r2.in1 - b.begin()) == (std::ptrdiff_t)at);
+            }
+        auto ps3 = ranges::mismatch(ranges::par(2, 1), s1, s2, std::equal_to<int>(),
+                                    &S::i, &S::i);
+        CHECK(ps3.in1->i == -4);
+        CHECK(ps3.in2->i == 5);
+    }
+
     return test_result();
 }
@@ -59,5 +59,23 @@ int main()
   CHECK(!ranges::none_of(ILS{S(false), S(true), S(false)}, &S::p));
   CHECK(ranges::none_of(ILS{S(false), S(false), S(false)}, &S::p));
 
+  {
+    // In parallel, with a match anywhere, or none.
+    std::vector<int> v(100000, 1);
+    for(std::size_t threads : {1u, 2u, 3u, 8u})
+    {
+      auto const pol = ranges::par(threads, 64);
+      CHECK(ranges::none_of(pol, v, even));
+      for(std::size_t at : {0u, 777u, 99999u})
+      {
+        v[at] = 2;
+        CHECK(!ranges::none_of(pol, v.begin(), v.end(), even));
+        v[at] = 1;
+      }
+    }
+    CHECK(ranges::none_of(ranges::par, none_true, &S::p));
+    CHECK(!ranges::none_of(ranges::par, one_true, &S::p));
+  }
+
   return ::test_result();
 }
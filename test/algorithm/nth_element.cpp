@@ -99,5 +99,17 @@ int main()
     CHECK(ia[M].i == M);
     CHECK(ia[M].j == M);
 
+    // Evaluates the projection once per element?
+    std::shuffle(ia, ia+N, gen);
+    int calls = 0;
+    auto proj = [&calls](S const & s) { return ++calls, s.i; };
+    CHECK(ranges::nth_element(ranges::cache_keys, ia, ia+M, std::less<int>(), proj) ==
+          ia+N);
+    CHECK(calls == N);
+    CHECK(ia[M].i == M);
+    CHECK(ia[M].j == M);
+    for(int i = 0; i < M; ++i)
+        CHECK(ia[i].i < M);
+
     return test_result();
 }
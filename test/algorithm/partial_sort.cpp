@@ -179,5 +179,25 @@ int main()
         }
     }
 
+    // Check evaluating the projection once per element
+    {
+        std::vector<S> v(1000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = (int)v.size() - i - 1;
+            v[i].j = i;
+        }
+        int calls = 0;
+        auto proj = [&calls](S const & s) { return ++calls, s.i; };
+        CHECK(ranges::partial_sort(ranges::cache_keys, v, v.begin() + 10,
+                                   std::less<int>{}, proj) == v.end());
+        CHECK(calls == 1000);
+        for(int i = 0; i < 10; ++i)
+        {
+            CHECK(v[(std::size_t)i].i == i);
+            CHECK((std::size_t)v[(std::size_t)i].j == v.size() - i - 1);
+        }
+    }
+
     return ::test_result();
 }
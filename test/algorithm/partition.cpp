@@ -22,11 +22,15 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/is_partitioned.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -219,5 +223,50 @@ int main()
     auto r3 = ranges::partition(std::move(vec), is_odd(), &S::i);
     CHECK(::is_dangling(r3));
 
+    {
+        // In parallel, in blocks of 64 elements.
+        std::vector<int> v(5000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<int>(i * 7919 % 1009);
+        auto const small = [](int i) { return i < 300; };
+        auto const trues = ranges::count_if(v, small);
+        auto sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+        auto r = ranges::partition(ranges::par(4, 64), v, small);
+        CHECK((r - v.begin()) == trues);
+        CHECK(ranges::is_partitioned(v, small));
+        std::sort(v.begin(), v.end());
+        ::check_equal(v, sorted);
+
+        CHECK(ranges::partition(ranges::par(4, 64), v, [](int) { return true; }) ==
+              v.end());
+        CHECK(ranges::partition(ranges::par(4, 64), v, [](int) { return false; }) ==
+              v.begin());
+    }
+
+    {
+        // In parallel, with blocks that are all trues or all falses on either
+        // side of the partition point, which leave nothing to swap there.
+        auto const odd = [](int i) { return i % 2 != 0; };
+        std::vector<int> v(256);
+        for(int pattern = 0; pattern < 5 * 5 * 5 * 5; ++pattern)
+        {
+            for(int b = 0, p = pattern; b < 4; ++b, p /= 5)
+                for(int i = 0; i < 64; ++i)
+                {
+                    int const kind = p % 5;
+                    bool const t = kind == 0 || (kind == 1 && i != 0) ||
+                                   (kind == 2 && i == 0) || (kind == 3 && i % 2 == 0);
+                    v[std::size_t(b * 64 + i)] = 2 * (b * 64 + i) + t;
+                }
+            auto const trues = ranges::count_if(v, odd);
+            auto const sum = std::accumulate(v.begin(), v.end(), 0L);
+            auto r = ranges::partition(ranges::par(4, 64), v, odd);
+            CHECK((r - v.begin()) == trues);
+            CHECK(ranges::is_partitioned(v, odd));
+            CHECK(std::accumulate(v.begin(), v.end(), 0L) == sum);
+        }
+    }
+
     return ::test_result();
 }
@@ -26,6 +26,7 @@
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/partition_copy.hpp>
+#include <range/v3/iterator/insert_iterators.hpp>
 #include <range/v3/view/counted.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -161,5 +162,22 @@ int main()
     test_proj();
     test_rvalue();
 
+    {
+        // In parallel, in blocks of 64 elements.
+        std::vector<int> v(5000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<int>(i * 7919 % 1009);
+        auto const small = [](int i) { return i < 300; };
+        std::vector<int> t0, f0;
+        ranges::partition_copy(v, ranges::back_inserter(t0), ranges::back_inserter(f0),
+                               small);
+        std::vector<int> t1(v.size()), f1(v.size());
+        auto r = ranges::partition_copy(ranges::par(4, 64), v, t1.begin(), f1.begin(),
+                                        small);
+        CHECK(r.in == v.end());
+        ::check_equal(ranges::make_subrange(t1.begin(), r.out1), t0);
+        ::check_equal(ranges::make_subrange(f1.begin(), r.out2), f0);
+    }
+
     return ::test_result();
 }
@@ -29,6 +29,7 @@
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/remove_if.hpp>
+#include <range/v3/functional/pred.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -202,5 +203,49 @@ int main()
         CHECK(vec[5].i == 4);
     }
 
+    {
+        // In parallel, in blocks of 64 elements, the kept elements stay in
+        // order.
+        std::vector<int> v(5000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<int>(i * 7919 % 1009);
+        auto const multiple_of_3 = [](int i) { return i % 3 == 0; };
+        std::vector<S> s(v.size());
+        for(std::size_t i = 0; i < v.size(); ++i)
+            s[i].i = v[i];
+        auto expected = v;
+        expected.erase(ranges::remove_if(expected, multiple_of_3), expected.end());
+        auto r = ranges::remove_if(ranges::par(4, 64), v, multiple_of_3);
+        CHECK((r - v.begin()) == static_cast<std::ptrdiff_t>(expected.size()));
+        ::check_equal(ranges::make_subrange(v.begin(), r), expected);
+
+        auto rs = ranges::remove_if(ranges::par(3, 100), s, multiple_of_3, &S::i);
+        CHECK((rs - s.begin()) == static_cast<std::ptrdiff_t>(expected.size()));
+        for(std::size_t i = 0; i < expected.size(); ++i)
+            CHECK(s[i].i == expected[i]);
+
+        CHECK(ranges::remove_if(ranges::par(4, 64), v, [](int) { return true; }) ==
+              v.begin());
+        CHECK(ranges::remove_if(ranges::par(4, 64), v, [](int) { return false; }) ==
+              v.end());
+    }
+
+    {
+        // With a predicate from ranges::pred, contiguous doubles are removed
+        // in bulk.
+        std::vector<double> v(1000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<double>(i * 37 % 101) / 4;
+        auto expected = v;
+        expected.erase(ranges::remove_if(expected, [](double d) { return d <= 12.5; }),
+                       expected.end());
+        auto w = v;
+        auto r = ranges::remove_if(w, ranges::pred::le(12.5));
+        CHECK((r - w.begin()) == static_cast<std::ptrdiff_t>(expected.size()));
+        ::check_equal(ranges::make_subrange(w.begin(), r), expected);
+        r = ranges::remove_if(ranges::par(4, 64), v, ranges::pred::le(12.5));
+        ::check_equal(ranges::make_subrange(v.begin(), r), expected);
+    }
+
     return ::test_result();
 }
@@ -233,5 +233,30 @@ int main()
         CHECK(::is_dangling(ranges::search(std::move(ib), ie)));
     }
 
+    {
+        // In parallel, the first match, also across chunks, or none.
+        std::vector<int> hay(10000);
+        int const needle[] = {7, 8, 9};
+        for(std::size_t threads : {1u, 2u, 3u, 8u})
+            for(std::size_t at : {0u, 62u, 63u, 64u, 5000u, 9997u, 9998u})
+            {
+                std::fill(hay.begin(), hay.end(), 0);
+                if(at + 3 <= hay.size())
+                    std::copy(needle, needle + 3, hay.begin() + (std::ptrdiff_t)at);
+                if(at + 503 <= hay.size())
+                    std::copy(needle, needle + 3, hay.begin() + (std::ptrdiff_t)at + 500);
+                auto r = ranges::search(ranges::par(threads, 64), hay, needle);
+                auto const e = at + 3 <= hay.size() ? at : hay.size();
+                CHECK((r.begin() - hay.begin()) == (std::ptrdiff_t)e);
+                CHECK(r.size() == (e == hay.size() ? 0u : 3u));
+            }
+        int const empty[1] = {};
+        auto r = ranges::search(ranges::par, hay.begin(), hay.end(), empty, empty);
+        CHECK(r.begin() == hay.begin());
+        CHECK(r.empty());
+        std::vector<int> small(2);
+        CHECK(ranges::search(ranges::par, small, needle).begin() == small.end());
+    }
+
     return ::test_result();
 }
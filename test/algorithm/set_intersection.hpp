@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/set_algorithm.hpp>
@@ -27,6 +28,7 @@
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
+#include "./set_parallel.hpp"
 
 template<class Iter1, class Iter2, class OutIter>
 void
@@ -249,6 +251,8 @@ int main()
     test<const int*, const int*, int*>();
 #endif
 #ifdef SET_INTERSECTION_6
+    test_parallel(ranges::set_intersection);
+
     // Test projections
     {
         S ia[] = {S{1}, S{2}, S{2}, S{3}, S{3}, S{3}, S{4}, S{4}, S{4}, S{4}};
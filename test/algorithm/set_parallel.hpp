@@ -0,0 +1,93 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_TEST_ALGORITHM_SET_PARALLEL_HPP
+#define RANGES_TEST_ALGORITHM_SET_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/utility/parallel.hpp>
+#include "../simple_test.hpp"
+
+namespace set_parallel
+{
+    // The output iterator of a set algorithm's result, which is the result
+    // itself for set_intersection.
+    template<typename R>
+    auto out(R const & r, int) -> decltype(r.out)
+    {
+        return r.out;
+    }
+    template<typename O>
+    O out(O const & o, long)
+    {
+        return o;
+    }
+
+    // Checks the input iterators of a result that has them.
+    template<typename R, typename I>
+    auto check_in1(R const & r, I end, int) -> decltype(void(r.in1))
+    {
+        CHECK(r.in1 == end);
+    }
+    template<typename R, typename I>
+    void check_in1(R const &, I, long)
+    {}
+    template<typename R, typename I>
+    auto check_in2(R const & r, I end, int) -> decltype(void(r.in2))
+    {
+        CHECK(r.in2 == end);
+    }
+    template<typename R, typename I>
+    void check_in2(R const &, I, long)
+    {}
+} // namespace set_parallel
+
+// The parallel overloads of the set algorithm alg give the same output as
+// the sequential one, also with runs of equivalent elements, and with one
+// run of all of them.
+template<typename Alg>
+void test_parallel(Alg alg)
+{
+    using P = std::pair<int, int>;
+    std::mt19937 gen;
+    P const sizes[] = {{0, 1}, {1, 1}, {100, 20}, {5000, 1000}, {3000, 0}};
+    for(auto size : sizes)
+    {
+        std::uniform_int_distribution<int> key(0, size.second);
+        std::vector<P> a, b;
+        for(int i = 0; i < size.first; ++i)
+            a.push_back({key(gen), i});
+        for(int i = 0; i < size.first / 2 + 3; ++i)
+            b.push_back({key(gen), -i});
+        ranges::sort(a);
+        ranges::sort(b);
+        std::vector<P> expected(a.size() + b.size()), out(expected.size());
+        auto const e = alg(a, b, expected.begin(), ranges::less{}, &P::first, &P::first);
+        auto const n = set_parallel::out(e, 0) - expected.begin();
+        for(std::size_t threads : {1u, 2u, 3u, 8u})
+        {
+            auto const r = alg(ranges::par(threads, 1), a, b, out.begin(),
+                               ranges::less{}, &P::first, &P::first);
+            set_parallel::check_in1(r, a.end(), 0);
+            set_parallel::check_in2(r, b.end(), 0);
+            CHECK((set_parallel::out(r, 0) - out.begin()) == n);
+            CHECK(std::equal(expected.begin(), expected.begin() + n, out.begin()));
+        }
+    }
+}
+
+#endif
@@ -28,6 +28,7 @@
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
+#include "./set_parallel.hpp"
 
 template<class Iter1, class Iter2, class OutIter>
 void
@@ -277,6 +278,8 @@ int main()
     test<const int*, const int*, int*>();
 #endif
 #ifdef SET_SYMMETRIC_DIFFERENCE_6
+    test_parallel(ranges::set_symmetric_difference);
+
     // Test projections
     {
         S ia[] = {S{1}, S{2}, S{2}, S{3}, S{3}, S{3}, S{4}, S{4}, S{4}, S{4}};
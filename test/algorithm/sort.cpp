@@ -334,5 +334,23 @@ int main()
         sort(rng);
     }
 
+    // Check evaluating the projection once per element
+    {
+        std::vector<std::unique_ptr<int>> v;
+        for(int i = 0; i < 1000; ++i)
+            v.push_back(std::unique_ptr<int>{new int((i * 7919) % 1000)});
+        int calls = 0;
+        auto proj = [&calls](std::unique_ptr<int> const & p) { return ++calls, *p; };
+        CHECK(ranges::sort(ranges::cache_keys, v, std::less<int>{}, proj) == v.end());
+        CHECK(calls == 1000);
+        for(int i = 0; i < 1000; ++i)
+            CHECK(*v[(std::size_t)i] == i);
+
+        CHECK(ranges::sort(ranges::cache_keys, v.begin(), v.end(), std::greater<int>{},
+                           [](std::unique_ptr<int> const & p) { return *p; }) == v.end());
+        CHECK(*v.front() == 999);
+        CHECK(*v.back() == 0);
+    }
+
     return ::test_result();
 }
@@ -460,5 +460,47 @@ int main()
         CHECK(ap[9].p == P{4, 2});
     }
 
+    {
+        // In parallel, in blocks of 64 elements, for any number of blocks.
+        for(std::size_t threads : {2u, 3u, 4u, 7u})
+        {
+            std::vector<int> v(5000);
+            for(std::size_t i = 0; i < v.size(); ++i)
+                v[i] = static_cast<int>(i * 7919 % 1009);
+            auto const small = [](int i) { return i < 300; };
+            auto expected = v;
+            auto const e = ranges::stable_partition(expected, small);
+            auto r = ranges::stable_partition(ranges::par(threads, 64), v, small);
+            CHECK((r - v.begin()) == e - expected.begin());
+            ::check_equal(v, expected);
+        }
+    }
+
+    {
+        // With one scratch buffer for many calls, also over bidirectional
+        // iterators.
+        ranges::scratch_buffer buf;
+        auto const small = [](int i) { return i < 300; };
+        for(std::size_t n : {0u, 3u, 100u, 5000u, 10u})
+        {
+            std::vector<int> v(n);
+            for(std::size_t i = 0; i < v.size(); ++i)
+                v[i] = static_cast<int>(i * 7919 % 1009);
+            auto expected = v;
+            auto const e = ranges::stable_partition(expected, small);
+            auto w = v;
+            auto r = ranges::stable_partition(buf, v, small);
+            CHECK((r - v.begin()) == e - expected.begin());
+            ::check_equal(v, expected);
+            auto f = ranges::stable_partition(buf,
+                                              bidirectional_iterator<int *>(w.data()),
+                                              bidirectional_iterator<int *>(w.data() + n),
+                                              small);
+            CHECK((f.base() - w.data()) == e - expected.begin());
+            ::check_equal(w, expected);
+        }
+        CHECK(buf.size() > 0u);
+    }
+
     return ::test_result();
 }
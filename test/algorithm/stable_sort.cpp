@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/utility/scratch_buffer.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -256,5 +257,57 @@ int main()
     }
 #endif // Avoid #890
 
+    // Check evaluating the projection once per element
+    {
+        std::vector<S> v(1000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = i % 10;
+            v[i].j = i;
+        }
+        int calls = 0;
+        auto proj = [&calls](S const & s) { return ++calls, s.i; };
+        CHECK(ranges::stable_sort(ranges::cache_keys, v, std::greater<int>{}, proj) ==
+              v.end());
+        CHECK(calls == 1000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[(std::size_t)i].i == 9 - i / 100);
+            CHECK(v[(std::size_t)i].j == (9 - i / 100) + (i % 100) * 10);
+        }
+    }
+
+    // Check sorting many ranges with one scratch buffer
+    {
+        ranges::scratch_buffer buf;
+        for(int n : {0, 1, 2, 10, 300, 1000, 20})
+        {
+            std::vector<S> v((std::size_t)n, S{});
+            for(int i = 0; i < n; ++i)
+            {
+                v[(std::size_t)i].i = (i * 7) % 13;
+                v[(std::size_t)i].j = i;
+            }
+            auto expected = v;
+            ranges::stable_sort(expected, std::less<int>{}, &S::i);
+            CHECK(ranges::stable_sort(buf, v, std::less<int>{}, &S::i) == v.end());
+            for(std::size_t i = 0; i < v.size(); ++i)
+            {
+                CHECK(v[i].i == expected[i].i);
+                CHECK(v[i].j == expected[i].j);
+            }
+        }
+        CHECK(buf.size() >= 1000 * sizeof(S));
+
+        // A buffer too small to grow still sorts, with what it has.
+        char storage[64];
+        ranges::scratch_buffer small{storage, sizeof(storage)};
+        std::vector<int> w(500);
+        for(std::size_t i = 0; i < w.size(); ++i)
+            w[i] = (int)((i * 31) % 101);
+        ranges::stable_sort(small, w.begin(), w.end());
+        CHECK(std::is_sorted(w.begin(), w.end()));
+    }
+
     return ::test_result();
 }
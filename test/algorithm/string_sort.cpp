@@ -0,0 +1,160 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/string_sort.hpp>
+#include <range/v3/view/c_str.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    std::mt19937 gen;
+
+    std::vector<std::string> random_strings(std::size_t n, std::size_t max_len,
+                                            char lo, char hi)
+    {
+        std::uniform_int_distribution<std::size_t> len(0, max_len);
+        std::uniform_int_distribution<int> ch(lo, hi);
+        std::vector<std::string> v(n);
+        for(auto & s : v)
+        {
+            s.resize(len(gen));
+            for(auto & c : s)
+                c = static_cast<char>(ch(gen));
+        }
+        return v;
+    }
+
+    void check_against_std_sort(std::vector<std::string> v)
+    {
+        auto expected = v;
+        std::sort(expected.begin(), expected.end());
+        auto it = ranges::string_sort(v);
+        CHECK(it == v.end());
+        CHECK(v == expected);
+    }
+
+    struct record
+    {
+        std::string name;
+        int id;
+    };
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Small, medium (multikey quicksort only) and large (radix passes).
+    check_against_std_sort({});
+    check_against_std_sort(random_strings(1, 5, 'a', 'z'));
+    check_against_std_sort(random_strings(15, 5, 'a', 'z'));
+    check_against_std_sort(random_strings(1000, 8, 'a', 'z'));
+    check_against_std_sort(random_strings(20000, 12, 'a', 'z'));
+
+    // Few distinct characters: many duplicates, empty strings and strings
+    // that are prefixes of one another.
+    check_against_std_sort(random_strings(3000, 6, 'a', 'b'));
+    check_against_std_sort(random_strings(20000, 3, 'a', 'c'));
+
+    // Characters above 0x7f sort after ASCII, as with std::string.
+    check_against_std_sort(random_strings(2000, 6, '\x70', '\x7f'));
+    {
+        std::vector<std::string> v{"\xe9t\xe9", "abc", "", "\xff", "zz", "ab"};
+        check_against_std_sort(v);
+    }
+
+    // Long shared prefixes.
+    {
+        std::string const prefix(200, 'p');
+        auto v = random_strings(10000, 4, '0', '9');
+        for(std::size_t i = 0; i < v.size(); i += 2)
+            v[i] = prefix + v[i];
+        check_against_std_sort(v);
+    }
+
+    // Embedded nul characters are part of the string.
+    {
+        std::vector<std::string> v{std::string("a\0b", 3), std::string("a\0", 2), "a",
+                                   std::string("a\0a", 3)};
+        string_sort(v);
+        CHECK(v[0] == "a");
+        CHECK(v[1] == std::string("a\0", 2));
+        CHECK(v[2] == std::string("a\0a", 3));
+        CHECK(v[3] == std::string("a\0b", 3));
+    }
+
+    // Projection to a member, iterator/sentinel overload.
+    {
+        std::vector<record> v;
+        auto names = random_strings(5000, 6, 'a', 'f');
+        for(std::size_t i = 0; i < names.size(); ++i)
+            v.push_back({names[i], static_cast<int>(i)});
+        auto it = string_sort(v.begin(), v.end(), &record::name);
+        CHECK(it == v.end());
+        auto sorted = names;
+        std::sort(sorted.begin(), sorted.end());
+        for(std::size_t i = 0; i < v.size(); ++i)
+        {
+            CHECK(v[i].name == sorted[i]);
+            // Elements move with their keys.
+            CHECK(names[static_cast<std::size_t>(v[i].id)] == v[i].name);
+        }
+    }
+
+    // Null-terminated strings through view::c_str.
+    {
+        char const * words[] = {"pear", "apple", "fig", "", "applesauce", "banana", "app"};
+        auto it = string_sort(words, [](char const * s) { return view::c_str(s); });
+        CHECK(it == ranges::end(words));
+        CHECK(std::string(words[0]) == "");
+        CHECK(std::string(words[1]) == "app");
+        CHECK(std::string(words[2]) == "apple");
+        CHECK(std::string(words[3]) == "applesauce");
+        CHECK(std::string(words[4]) == "banana");
+        CHECK(std::string(words[5]) == "fig");
+        CHECK(std::string(words[6]) == "pear");
+    }
+
+    // Vectors of bytes work too.
+    {
+        std::vector<std::vector<unsigned char>> v{{3, 1}, {3}, {}, {0, 255}, {0}};
+        string_sort(v);
+        CHECK(std::is_sorted(v.begin(), v.end()));
+    }
+
+    // Strings that are each a prefix of the next: every radix pass leaves
+    // one large bucket, which must not cost a stack frame.
+    {
+        std::vector<std::string> v;
+        for(std::size_t i = 5000; i > 0; --i)
+            v.push_back(std::string(i, 'a'));
+        std::swap(v[10], v[4000]);
+        string_sort(v);
+        bool in_order = true;
+        for(std::size_t i = 0; i < v.size(); ++i)
+            in_order = in_order && v[i].size() == i + 1;
+        CHECK(in_order);
+    }
+
+    // A dangling safe_iterator_t for rvalue ranges.
+    {
+        auto r = string_sort(random_strings(10, 3, 'a', 'c'));
+        CHECK(::is_dangling(r));
+    }
+
+    return ::test_result();
+}
@@ -176,5 +176,31 @@ int main()
         CHECK(a[2] == 2);
     }
 
+    {
+        // In parallel, in blocks of 64 elements, with runs that cross the
+        // boundaries between blocks.
+        std::vector<int> v;
+        for(int i = 0; i < 1000; ++i)
+            v.insert(v.end(), static_cast<std::size_t>(i * 37 % 150), i / 3);
+        auto expected = v;
+        expected.erase(ranges::unique(expected), expected.end());
+        auto r = ranges::unique(ranges::par(4, 64), v);
+        ::check_equal(ranges::make_subrange(v.begin(), r), expected);
+
+        std::vector<int> w = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2};
+        auto rw = ranges::unique(ranges::par(5, 1), w);
+        ::check_equal(ranges::make_subrange(w.begin(), rw), {1, 2});
+
+        // With a projection.
+        std::vector<std::pair<int, int>> p;
+        for(int i = 0; i < 2000; ++i)
+            p.emplace_back(i / 7, i);
+        auto rp = ranges::unique(ranges::par(4, 64), p, ranges::equal_to{},
+                                 &std::pair<int, int>::first);
+        CHECK((rp - p.begin()) == 286);
+        for(int i = 0; i < 286; ++i)
+            CHECK(p[static_cast<std::size_t>(i)].second == 7 * i);
+    }
+
     return ::test_result();
 }
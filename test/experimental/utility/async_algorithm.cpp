@@ -0,0 +1,135 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#include <range/v3/detail/config.hpp>
+#include <cstddef>
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/experimental/utility/async_algorithm.hpp>
+#include <range/v3/experimental/utility/async_generator.hpp>
+#include <range/v3/experimental/utility/event_loop.hpp>
+#include <range/v3/experimental/utility/task.hpp>
+#include "../../simple_test.hpp"
+#include "../../test_utils.hpp"
+
+#if RANGES_CXX_COROUTINES < RANGES_CXX_COROUTINES_TS1
+#error This test uses coroutines.
+#endif
+
+using ranges::experimental::async_generator;
+using ranges::experimental::event_loop;
+using ranges::experimental::task;
+namespace async = ranges::experimental::async;
+
+// Yields 0..n-1, sleeping for `latency` ticks before each value, like a
+// socket that delivers one record at a time.
+async_generator<int> slow_iota(event_loop & loop, int n, std::size_t latency)
+{
+    for(int i = 0; i < n; ++i)
+    {
+        co_await loop.delay(latency);
+        co_yield i;
+    }
+}
+
+async_generator<std::string const &> words()
+{
+    std::string w;
+    for(char const * s : {"one", "two", "three"})
+    {
+        w = s;
+        co_yield w;
+    }
+}
+
+// A lookup that takes a tick, like a request to a remote service.
+task<int> slow_square(event_loop & loop, int i)
+{
+    co_await loop.delay(1);
+    co_return i * i;
+}
+
+task<> sum_into(async_generator<int> gen, int & sum)
+{
+    co_await async::for_each(std::move(gen), [&](int i) { sum += i; });
+}
+
+int main()
+{
+    auto is_odd = [](int i) { return i % 2 == 1; };
+    auto square = [](int i) { return i * i; };
+
+    {
+        event_loop loop;
+        ::check_equal(loop.run(async::to_vector(slow_iota(loop, 5, 1))),
+                      {0, 1, 2, 3, 4});
+        ::check_equal(loop.run(async::to_vector(async::transform(
+                          slow_iota(loop, 5, 1), square))),
+                      {0, 1, 4, 9, 16});
+        ::check_equal(
+            loop.run(async::to_vector(async::filter(slow_iota(loop, 5, 1), is_odd))),
+            {1, 3});
+        ::check_equal(loop.run(async::to<std::list<int>>(
+                          slow_iota(loop, 6, 1) | async::filter(is_odd) |
+                          async::transform(square))),
+                      {1, 9, 25});
+
+        auto strings = loop.run(async::to_vector(words()));
+        CPP_assert(ranges::Same<decltype(strings), std::vector<std::string>>);
+        ::check_equal(strings, {"one", "two", "three"});
+        ::check_equal(loop.run(async::to_vector(words() | async::transform(
+                                                              &std::string::size))),
+                      {3u, 3u, 5u});
+    }
+
+    {
+        // Functions that return tasks are awaited.
+        event_loop loop;
+        auto async_square = [&](int i) { return slow_square(loop, i); };
+        ::check_equal(loop.run(async::to_vector(slow_iota(loop, 4, 0) |
+                                                async::transform(async_square))),
+                      {0, 1, 4, 9});
+        CHECK(loop.now() == 4u);
+
+        auto async_is_odd = [&](int i) -> task<bool> {
+            co_await loop.schedule();
+            co_return i % 2 == 1;
+        };
+        ::check_equal(loop.run(async::to_vector(slow_iota(loop, 6, 0) |
+                                                async::filter(async_is_odd))),
+                      {1, 3, 5});
+
+        std::vector<int> seen;
+        loop.run(async::for_each(slow_iota(loop, 3, 0), [&](int i) -> task<> {
+            co_await loop.delay(2);
+            seen.push_back(i);
+        }));
+        ::check_equal(seen, {0, 1, 2});
+    }
+
+    {
+        // Pipelines spawned on one loop overlap their waits.
+        event_loop loop;
+        std::vector<int> sums(100);
+        for(std::size_t i = 0; i < sums.size(); ++i)
+            loop.spawn(sum_into(slow_iota(loop, 20, 3) | async::filter(is_odd) |
+                                    async::transform(square),
+                                sums[i]));
+        loop.run();
+        for(int sum : sums)
+            CHECK(sum == 1330);
+        // Each pipeline alone takes 60 ticks, and so do all of them together.
+        CHECK(loop.now() == 60u);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,224 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#include <range/v3/detail/config.hpp>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/experimental/utility/async_generator.hpp>
+#include <range/v3/experimental/utility/event_loop.hpp>
+#include <range/v3/experimental/utility/task.hpp>
+#include "../../simple_test.hpp"
+#include "../../test_utils.hpp"
+
+#if RANGES_CXX_COROUTINES < RANGES_CXX_COROUTINES_TS1
+#error This test uses coroutines.
+#endif
+
+using ranges::experimental::async_generator;
+using ranges::experimental::event_loop;
+using ranges::experimental::task;
+
+task<int> answer()
+{
+    co_return 42;
+}
+
+task<int> add_one(task<int> t)
+{
+    co_return 1 + co_await std::move(t);
+}
+
+task<int> depth(int n)
+{
+    if(n == 0)
+        co_return 0;
+    co_return 1 + co_await depth(n - 1);
+}
+
+task<int &> ref_to(int & i)
+{
+    co_return i;
+}
+
+task<> fail()
+{
+    throw std::runtime_error{"fail"};
+    co_return;
+}
+
+task<std::string> catch_failure()
+{
+    try
+    {
+        co_await fail();
+    }
+    catch(std::runtime_error const & e)
+    {
+        co_return e.what();
+    }
+    co_return "";
+}
+
+// Yields 0..n-1, sleeping for `latency` ticks before each value.
+async_generator<int> slow_iota(event_loop & loop, int n, std::size_t latency)
+{
+    for(int i = 0; i < n; ++i)
+    {
+        co_await loop.delay(latency);
+        co_yield i;
+    }
+}
+
+async_generator<std::string const &> words()
+{
+    std::string w = "hello";
+    co_yield w;
+    w = "world";
+    co_yield w;
+}
+
+async_generator<int> throws_after(int n)
+{
+    for(int i = 0; i < n; ++i)
+        co_yield i;
+    throw std::runtime_error{"done"};
+}
+
+template<typename Reference, typename Value>
+task<std::vector<Value>> collect(async_generator<Reference, Value> gen)
+{
+    std::vector<Value> result;
+    auto it = co_await gen.begin();
+    while(it != gen.end())
+    {
+        result.push_back(*it);
+        co_await ++it;
+    }
+    co_return result;
+}
+
+// Sums a stream and records the time at which it finished.
+task<> sum_into(event_loop & loop, async_generator<int> gen, int & sum,
+                std::size_t & finished)
+{
+    for(auto it = co_await gen.begin(); it != gen.end(); co_await ++it)
+        sum += *it;
+    finished = loop.now();
+}
+
+task<> take_turns(event_loop & loop, std::vector<int> & order, int id)
+{
+    for(int i = 0; i < 2; ++i)
+    {
+        order.push_back(id);
+        co_await loop.schedule();
+    }
+}
+
+int main()
+{
+    {
+        event_loop loop;
+        CHECK(loop.run(answer()) == 42);
+        CHECK(loop.run(add_one(add_one(answer()))) == 44);
+        CHECK(loop.run(depth(1000)) == 1000);
+        int i = 0;
+        CHECK(&loop.run(ref_to(i)) == &i);
+        CHECK(loop.run(catch_failure()) == "fail");
+        bool thrown = false;
+        try
+        {
+            loop.run(fail());
+        }
+        catch(std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+        CHECK(loop.now() == 0u);
+    }
+
+    {
+        event_loop loop;
+        ::check_equal(loop.run(collect(slow_iota(loop, 5, 3))), {0, 1, 2, 3, 4});
+        CHECK(loop.now() == 15u);
+        ::check_equal(loop.run(collect(words())), {"hello", "world"});
+        ::check_equal(loop.run(collect(async_generator<int>{})), std::vector<int>{});
+    }
+
+    {
+        // A stream that throws rethrows from the co_await of ++it.
+        event_loop loop;
+        std::vector<int> seen;
+        auto consume = [&]() -> task<bool> {
+            auto gen = throws_after(2);
+            try
+            {
+                for(auto it = co_await gen.begin(); it != gen.end(); co_await ++it)
+                    seen.push_back(*it);
+            }
+            catch(std::runtime_error const &)
+            {
+                co_return true;
+            }
+            co_return false;
+        };
+        CHECK(loop.run(consume()));
+        ::check_equal(seen, {0, 1});
+    }
+
+    {
+        // One thread drives many streams that mostly wait.
+        event_loop loop;
+        std::vector<int> sums(1000);
+        std::vector<std::size_t> finished(sums.size());
+        for(std::size_t i = 0; i < sums.size(); ++i)
+            loop.spawn(sum_into(loop, slow_iota(loop, 10, i % 5 + 1), sums[i],
+                                finished[i]));
+        loop.run();
+        CHECK(loop.now() == 50u);
+        for(std::size_t i = 0; i < sums.size(); ++i)
+        {
+            CHECK(sums[i] == 45);
+            // Ten sleeps of its own latency, whatever the others did.
+            CHECK(finished[i] == 10 * (i % 5 + 1));
+        }
+    }
+
+    {
+        // Spawned coroutines that reschedule themselves take turns.
+        event_loop loop;
+        std::vector<int> order;
+        loop.spawn(take_turns(loop, order, 1));
+        loop.spawn(take_turns(loop, order, 2));
+        loop.run();
+        ::check_equal(order, {1, 2, 1, 2});
+
+        // run rethrows what a spawned task threw.
+        loop.spawn(fail());
+        bool thrown = false;
+        try
+        {
+            loop.run();
+        }
+        catch(std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+        loop.run();
+    }
+
+    return ::test_result();
+}
@@ -11,6 +11,7 @@
 //
 #include <range/v3/detail/config.hpp>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <range/v3/range/access.hpp>
 #include <range/v3/range_for.hpp>
@@ -23,6 +24,8 @@
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/move.hpp>
+#include <range/v3/view/span.hpp>
+#include <range/v3/view/take.hpp>
 #include <range/v3/view/take_exactly.hpp>
 #include <range/v3/view/transform.hpp>
 #include "../../simple_test.hpp"
@@ -202,6 +205,96 @@ struct MoveInt
     }
 };
 
+// Counts the frames it allocates and frees.
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+    int * live_;
+
+    explicit counting_allocator(int & live) noexcept
+      : live_(&live)
+    {}
+    template<typename U>
+    counting_allocator(counting_allocator<U> const & that) noexcept
+      : live_(that.live_)
+    {}
+    T * allocate(std::size_t n)
+    {
+        ++*live_;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T * p, std::size_t n) noexcept
+    {
+        --*live_;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    template<typename U>
+    bool operator==(counting_allocator<U> const & that) const noexcept
+    {
+        return live_ == that.live_;
+    }
+    template<typename U>
+    bool operator!=(counting_allocator<U> const & that) const noexcept
+    {
+        return live_ != that.live_;
+    }
+};
+
+template<typename Alloc>
+ranges::experimental::generator<int> alloc_iota(std::allocator_arg_t, Alloc, int n)
+{
+    for(int i = 0; i < n; ++i)
+        co_yield i;
+}
+
+struct counter
+{
+    int start_;
+
+    template<typename Alloc>
+    ranges::experimental::generator<int> count(std::allocator_arg_t, Alloc, int n) const
+    {
+        for(int i = start_; i < start_ + n; ++i)
+            co_yield i;
+    }
+};
+
+// Yields 0..n-1 in blocks of up to three, interleaved with single values and
+// empty blocks.
+ranges::experimental::generator<int> blocks(int n)
+{
+    int buf[3];
+    int i = 0;
+    while(i < n)
+    {
+        co_yield ranges::span<int const>{};
+        if(i % 4 == 1)
+        {
+            co_yield i++;
+            continue;
+        }
+        int k = 0;
+        for(; k < 3 && i < n; ++k)
+            buf[k] = i++;
+        co_yield ranges::make_span(buf, k);
+    }
+    co_yield ranges::span<int const>{};
+}
+
+ranges::experimental::generator<int &> mutable_blocks(std::vector<int> & v)
+{
+    co_yield ranges::make_span(v);
+    co_yield v[0];
+}
+
+ranges::experimental::generator<int> throwing_block()
+{
+    int const buf[] = {1, 2};
+    co_yield ranges::make_span(buf);
+    throw 42;
+}
+
 int main()
 {
     using namespace ranges;
@@ -289,5 +382,55 @@ int main()
         ::check_equal(rng, {0,4,16,36});
     }
 
+    // Frames allocated with an allocator passed after std::allocator_arg.
+    {
+        int live = 0;
+        {
+            auto rng =
+                ::alloc_iota(std::allocator_arg, counting_allocator<char>{live}, 5);
+            CHECK(live == 1);
+            ::check_equal(rng, {0, 1, 2, 3, 4});
+        }
+        CHECK(live == 0);
+        {
+            counter const c{10};
+            auto rng = c.count(std::allocator_arg, counting_allocator<int>{live}, 3);
+            CHECK(live == 1);
+            ::check_equal(rng, {10, 11, 12});
+        }
+        CHECK(live == 0);
+    }
+    // Blocks yielded with co_yield span.
+    {
+        auto rng = ::blocks(20);
+        ::check_equal(rng, {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19});
+        ::check_equal(::blocks(0), std::vector<int>{});
+        ::check_equal(::blocks(1), {0});
+        ::check_equal(::blocks(2) | view::take(1), {0});
+    }
+    {
+        std::vector<int> v{1, 2, 3};
+        for(int & i : ::mutable_blocks(v))
+            i *= 10;
+        ::check_equal(v, {100, 20, 30});
+    }
+    {
+        auto rng = ::throwing_block();
+        auto it = begin(rng);
+        CHECK(*it == 1);
+        ++it;
+        CHECK(*it == 2);
+        ++it;
+        bool thrown = false;
+        try
+        {
+            (void)(it == end(rng));
+        }
+        catch(int i)
+        {
+            thrown = i == 42;
+        }
+        CHECK(thrown);
+    }
     return ::test_result();
 }
@@ -0,0 +1,116 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/exclusive_scan.hpp>
+#include <range/v3/view/exclusive_scan.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+template<class InIter, class OutIter, class InSent = InIter> void test()
+{
+    using ranges::exclusive_scan;
+    int ir[] = {10, 11, 13, 16, 20};
+    const unsigned s = sizeof(ir) / sizeof(ir[0]);
+    int ia[] = {1, 2, 3, 4, 5};
+    int ib[s] = {0};
+    auto r = exclusive_scan(InIter(ia), InSent(ia + s), OutIter(ib), 10);
+    CHECK(base(r.in) == ia + s);
+    CHECK(base(r.out) == ib + s);
+    for(unsigned i = 0; i < s; ++i)
+    {
+        CHECK(ib[i] == ir[i]);
+    }
+}
+
+template<typename T>
+void test_parallel(std::size_t n)
+{
+    std::vector<T> in(n);
+    for(std::size_t i = 0; i < n; ++i)
+        in[i] = static_cast<T>(i % 5) + 1;
+    std::vector<T> out(n, T(42));
+    auto expected = ranges::view::exclusive_scan(in, T(3)) | ranges::to<std::vector<T>>();
+
+    auto r = ranges::exclusive_scan(ranges::par(4, 3), in, out.begin(), T(3));
+    CHECK(r.in == in.end());
+    CHECK(r.out == out.end());
+    CHECK(out == expected);
+
+    // Contiguous, so this goes through the vectorized kernel.
+    std::fill(out.begin(), out.end(), T(42));
+    ranges::exclusive_scan(ranges::par(3, 5), in.data(), in.data() + n, out.data(), T(3));
+    CHECK(out == expected);
+
+    // In place.
+    out = in;
+    ranges::exclusive_scan(ranges::par(5, 2), out, out.begin(), T(3));
+    CHECK(out == expected);
+
+    out = in;
+    ranges::exclusive_scan(out, out.begin(), T(3));
+    CHECK(out == expected);
+}
+
+int main()
+{
+    test<input_iterator<const int *>, input_iterator<int *>>();
+    test<forward_iterator<const int *>, forward_iterator<int *>>();
+    test<bidirectional_iterator<const int *>, bidirectional_iterator<int *>>();
+    test<random_access_iterator<const int *>, random_access_iterator<int *>>();
+    test<const int *, int *>();
+    test<const int *, int *, sentinel<const int *>>();
+
+    for(std::size_t n : {0, 1, 2, 3, 4, 5, 7, 8, 9, 31, 100, 1000})
+    {
+        test_parallel<int>(n);
+        test_parallel<std::int64_t>(n);
+        test_parallel<unsigned>(n);
+        test_parallel<double>(n);
+    }
+
+    { // Test projections and non-commutative operations
+        S ia[] = {{1}, {2}, {3}, {4}, {5}, {6}, {7}};
+        std::string expected[] = {"", "1", "12", "123", "1234", "12345", "123456"};
+        std::string out[7];
+        auto to_s = [](S const & x) { return std::to_string(x.i); };
+        auto r = ranges::exclusive_scan(
+            ranges::par(3, 1), ia, out, std::string{}, std::plus<>{}, to_s);
+        CHECK(r.in == ranges::end(ia));
+        CHECK(r.out == ranges::end(out));
+        CHECK(ranges::equal(out, expected));
+
+        std::string out2[7];
+        ranges::exclusive_scan(ia, out2, std::string{}, std::plus<>{}, to_s);
+        CHECK(ranges::equal(out2, expected));
+    }
+
+    { // The type of the initial value determines the accumulator type
+        int ia[] = {1, 2, 3};
+        double ib[3] = {};
+        ranges::exclusive_scan(ia, ib, 0.5);
+        double ir[] = {0.5, 1.5, 3.5};
+        CHECK(ranges::equal(ib, ir));
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,127 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/functional/comparisons.hpp>
+#include <range/v3/numeric/group_aggregate.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct Row
+{
+    std::string name;
+    int value;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        // Sums by key, in the order the keys first appear.
+        int const ia[] = {3, 1, 3, 2, 1, 3};
+        auto const key = [](int i) { return i % 10; };
+        auto sums = group_aggregate(ia, key, 0);
+        CHECK(sums.size() == 3u);
+        CHECK(sums[0] == std::make_pair(3, 9));
+        CHECK(sums[1] == std::make_pair(1, 2));
+        CHECK(sums[2] == std::make_pair(2, 2));
+
+        auto counts = group_aggregate(input_iterator<int const *>(ia),
+                                      sentinel<int const *>(ia + 6), key, 0, plus{},
+                                      [](int) { return 1; });
+        CHECK(counts.size() == 3u);
+        CHECK(counts[0] == std::make_pair(3, 3));
+        CHECK(counts[1] == std::make_pair(1, 2));
+        CHECK(counts[2] == std::make_pair(2, 1));
+
+        std::vector<int> const empty;
+        CHECK(group_aggregate(empty, key, 0).empty());
+    }
+
+    {
+        // String keys by projection, and an operation that is not a sum.
+        std::vector<Row> const rows{{"b", 4}, {"a", 7}, {"b", 9}, {"c", 1}, {"a", 2}};
+        auto maxes = group_aggregate(rows, &Row::name, 0,
+                                     [](int a, int b) { return a < b ? b : a; },
+                                     &Row::value);
+        CHECK(maxes.size() == 3u);
+        CHECK(maxes[0].first == "b");
+        CHECK(maxes[0].second == 9);
+        CHECK(maxes[1].first == "a");
+        CHECK(maxes[1].second == 7);
+        CHECK(maxes[2].first == "c");
+        CHECK(maxes[2].second == 1);
+
+        auto names = group_aggregate(rows, &Row::value, std::string{},
+                                     [](std::string s, Row const & r) {
+                                         return s + r.name;
+                                     },
+                                     [](Row const & r) -> Row const & { return r; });
+        CHECK(names.size() == 5u);
+        CHECK(names[4].second == "a");
+    }
+
+    {
+        // Many keys, which makes the table grow, and keys whose low bits
+        // are all the same.
+        std::vector<long> v;
+        for(long i = 0; i < 50000; ++i)
+            v.push_back((i % 5000) << 20);
+        auto const self = [](long i) { return i; };
+        auto groups = group_aggregate(v, self, 0L, plus{}, [](long) { return 1L; });
+        CHECK(groups.size() == 5000u);
+        bool all_ten = true;
+        for(std::size_t i = 0; i < groups.size(); ++i)
+            all_ten = all_ten && groups[i].first == (long)i << 20 &&
+                      groups[i].second == 10;
+        CHECK(all_ten);
+    }
+
+    {
+        // In parallel, the same groups in the same order as sequentially,
+        // with keys that first appear in any of the blocks.
+        std::vector<int> v(100000);
+        for(std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<int>((i * 7919) % 1000 + (i > 90000 ? 1000 : 0));
+        auto const key = [](int i) { return i % 1500; };
+        auto const expected = group_aggregate(v, key, 0L);
+        CHECK(expected.size() == 1500u);
+        for(std::size_t threads : {1u, 2u, 3u, 8u})
+        {
+            auto groups = group_aggregate(par(threads, 1000), v, key, 0L);
+            CHECK(groups == expected);
+            auto counts = group_aggregate(par(threads, 1000), v.begin(), v.end(), key,
+                                          0, plus{}, [](int) { return 1; });
+            int total = 0;
+            for(auto const & g : counts)
+                total += g.second;
+            CHECK(total == 100000);
+        }
+
+        std::vector<Row> const rows{{"b", 4}, {"a", 7}, {"b", 9}, {"c", 1}, {"a", 2}};
+        auto maxes = group_aggregate(par(2, 1), rows, &Row::name, 0,
+                                     [](int a, int b) { return a < b ? b : a; },
+                                     &Row::value);
+        CHECK(maxes.size() == 3u);
+        CHECK(maxes[0].first == "b");
+        CHECK(maxes[0].second == 9);
+        CHECK(maxes[1].second == 7);
+
+        std::vector<int> const empty;
+        CHECK(group_aggregate(par, empty, key, 0).empty());
+    }
+
+    return ::test_result();
+}
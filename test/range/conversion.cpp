@@ -16,6 +16,8 @@
 #include <range/v3/action/sort.hpp>
 #include <range/v3/core.hpp>
 #include <range/v3/range/conversion.hpp>
+#include <range/v3/utility/arena.hpp>
+#include <range/v3/view/filter.hpp>
 #include <range/v3/view/indices.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/take.hpp>
@@ -143,6 +145,48 @@ int main()
         check_equal(m[2], {3, 4, 5});
     }
 
+    // Reserve from the size hint of a range that is not sized
+    {
+        auto vl = view::iota(0, 100) | view::filter([](int i) { return i % 3 == 0; }) |
+                  to<vector_like<int>>();
+        CHECK(vl.size() == 34u);
+        CHECK(vl.reservation_count == std::size_t{1});
+        CHECK(vl.last_reservation == 100u);
+        CHECK(vl.capacity() == 34u);
+    }
+
+    // Take memory from an allocator
+    {
+        monotonic_arena arena;
+        arena_allocator<int> alloc{arena};
+        auto v = view::ints(0, 10) | ranges::to<std::vector>(alloc);
+        CPP_assert(Same<decltype(v), std::vector<int, arena_allocator<int>>>);
+        check_equal(v, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        CHECK(v.get_allocator() == alloc);
+
+        auto evens = view::ints(0, 10) | view::filter([](int i) { return i % 2 == 0; });
+        auto l = ranges::to<std::list>(evens, alloc);
+        CPP_assert(Same<decltype(l), std::list<int, arena_allocator<int>>>);
+        check_equal(l, {0, 2, 4, 6, 8});
+
+        // Unsized forward ranges are counted first, so the vector never
+        // regrows inside the arena.
+        auto const before = arena.capacity();
+        auto e = evens | ranges::to<std::vector>(alloc);
+        check_equal(e, {0, 2, 4, 6, 8});
+        CHECK(e.capacity() == 5u);
+        CHECK(arena.capacity() == before);
+
+        using inner_t = std::vector<int, arena_allocator<int>>;
+        using outer_t = std::vector<inner_t, arena_allocator<inner_t>>;
+        auto r = view::ints(1, 4) |
+                 view::transform([](int i) { return view::ints(i, i + 3); });
+        auto m = r | ranges::to<outer_t>(alloc);
+        CHECK(m.size() == 3u);
+        check_equal(m[2], {3, 4, 5});
+        CHECK(m[0].get_allocator() == alloc);
+    }
+
     test_zip_to_map(view::zip(view::ints, view::iota(0, 10)), 0);
 
     return ::test_result();
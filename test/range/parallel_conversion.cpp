@@ -0,0 +1,128 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <atomic>
+#include <list>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <range/v3/core.hpp>
+#include <range/v3/range/parallel_conversion.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct no_default
+{
+    int i;
+    explicit no_default(int j)
+      : i(j)
+    {}
+    bool operator==(no_default const & that) const
+    {
+        return i == that.i;
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    std::atomic<int> calls{0};
+    auto square = [&](int i) {
+        ++calls;
+        return i * i;
+    };
+
+    {
+        // Sized and random-access: assigned in place
+        auto rng = view::iota(0, 1000) | view::transform(square);
+        auto v = rng | to<std::vector>(par(4, 10));
+        CPP_assert(Same<decltype(v), std::vector<int>>);
+        CHECK(calls == 1000);
+        CHECK(v == (rng | to<std::vector>()));
+        CHECK(v[999] == 999 * 999);
+
+        auto v2 = to<std::vector<long>>(par(3, 1), rng);
+        CPP_assert(Same<decltype(v2), std::vector<long>>);
+        CHECK(v2.size() == 1000u);
+        CHECK(v2[500] == 250000);
+
+        // Too small to be worth splitting
+        auto v3 = to<std::vector>(par, view::iota(0, 10) | view::transform(square));
+        ::check_equal(v3, {0, 1, 4, 9, 16, 25, 36, 49, 64, 81});
+    }
+
+    {
+        // Forward and unsized: per-thread chunks spliced together
+        auto rng = view::iota(0, 1000) | view::filter([](int i) { return i % 3 == 0; }) |
+                   view::transform(square);
+        CPP_assert(!SizedRange<decltype(rng)>);
+        auto v = rng | to<std::vector>(par(4, 10));
+        CHECK(v.size() == 334u);
+        CHECK(v == (rng | to<std::vector>()));
+
+        auto l = rng | to<std::list>(par(4, 10));
+        CHECK(l.size() == 334u);
+        CHECK(l.back() == 999 * 999);
+    }
+
+    {
+        // Elements that are not default constructible
+        auto rng = view::iota(0, 100) | view::transform([](int i) { return no_default{i}; });
+        auto v = rng | to<std::vector>(par(4, 1));
+        CHECK(v.size() == 100u);
+        CHECK(v[42] == no_default{42});
+    }
+
+    {
+        // Containers without a positional range insert are built sequentially
+        auto s = view::iota(0, 100) | view::transform([](int i) { return i % 10; }) |
+                 to<std::set>(par(4, 1));
+        CHECK(s.size() == 10u);
+    }
+
+    {
+        // Containers of containers
+        auto rng = view::iota(0, 100) | view::chunk(7);
+        auto vv = rng | to<std::vector<std::vector<int>>>(par(4, 1));
+        CHECK(vv.size() == 15u);
+        ::check_equal(vv[14], {98, 99});
+        ::check_equal(vv[3], {21, 22, 23, 24, 25, 26, 27});
+    }
+
+    {
+        // Exceptions propagate to the caller
+        auto rng = view::iota(0, 100) | view::transform([](int i) {
+                       if(i == 77)
+                           throw std::runtime_error("77");
+                       return std::to_string(i);
+                   });
+        bool caught = false;
+        try
+        {
+            (void)(rng | to<std::vector>(par(4, 1)));
+        }
+        catch(std::runtime_error const & e)
+        {
+            caught = std::string(e.what()) == "77";
+        }
+        CHECK(caught);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,83 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+
+#include <range/v3/range/size_hint.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/split.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+bool is_even(int i)
+{
+    return i % 2 == 0;
+}
+
+int main()
+{
+    std::vector<int> v{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    {
+        auto b = size_hint(v);
+        CHECK(b.lower == 10u);
+        CHECK(b.upper == 10u);
+    }
+    {
+        auto b = size_hint(view::ints);
+        CHECK(b.lower == 0u);
+        CHECK(!b.bounded());
+    }
+    {
+        auto rng = v | view::filter(is_even);
+        CPP_assert(!SizedRange<decltype(rng)>);
+        auto b = size_hint(rng);
+        CHECK(b.lower == 0u);
+        CHECK(b.upper == 10u);
+
+        auto b2 = size_hint(v | view::remove_if(is_even) | view::transform(is_even));
+        CHECK(b2.lower == 0u);
+        CHECK(b2.upper == 10u);
+
+        auto b3 = size_hint(rng | view::take(3));
+        CHECK(b3.lower == 0u);
+        CHECK(b3.upper == 3u);
+    }
+    {
+        auto b = size_hint(v | view::take_while([](int i) { return i < 5; }));
+        CHECK(b.lower == 0u);
+        CHECK(b.upper == 10u);
+    }
+    {
+        std::string s{"a b c"};
+        auto b = size_hint(s | view::split(' '));
+        CHECK(b.lower == 0u);
+        CHECK(b.upper == 6u);
+    }
+    {
+        std::vector<std::string> words{"a", "", "c"};
+        auto b = size_hint(words | view::join(std::string{", "}));
+        CHECK(b.lower == 4u);
+        CHECK(!b.bounded());
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,92 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <range/v3/core.hpp>
+#include <range/v3/utility/arena.hpp>
+#include <range/v3/view/split.hpp>
+
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+template<typename T>
+using arena_vector = std::vector<T, arena_allocator<T>>;
+
+int main()
+{
+    {
+        monotonic_arena arena{256};
+        CHECK(arena.capacity() == 0u);
+        void * p = arena.allocate(10, 1);
+        void * q = arena.allocate(8, 8);
+        CHECK((reinterpret_cast<std::uintptr_t>(q) % 8) == 0u);
+        CHECK(static_cast<char *>(q) >= static_cast<char *>(p) + 10);
+        CHECK(arena.capacity() == 256u);
+
+        // Freeing the most recent allocation hands it out again.
+        arena.deallocate(q, 8);
+        CHECK(arena.allocate(8, 8) == q);
+        // Freeing anything else does nothing.
+        arena.deallocate(p, 10);
+        CHECK(arena.allocate(10, 1) != p);
+
+        // Requests larger than a block get a block of their own.
+        void * big = arena.allocate(1000, 16);
+        CHECK((reinterpret_cast<std::uintptr_t>(big) % 16) == 0u);
+        CHECK(arena.capacity() >= 1256u);
+
+        // Reset hands out the same memory again.
+        auto const cap = arena.capacity();
+        arena.reset();
+        CHECK(arena.allocate(10, 1) == p);
+        CHECK(arena.capacity() == cap);
+
+        arena.release();
+        CHECK(arena.capacity() == 0u);
+    }
+
+    {
+        monotonic_arena arena;
+        arena_allocator<int> a{arena};
+        arena_allocator<char> b{a};
+        CHECK(a == b);
+        CHECK(b.arena() == &arena);
+        monotonic_arena other;
+        CHECK(a != arena_allocator<int>{other});
+
+        arena_vector<int> v{a};
+        for(int i = 0; i < 1000; ++i)
+            v.push_back(i);
+        CHECK(v.size() == 1000u);
+        CHECK(v[999] == 999);
+    }
+
+    {
+        // A container of containers, all in one arena
+        monotonic_arena arena;
+        std::string const text = "lorem ipsum dolor sit amet";
+        using word_t = arena_vector<char>;
+        auto words = text | view::split(' ') |
+                     to<std::vector<word_t, arena_allocator<word_t>>>(
+                         arena_allocator<char>{arena});
+        CHECK(words.size() == 5u);
+        ::check_equal(words[2], {'d', 'o', 'l', 'o', 'r'});
+        CHECK(words.get_allocator().arena() == &arena);
+        CHECK(words[4].get_allocator().arena() == &arena);
+    }
+
+    return ::test_result();
+}
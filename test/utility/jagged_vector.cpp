@@ -0,0 +1,109 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/jagged_vector.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/split.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        jagged_vector<int> jv{{1, 2, 3}, {}, {4}, {5, 6}};
+        CPP_assert(RandomAccessRange<jagged_vector<int>>);
+        CPP_assert(SizedRange<jagged_vector<int>>);
+        CPP_assert(!View<jagged_vector<int>>);
+        CPP_assert(ContiguousRange<range_reference_t<jagged_vector<int>>>);
+        CPP_assert(Same<range_reference_t<jagged_vector<int> const>, span<int const>>);
+        CHECK(jv.size() == 4u);
+        ::check_equal(jv[0], {1, 2, 3});
+        CHECK(jv[1].empty());
+        ::check_equal(jv.back(), {5, 6});
+        ::check_equal(jv.values(), {1, 2, 3, 4, 5, 6});
+        ::check_equal(jv.offsets(), {0u, 3u, 3u, 4u, 6u});
+        ::check_equal(jv | view::join, {1, 2, 3, 4, 5, 6});
+
+        // Rows are writable views into the value buffer.
+        jv[2][0] = 40;
+        for(auto row : jv)
+            for(int & i : row)
+                i *= 10;
+        ::check_equal(jv.values(), {10, 20, 30, 400, 50, 60});
+
+        auto const & cjv = jv;
+        auto it = cjv.begin() + 3;
+        ::check_equal(*it, {50, 60});
+        CHECK((cjv.end() - it) == 1);
+        jagged_vector<int>::const_iterator cit = jv.begin();
+        CHECK(cit == cjv.begin());
+
+        jv.pop_back();
+        CHECK(jv.size() == 3u);
+        ::check_equal(jv.values(), {10, 20, 30, 400});
+        jv.push_back_row();
+        jv.push_back_value(7);
+        jv.push_back_value(8);
+        jv.push_back(std::list<int>{9});
+        ::check_equal(jv.back(), {9});
+        ::check_equal(jv[3], {7, 8});
+        CHECK(jv == jagged_vector<int>{{10, 20, 30}, {}, {400}, {7, 8}, {9}});
+        while(!jv.empty())
+            jv.pop_back();
+        CHECK(jv == jagged_vector<int>{});
+        CHECK(jv.begin() == jv.end());
+    }
+
+    {
+        // Round trips through view::split and view::join.
+        std::string const text = "the quick  brown fox";
+        auto words = text | view::split(' ') | to<jagged_vector<char>>();
+        CHECK(words.size() == 5u);
+        ::check_equal(words[1], std::string{"quick"});
+        CHECK(words[2].empty());
+        ::check_equal(words.values(), std::string{"thequickbrownfox"});
+        CHECK(equal(words | view::join(' '), text));
+
+        auto words2 = to<jagged_vector<char>>(text | view::split(' '));
+        CHECK(words2 == words);
+    }
+
+    {
+        // view::chunk over a contiguous range, and a range of non-contiguous
+        // ranges.
+        std::vector<int> v = to<std::vector>(view::iota(0, 10));
+        auto chunks = to<jagged_vector<int>>(v | view::chunk(4));
+        CHECK(chunks.size() == 3u);
+        ::check_equal(chunks[2], {8, 9});
+        ::check_equal(chunks | view::join, v);
+
+        auto squares = view::iota(0, 4) | view::transform([](int i) {
+                           return view::iota(0, i) | view::transform([](int j) {
+                                      return j * j;
+                                  });
+                       });
+        auto jv = to<jagged_vector<long>>(squares);
+        ::check_equal(jv.offsets(), {0u, 0u, 1u, 3u, 6u});
+        ::check_equal(jv.values(), {0, 0, 1, 0, 1, 4});
+    }
+
+    return test_result();
+}
@@ -0,0 +1,157 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/detail/simd_compact.hpp>
+#include <range/v3/functional/not_fn.hpp>
+#include <range/v3/functional/pred.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+// Equal element for element, NaNs included.
+template<typename V>
+bool same_bits(std::vector<V> const & x, std::vector<V> const & y)
+{
+    return x.size() == y.size() &&
+           (x.empty() || std::memcmp(x.data(), y.data(), x.size() * sizeof(V)) == 0);
+}
+
+// Compacts v with every kernel the processor has, both into another array
+// and in place, and compares the results with the scalar loop's.
+template<typename V, typename Pred>
+void check_kernels(std::vector<V> const & v, Pred pred)
+{
+    std::vector<detail::simd_isa> isas{detail::simd_isa::none};
+    if(detail::compact_isa() != detail::simd_isa::none)
+        isas.push_back(detail::simd_isa::avx2);
+    if(detail::compact_isa() == detail::simd_isa::avx512)
+        isas.push_back(detail::simd_isa::avx512);
+    std::vector<V> kept, removed;
+    for(V x : v)
+        (pred(x) ? kept : removed).push_back(x);
+    for(auto isa : isas)
+    {
+        std::vector<V> out(kept.size());
+        CHECK(detail::simd_compact<true, false>(v.data(), v.size(), out.data(), pred,
+                                                isa) == kept.size());
+        CHECK(same_bits(out, kept));
+
+        auto w = v;
+        w.resize(detail::simd_compact<false, true>(w.data(), w.size(), w.data(), pred,
+                                                   isa));
+        CHECK(same_bits(w, removed));
+    }
+}
+
+template<typename V>
+void test_kernels()
+{
+    CPP_assert(detail::compact_value_pred_<V, pred::compare_with<less, V>>::value);
+    std::vector<V> v;
+    for(int i = 0; i < 1000; ++i)
+        v.push_back(static_cast<V>((i * 7919) % 201));
+    v.push_back(std::numeric_limits<V>::max());
+    v.push_back(std::numeric_limits<V>::lowest());
+    for(V bound : {V(0), V(17), V(100), V(200), std::numeric_limits<V>::max()})
+    {
+        check_kernels(v, pred::lt(bound));
+        check_kernels(v, pred::le(bound));
+        check_kernels(v, pred::gt(bound));
+        check_kernels(v, pred::ge(bound));
+        check_kernels(v, pred::eq(bound));
+        check_kernels(v, pred::ne(bound));
+        check_kernels(v, not_fn(pred::lt(bound)));
+    }
+    check_kernels(v, pred::between(V(10), V(150)));
+    check_kernels(v, not_fn(pred::between(V(10), V(150))));
+    check_kernels(v, pred::between(V(150), V(10)));
+    // Every length up to a few vectors, for the partial vector at the end.
+    for(std::size_t n = 0; n < 40; ++n)
+        check_kernels(std::vector<V>(v.begin(), v.begin() + static_cast<long>(n)),
+                      pred::ge(V(100)));
+}
+
+int main()
+{
+    {
+        CHECK(pred::lt(3)(2));
+        CHECK(!pred::lt(3)(3));
+        CHECK(pred::le(3)(3));
+        CHECK(pred::gt(3)(4));
+        CHECK(!pred::ge(3)(2));
+        CHECK(pred::eq(3)(3));
+        CHECK(pred::ne(3)(4));
+        CHECK(pred::between(1, 3)(1));
+        CHECK(pred::between(1, 3)(3));
+        CHECK(!pred::between(1, 3)(4));
+        CHECK(pred::lt(2.5)(2));
+        constexpr auto small = pred::lt(10);
+        static_assert(small(9) && !small(10), "");
+    }
+
+    {
+        // What the kernels take on.
+        using lt_int = pred::compare_with<less, int>;
+        CPP_assert(detail::compact_value_pred_<int, lt_int>::value);
+        CPP_assert(detail::compact_value_pred_<long long, lt_int>::value);
+        CPP_assert(detail::compact_value_pred_<double, lt_int>::value);
+        CPP_assert(detail::compact_value_pred_<int, logical_negate<lt_int>>::value);
+        // The comparison would be done in double, or on 16-bit elements.
+        using lt_double = pred::compare_with<less, double>;
+        CPP_assert(!detail::compact_value_pred_<int, lt_double>::value);
+        CPP_assert(!detail::compact_value_pred_<short, lt_int>::value);
+        CPP_assert(!detail::compact_value_pred_<int, logical_negate<less>>::value);
+    }
+
+    test_kernels<std::int32_t>();
+    test_kernels<std::uint32_t>();
+    test_kernels<std::int64_t>();
+    test_kernels<std::uint64_t>();
+    test_kernels<float>();
+    test_kernels<double>();
+
+    {
+        // Unsigned elements with the high bit set compare as unsigned.
+        std::vector<std::uint32_t> u{0u, 1u, 0x80000000u, 0xffffffffu, 5u, 0x7fffffffu,
+                                     3u, 9u, 0x80000001u};
+        check_kernels(u, pred::lt(0x80000000u));
+        check_kernels(u, pred::gt(7u));
+        std::vector<std::uint64_t> ul(u.begin(), u.end());
+        ul.push_back(0x8000000000000000u);
+        ul.push_back(~std::uint64_t{0});
+        check_kernels(ul, pred::lt(std::uint64_t{0x8000000000000000u}));
+    }
+
+#ifndef __FAST_MATH__
+    {
+        // NaNs are neither less nor greater than the bound, so they pass the
+        // negated tests: le, ge and ne.
+        double const nan = std::nan("");
+        std::vector<double> d{1.0, nan, 3.0, -nan, 2.0, 5.0, nan, 0.5, 7.0, 8.0};
+        check_kernels(d, pred::lt(3.0));
+        check_kernels(d, pred::le(3.0));
+        check_kernels(d, pred::ne(3.0));
+        check_kernels(d, pred::between(1.0, 5.0));
+        std::vector<float> f(d.begin(), d.end());
+        check_kernels(f, pred::gt(2.0f));
+        check_kernels(f, pred::ge(2.0f));
+    }
+#endif
+
+    return ::test_result();
+}
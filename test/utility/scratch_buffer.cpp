@@ -0,0 +1,92 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdint>
+#include <utility>
+
+#include <range/v3/core.hpp>
+#include <range/v3/utility/scratch_buffer.hpp>
+
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+struct alignas(64) wide
+{
+    char c[64];
+};
+
+int main()
+{
+    {
+        scratch_buffer buf;
+        CHECK(buf.size() == 0u);
+        CHECK(buf.data() == nullptr);
+        CHECK(buf.get<int>(0).first == nullptr);
+
+        auto p = buf.get<int>(100);
+        CHECK(p.first != nullptr);
+        CHECK(p.second == 100);
+        CHECK(buf.size() >= 100 * sizeof(int));
+
+        // Smaller requests reuse the buffer.
+        CHECK(buf.get<int>(10).first == p.first);
+        CHECK(buf.get<char>(400).first == static_cast<void *>(p.first));
+
+        // Growing at least doubles it.
+        auto const size = buf.size();
+        CHECK(buf.reserve(size + 1));
+        CHECK(buf.size() >= 2 * size);
+        CHECK(buf.reserve(1));
+        CHECK(buf.size() >= 2 * size);
+
+        // Storage is aligned for the type.
+        auto w = buf.get<wide>(3);
+        CHECK(w.second == 3);
+        CHECK((reinterpret_cast<std::uintptr_t>(w.first) % alignof(wide)) == 0u);
+
+        scratch_buffer moved{std::move(buf)};
+        CHECK(buf.size() == 0u);
+        CHECK(moved.size() >= 2 * size);
+        moved.release();
+        CHECK(moved.size() == 0u);
+        CHECK(moved.data() == nullptr);
+    }
+
+    {
+        // Storage from the caller is used until it is too small.
+        alignas(16) char storage[256];
+        scratch_buffer buf{storage, sizeof(storage)};
+        CHECK(buf.data() == static_cast<void *>(storage));
+        auto p = buf.get<int>(64);
+        CHECK(static_cast<void *>(p.first) == static_cast<void *>(storage));
+        CHECK(p.second == 64);
+        auto q = buf.get<int>(65);
+        CHECK(static_cast<void *>(q.first) != static_cast<void *>(storage));
+        CHECK(q.second == 65);
+        CHECK(buf.size() >= 512u);
+    }
+
+    {
+        // Large buffers may be backed by huge pages; either way they work.
+        scratch_buffer buf{scratch_pages::huge};
+        auto p = buf.get<double>(1 << 20);
+        CHECK(p.second == (1 << 20));
+        for(std::ptrdiff_t i = 0; i < p.second; i += 4096)
+            p.first[i] = static_cast<double>(i);
+        CHECK(p.first[4096] == 4096.0);
+        auto q = buf.get<double>(10);
+        CHECK(q.first == p.first);
+    }
+
+    return ::test_result();
+}
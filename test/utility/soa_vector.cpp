@@ -0,0 +1,132 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/soa_vector.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/zip.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct throws_on_copy
+{
+    throws_on_copy() = default;
+    throws_on_copy(throws_on_copy &&) = default;
+    throws_on_copy(throws_on_copy const &)
+    {
+        throw 42;
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        soa_vector<int, double, std::string> sv;
+        using SV = decltype(sv);
+        CPP_assert(RandomAccessRange<SV>);
+        CPP_assert(SizedRange<SV>);
+        CPP_assert(!View<SV>);
+        CPP_assert(Same<range_reference_t<SV>, common_tuple<int &, double &, std::string &>>);
+        CPP_assert(Same<range_reference_t<SV const>,
+                        common_tuple<int const &, double const &, std::string const &>>);
+        CPP_assert(Same<SV::column_type<1>, double>);
+
+        sv.push_back(3, 0.5, "c");
+        sv.emplace_back(1, 1.5, "a");
+        sv.emplace_back(2, 2.5, std::string(3, 'b'));
+        CHECK(sv.size() == 3u);
+        ::check_equal(sv.column<0>(), {3, 1, 2});
+        ::check_equal(sv.column<1>(), {0.5, 1.5, 2.5});
+        CHECK(std::get<2>(sv[2]) == "bbb");
+        std::get<1>(sv[0]) = 4.0;
+        CHECK(sv.column<1>()[0] == 4.0);
+
+        // Sorting the container permutes every column together.
+        sort(sv, less{}, [](auto && row) { return std::get<0>(row); });
+        ::check_equal(sv.column<0>(), {1, 2, 3});
+        ::check_equal(sv.column<1>(), {1.5, 2.5, 4.0});
+        ::check_equal(sv.column<2>(), {"a", "bbb", "c"});
+
+        stable_sort(sv.rows(), greater{}, [](auto && row) { return std::get<1>(row); });
+        ::check_equal(sv.column<0>(), {3, 2, 1});
+        ::check_equal(sv.column<2>() | view::reverse, {"a", "bbb", "c"});
+
+        auto const & csv = sv;
+        int n = 0;
+        for(auto && row : csv)
+            n += std::get<0>(row);
+        CHECK(n == 6);
+        CHECK((csv.end() - csv.begin()) == 3);
+
+        sv.pop_back();
+        CHECK(sv.size() == 2u);
+        CHECK(sv.column<2>().size() == 2);
+        auto copy = sv;
+        CHECK(copy == sv);
+        copy.clear();
+        CHECK(copy.empty());
+        CHECK(copy != sv);
+    }
+
+    {
+        // A throwing column leaves the container as it was.
+        soa_vector<int, throws_on_copy> sv;
+        throws_on_copy const t{};
+        sv.emplace_back(1, throws_on_copy{});
+        bool caught = false;
+        try
+        {
+            sv.emplace_back(2, t);
+        }
+        catch(int)
+        {
+            caught = true;
+        }
+        CHECK(caught);
+        CHECK(sv.size() == 1u);
+        CHECK(sv.column<0>().size() == 1);
+    }
+
+    {
+        // view::zip of contiguous, sized ranges: one index for all of them,
+        // stopping at the shortest.
+        std::vector<int> a = to<std::vector>(view::iota(0, 10));
+        std::vector<long> b = to<std::vector>(view::iota(10L, 16L));
+        auto z = view::zip(a, b);
+        CPP_assert(RandomAccessRange<decltype(z)>);
+        CPP_assert(CommonRange<decltype(z)>);
+        CHECK(z.size() == 6u);
+        CHECK((end(z) - begin(z)) == 6);
+        CHECK(std::get<1>(begin(z)[5]) == 15L);
+        ::check_equal(z | view::reverse | view::take(2),
+                      {std::make_pair(5, 15L), std::make_pair(4, 14L)});
+        sort(z, greater{}, [](auto && p) { return std::get<0>(p); });
+        ::check_equal(a, {5, 4, 3, 2, 1, 0, 6, 7, 8, 9});
+        ::check_equal(b, {15, 14, 13, 12, 11, 10});
+
+        auto const cz = view::zip(a, b);
+        auto it = begin(cz);
+        it += 2;
+        CHECK(std::get<0>(*it) == 3);
+        CHECK((end(cz) - it) == 4);
+    }
+
+    return test_result();
+}
@@ -17,6 +17,12 @@
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+template<typename T, std::size_t N>
+std::size_t index_of(ranges::indexed_element<T, N>)
+{
+    return N;
+}
+
 int main()
 {
     using namespace ranges;
@@ -181,5 +187,40 @@ int main()
         (void) vrgt;
     }
 
+    // Variants with more alternatives than one block of the dispatch switch
+    {
+        using V = variant<char, short, int, long, float, double, std::string, char,
+                          short, int, long, float, double, std::string, char, short,
+                          int, long, float, double, std::string, int, long, std::string>;
+        static_assert(V::size() == 24, "");
+        V v{emplaced_index<20>, "twenty"};
+        CHECK(v.index() == 20u);
+        CHECK(get<20>(v) == "twenty");
+        V v2 = v;
+        CHECK(v2.index() == 20u);
+        CHECK(v2 == v);
+        v2.emplace<23>("twenty-three");
+        CHECK(v2 != v);
+        CHECK(get<23>(v2) == "twenty-three");
+        v = std::move(v2);
+        CHECK(v.index() == 23u);
+        CHECK(get<23>(v) == "twenty-three");
+        std::size_t visited = 0;
+        v.visit_i([&](auto i) { visited = index_of(i); });
+        CHECK(visited == 23u);
+        v.emplace<2>(2);
+        CHECK(get<2>(v) == 2);
+        bool thrown = false;
+        try
+        {
+            (void)get<22>(v);
+        }
+        catch(bad_variant_access const &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
     return ::test_result();
 }
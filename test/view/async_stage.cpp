@@ -0,0 +1,193 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/utility/copy.hpp>
+#include <range/v3/view/async_stage.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/getlines.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    auto square = [](int i) { return i * i; };
+    auto const expected = view::iota(0, 2000) | view::transform(square) | to_vector;
+
+    {
+        auto rng = view::iota(0, 2000) | view::transform(square) | view::async_stage;
+        models<InputViewConcept>(aux::copy(rng));
+        models_not<ForwardViewConcept>(aux::copy(rng));
+        CPP_assert(Same<range_reference_t<decltype(rng)>, int &>);
+        ::check_equal(rng, expected);
+
+        ::check_equal(view::iota(0, 0) | view::async_stage(2), std::vector<int>{});
+    }
+
+    {
+        // Several threads, and a queue much shorter than the range.
+        for(std::size_t threads : {1u, 2u, 4u})
+            for(std::size_t depth : {1u, 3u, 64u})
+                ::check_equal(view::iota(0, 2000) | view::transform(square) |
+                                  view::async_stage(threads, depth),
+                              expected);
+
+        auto unordered = view::iota(0, 2000) | view::transform(square) |
+                         view::async_stage(4, 8, async_order::unordered) | to_vector;
+        sort(unordered);
+        ::check_equal(unordered, expected);
+    }
+
+    {
+        // Stages chain, and the adaptors after a stage run on the consumer.
+        std::thread::id const consumer = std::this_thread::get_id();
+        std::atomic<int> upstream_on_consumer{0};
+        std::atomic<int> downstream_on_consumer{0};
+        auto rng = view::iota(0, 500) | view::transform([&](int i) {
+                       upstream_on_consumer += std::this_thread::get_id() == consumer;
+                       return i;
+                   }) |
+                   view::async_stage(2, 16) | view::filter([](int i) {
+                       return i % 3 == 0;
+                   }) |
+                   view::transform(square) | view::async_stage |
+                   view::transform([&](int i) {
+                       downstream_on_consumer +=
+                           std::this_thread::get_id() == consumer;
+                       return i;
+                   });
+        CHECK(accumulate(rng, 0) == accumulate(view::iota(0, 500) |
+                                                   view::filter([](int i) {
+                                                       return i % 3 == 0;
+                                                   }) |
+                                                   view::transform(square),
+                                               0));
+        CHECK(upstream_on_consumer == 0);
+        CHECK(downstream_on_consumer == 167);
+    }
+
+    {
+        // Over an input range.
+        std::stringstream sin{"one\ntwo\nthree\nfour\n"};
+        ::check_equal(getlines(sin) | view::async_stage(2, 2),
+                      {"one", "two", "three", "four"});
+    }
+
+    {
+        // The threads stay within the queue depth of the consumer.
+        std::atomic<int> read{0};
+        auto rng = view::ints | view::transform([&](int i) {
+                       ++read;
+                       return i;
+                   }) |
+                   view::async_stage(2, 8);
+        auto it = rng.begin();
+        CHECK(*it == 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        // Eight in the ring, one taken, and one in the hands of each thread.
+        CHECK(read <= 11);
+
+        // A depth that is not a power of two is not rounded up.
+        std::atomic<int> read3{0};
+        auto three = view::ints | view::transform([&](int i) {
+                         ++read3;
+                         return i;
+                     }) |
+                     view::async_stage(1, 3);
+        auto it3 = three.begin();
+        CHECK(*it3 == 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        CHECK(read3 <= 3 + 1 + 1);
+        ++it3;
+        CHECK(*it3 == 1);
+
+        // Leaving an infinite range early stops the threads.
+        ::check_equal(view::ints | view::async_stage(3, 4) | view::take(5),
+                      {0, 1, 2, 3, 4});
+    }
+
+    {
+        // Values that own memory are moved through, and those left in the
+        // queue are destroyed.
+        auto boxed = view::iota(0, 100) | view::transform([](int i) {
+                         return std::make_shared<int>(i);
+                     }) |
+                     view::async_stage(2, 4);
+        int sum = 0;
+        RANGES_FOR(auto const & p, boxed | view::take(10))
+            sum += *p;
+        CHECK(sum == 45);
+    }
+
+    {
+        // An exception is rethrown after the elements before it, whether it
+        // comes from reading an element or from the source's increment. In
+        // unordered mode, elements after the one that throws may have been
+        // claimed already and still come, so the first source ends there.
+        auto check_rethrown = [](auto && rng, int n) {
+            std::vector<int> seen;
+            bool thrown = false;
+            try
+            {
+                RANGES_FOR(int i, rng)
+                    seen.push_back(i);
+            }
+            catch(std::runtime_error const &)
+            {
+                thrown = true;
+            }
+            CHECK(thrown);
+            ranges::sort(seen);
+            ::check_equal(seen, view::iota(0, n));
+        };
+        for(auto order : {async_order::ordered, async_order::unordered})
+        {
+            check_rethrown(view::iota(0, 101) | view::transform([](int i) {
+                               if(i == 100)
+                                   throw std::runtime_error{"bad element"};
+                               return i;
+                           }) |
+                               view::async_stage(4, 16, order),
+                           100);
+            check_rethrown(view::iota(0, 1000) | view::filter([](int i) {
+                               if(i == 50)
+                                   throw std::runtime_error{"bad increment"};
+                               return true;
+                           }) |
+                               view::transform([](int i) {
+                                   std::this_thread::sleep_for(
+                                       std::chrono::milliseconds(2));
+                                   return i;
+                               }) |
+                               view::async_stage(4, 16, order),
+                           50);
+        }
+    }
+
+    return ::test_result();
+}
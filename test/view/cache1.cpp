@@ -0,0 +1,74 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/copy.hpp>
+#include <range/v3/view/cache1.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        int calls = 0;
+        auto square = [&calls](int i) {
+            ++calls;
+            return i * i;
+        };
+        auto even = [](int i) { return i % 2 == 0; };
+
+        auto plain = view::iota(0, 10) | view::transform(square) | view::filter(even);
+        ::check_equal(plain, {0, 4, 16, 36, 64});
+        CHECK(calls == 15);
+
+        calls = 0;
+        auto rng = view::iota(0, 10) | view::transform(square) | view::cache1 |
+                   view::filter(even);
+        ::check_equal(rng, {0, 4, 16, 36, 64});
+        CHECK(calls == 10);
+
+        auto cached = view::iota(0, 10) | view::transform(square) | view::cache1;
+        models<InputViewConcept>(aux::copy(cached));
+        models_not<ForwardViewConcept>(aux::copy(cached));
+        models<SizedViewConcept>(aux::copy(cached));
+        CPP_assert(Same<range_reference_t<decltype(cached)>, int &>);
+        CHECK(cached.size() == 10u);
+    }
+
+    {
+        // Inner ranges produced by a transform are built once per element and
+        // can then be joined.
+        int calls = 0;
+        auto words = view::iota(1, 4) | view::transform([&calls](int i) {
+                         ++calls;
+                         return std::string(static_cast<std::size_t>(i), 'x');
+                     }) |
+                     view::cache1 | view::join;
+        ::check_equal(words, std::string{"xxxxxx"});
+        CHECK(calls == 3);
+    }
+
+    {
+        std::vector<int> empty;
+        auto rng = empty | view::cache1;
+        CHECK(begin(rng) == end(rng));
+    }
+
+    return test_result();
+}
@@ -22,6 +22,60 @@
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+// A view of a vector whose iterators check that they are only compared with
+// those of the same vector.
+struct checked_view : ranges::view_facade<checked_view>
+{
+private:
+    friend ranges::range_access;
+    std::vector<int> const * v_ = nullptr;
+    struct cursor
+    {
+        int const * p_ = nullptr;
+        std::vector<int> const * v_ = nullptr;
+        int read() const
+        {
+            return *p_;
+        }
+        void next()
+        {
+            ++p_;
+        }
+        void prev()
+        {
+            --p_;
+        }
+        void advance(std::ptrdiff_t n)
+        {
+            p_ += n;
+        }
+        bool equal(cursor const & that) const
+        {
+            CHECK(v_ == that.v_);
+            return p_ == that.p_;
+        }
+        std::ptrdiff_t distance_to(cursor const & that) const
+        {
+            CHECK(v_ == that.v_);
+            return that.p_ - p_;
+        }
+    };
+    cursor begin_cursor() const
+    {
+        return {v_->data(), v_};
+    }
+    cursor end_cursor() const
+    {
+        return {v_->data() + v_->size(), v_};
+    }
+
+public:
+    checked_view() = default;
+    explicit checked_view(std::vector<int> const & v)
+      : v_(&v)
+    {}
+};
+
 int main()
 {
     using namespace ranges;
@@ -101,5 +155,78 @@ int main()
         ::check_equal(rng, {0,1,2,3,0,1,2,3,0,1,2,3});
     }
 
+    // More ranges than one block of the variant's dispatch switch, some
+    // of them empty.
+    {
+        std::vector<int> e, a{0, 1}, b{2}, c{3, 4, 5};
+        auto rng = view::concat(a, e, b, c, e, a, b, e, c, a, e, b, c, a, b, e, e, c, a,
+                                b);
+        ::check_equal(rng, {0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5,
+                            0, 1, 2, 3, 4, 5, 0, 1, 2});
+        CHECK(rng.size() == 27u);
+        auto it = ranges::begin(rng);
+        it += 20;
+        CHECK(*it == 2);
+        CHECK(it[-20] == 0);
+        CHECK((ranges::end(rng) - it) == 7);
+        ::check_equal(rng | view::reverse, {2, 1, 0, 5, 4, 3, 2, 1, 0, 5, 4, 3, 2, 1,
+                                            0, 5, 4, 3, 2, 1, 0, 5, 4, 3, 2, 1, 0});
+    }
+
+    // Every position, offset and distance, with ranges of one iterator type,
+    // which hold a single iterator, and of two, which hold a variant; some
+    // of the ranges are empty, including the first and the last.
+    {
+        std::vector<int> e, a{0, 1}, b{2}, c{3, 4, 5};
+        std::array<int, 0> ea{};
+        std::array<int, 2> aa{{0, 1}};
+        int const expected[] = {0, 1, 2, 3, 4, 5, 0, 1, 2};
+        auto check_positions = [&](auto && rng) {
+            CPP_assert(RandomAccessRange<decltype(rng)>);
+            auto const first = ranges::begin(rng);
+            auto const last = ranges::end(rng);
+            CHECK((last - first) == 9);
+            bool ok = true;
+            for(int i = 0; i <= 9; ++i)
+                for(int j = 0; j <= 9; ++j)
+                {
+                    auto it = first + i;
+                    ok = ok && (first + j - it) == j - i;
+                    it += j - i;
+                    ok = ok && it == first + j && (j == 9 || *it == expected[j]);
+                }
+            CHECK(ok);
+            int n = 9;
+            for(auto it = last; it != first;)
+                ok = ok && *--it == expected[--n];
+            CHECK(ok);
+            ::check_equal(rng, expected);
+        };
+        auto flat = view::concat(e, a, e, b, c, e, a, b, e);
+        CPP_assert(Same<decltype(flat.begin() - flat.begin()), std::ptrdiff_t>);
+        check_positions(flat);
+        check_positions(aux::copy(flat) | view::reverse | view::reverse);
+        auto const & cflat = flat;
+        check_positions(cflat);
+        check_positions(view::concat(ea, a, e, b, c, ea, aa, b, e));
+    }
+
+    // Cursors in different ranges never compare the iterators of different
+    // ranges.
+    {
+        std::vector<int> a{0, 1}, b{2}, c{3, 4, 5};
+        auto rng = view::concat(checked_view{a}, checked_view{b}, checked_view{c});
+        CPP_assert(RandomAccessRange<decltype(rng)>);
+        auto const first = rng.begin();
+        auto const second = first + 2;
+        CHECK(*second == 2);
+        CHECK(!(first == second));
+        CHECK(first != rng.end());
+        CHECK((rng.end() - first) == 6);
+        CHECK((second - first) == 2);
+        ::check_equal(rng, {0, 1, 2, 3, 4, 5});
+        ::check_equal(rng | view::reverse, {5, 4, 3, 2, 1, 0});
+    }
+
     return test_result();
 }
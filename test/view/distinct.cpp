@@ -0,0 +1,136 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/copy.hpp>
+#include <range/v3/view/distinct.hpp>
+#include <range/v3/view/getlines.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    // A key that counts its copies.
+    struct counted
+    {
+        static int copies;
+        int i;
+        explicit counted(int j)
+          : i(j)
+        {}
+        counted(counted const & that)
+          : i(that.i)
+        {
+            ++copies;
+        }
+        counted(counted &&) noexcept = default;
+        counted & operator=(counted const &) = default;
+        counted & operator=(counted &&) noexcept = default;
+        friend bool operator==(counted const & a, counted const & b)
+        {
+            return a.i == b.i;
+        }
+    };
+    int counted::copies = 0;
+} // namespace
+
+namespace std
+{
+    template<>
+    struct hash<counted>
+    {
+        std::size_t operator()(counted const & c) const
+        {
+            return std::hash<int>{}(c.i);
+        }
+    };
+} // namespace std
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::vector<int> v{3, 1, 3, 2, 1, 3, 4};
+        auto rng = v | view::distinct;
+        models<InputViewConcept>(aux::copy(rng));
+        models_not<ForwardViewConcept>(aux::copy(rng));
+        CPP_assert(Same<range_reference_t<decltype(rng)>, int &>);
+        ::check_equal(rng, {3, 1, 2, 4});
+        // Each begin starts over.
+        ::check_equal(rng, {3, 1, 2, 4});
+        *rng.begin() = 5;
+        CHECK(v[0] == 5);
+
+        ::check_equal(view::distinct(v, [](int i) { return i % 2; }), {5, 2});
+        ::check_equal(v | view::distinct([](int i) { return i / 2; }), {5, 1, 3});
+
+        std::vector<int> const empty;
+        auto none = empty | view::distinct;
+        CHECK(none.begin() == none.end());
+    }
+
+    {
+        // Over an input range, and an infinite one that is cut short.
+        std::stringstream sin{"b\na\nb\nc\na\n"};
+        ::check_equal(getlines(sin) | view::distinct, {"b", "a", "c"});
+
+        // Past the last key there is, an increment would search forever.
+        auto squares = view::ints | view::transform([](int i) { return i * i % 10; }) |
+                       view::distinct | view::take(4);
+        ::check_equal(squares, {0, 1, 4, 9});
+        CPP_assert(!SizedRange<decltype(view::ints | view::distinct)>);
+    }
+
+    {
+        // Many keys with the same low bits.
+        auto big = view::iota(0, 40000) |
+                   view::transform([](int i) { return (long)(i % 4000) << 24; }) |
+                   view::distinct;
+        long count = 0;
+        bool in_order = true;
+        RANGES_FOR(long i, big)
+        {
+            in_order = in_order && i == count << 24;
+            ++count;
+        }
+        CHECK(count == 4000);
+        CHECK(in_order);
+    }
+
+    {
+        // A copy of the view does not copy the keys seen, and iterates on its
+        // own.
+        std::vector<int> v{2, 0, 2, 1, 0, 3, 1};
+        auto rng = v | view::distinct([](int i) { return counted{i}; });
+        auto it = rng.begin();
+        ++it;
+        ++it;
+        CHECK(*it == 1);
+        int const copies = counted::copies;
+        auto copy = rng;
+        CHECK(counted::copies == copies);
+        ::check_equal(copy, {2, 0, 1, 3});
+        ++it;
+        CHECK(*it == 3);
+        ++it;
+        CHECK(it == rng.end());
+        ::check_equal(copy, {2, 0, 1, 3});
+    }
+
+    return ::test_result();
+}
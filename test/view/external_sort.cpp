@@ -0,0 +1,62 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/utility/copy.hpp>
+#include <range/v3/view/external_sort.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct record
+{
+    int key;
+    char tag;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    auto scrambled = view::iota(0, 20000) |
+                     view::transform([](int i) { return (i * 7919) % 20000 / 4; });
+
+    // Runs are written when the view is made, and merged as it is read.
+    auto rng = scrambled | view::external_sort(4096);
+    ::models<InputViewConcept>(aux::copy(rng));
+    ::models_not<ForwardRangeConcept>(rng);
+    CPP_assert(Same<range_reference_t<decltype(rng)>, int const &>);
+
+    std::vector<int> expected = scrambled | to<std::vector>();
+    std::sort(expected.begin(), expected.end());
+    ::check_equal(rng | view::take(10), {0, 0, 0, 0, 1, 1, 1, 1, 2, 2});
+    // Copies share the position.
+    auto copy = rng;
+    CHECK(*begin(copy) == 2);
+
+    // Many runs, consumed lazily by a pipeline.
+    auto evens = view::external_sort(scrambled, 1024) |
+                 view::transform([](int i) { return i * 2; });
+    ::check_equal(evens | view::take(5), {0, 0, 0, 0, 2});
+    CHECK(equal(view::external_sort(scrambled, 1024), expected));
+
+    // Descending, with a projection, everything in memory.
+    std::vector<record> records{{3, 'a'}, {1, 'b'}, {2, 'c'}};
+    auto desc = view::external_sort(records, 1 << 20, "", greater{}, &record::key);
+    ::check_equal(desc | view::transform(&record::tag), {'a', 'c', 'b'});
+
+    return ::test_result();
+}
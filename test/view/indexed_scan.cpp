@@ -0,0 +1,112 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <functional>
+#include <vector>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/copy.hpp>
+#include <range/v3/view/indexed_scan.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    int rgi[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    {
+        auto rng = rgi | view::indexed_partial_sum;
+        has_type<int>(*begin(rng));
+        models<SizedViewConcept>(aux::copy(rng));
+        models<RandomAccessViewConcept>(aux::copy(rng));
+        models<CommonViewConcept>(aux::copy(rng));
+        CHECK(rng.size() == 10u);
+        ::check_equal(rng, {1, 3, 6, 10, 15, 21, 28, 36, 45, 55});
+        ::check_equal(rng | view::reverse, {55, 45, 36, 28, 21, 15, 10, 6, 3, 1});
+
+        auto it = begin(rng);
+        CHECK(it[9] == 55);
+        CHECK(it[0] == 1);
+        CHECK(*(end(rng) - 3) == 36);
+        CHECK((end(rng) - begin(rng)) == 10);
+    }
+
+    {
+        // Tiny blocks, so that most jumps go through the index.
+        auto rng = view::indexed_partial_sum(rgi, std::plus<int>(), 3);
+        ::check_equal(rng, {1, 3, 6, 10, 15, 21, 28, 36, 45, 55});
+        for(int i : {9, 0, 4, 7, 3, 8, 1, 6, 2, 5})
+            CHECK(begin(rng)[i] == (i + 1) * (i + 2) / 2);
+        auto it = end(rng);
+        for(int i = 9; i >= 0; --i)
+            CHECK(*--it == (i + 1) * (i + 2) / 2);
+        // Copies start with an empty index.
+        auto rng2 = rng;
+        CHECK(begin(rng2)[8] == 45);
+    }
+
+    {
+        // Non-associative operations give the same answer as view::partial_sum.
+        auto rng = rgi | view::indexed_partial_sum(std::minus<int>(), 4);
+        auto expected = rgi | view::partial_sum(std::minus<int>());
+        ::check_equal(rng, expected);
+        CHECK(begin(rng)[7] == 1 - 2 - 3 - 4 - 5 - 6 - 7 - 8);
+    }
+
+    {
+        auto rng = rgi | view::indexed_exclusive_scan(100, std::plus<int>(), 2);
+        has_type<int>(*begin(rng));
+        models<RandomAccessViewConcept>(aux::copy(rng));
+        ::check_equal(rng, {100, 101, 103, 106, 110, 115, 121, 128, 136, 145});
+        CHECK(begin(rng)[9] == 145);
+        CHECK(begin(rng)[0] == 100);
+        CHECK(*(end(rng) - 1) == 145);
+        CHECK(begin(rng)[5] == 115);
+
+        auto rng2 = view::indexed_exclusive_scan(rgi, 0.5);
+        has_type<double>(*begin(rng2));
+        CHECK(begin(rng2)[3] == 6.5);
+    }
+
+    {
+        // Weighted sampling: binary search of the cumulative weights.
+        std::vector<int> weights(1000, 2);
+        auto cumulative = view::indexed_partial_sum(weights, std::plus<int>(), 16);
+        auto it = lower_bound(cumulative, 777);
+        CHECK((it - begin(cumulative)) == 388);
+        CHECK(*it == 778);
+        CHECK(lower_bound(cumulative, 2001) == end(cumulative));
+    }
+
+    {
+        // Empty ranges
+        std::vector<int> empty;
+        auto rng = empty | view::indexed_partial_sum;
+        CHECK(begin(rng) == end(rng));
+        auto rng2 = empty | view::indexed_exclusive_scan(1);
+        CHECK(rng2.size() == 0u);
+    }
+
+    {
+        // Lazily transformed inputs
+        auto rng = view::iota(1, 101) | view::transform([](int i) { return i * i; }) |
+                   view::indexed_partial_sum(std::plus<int>(), 8);
+        CHECK(begin(rng)[99] == 338350);
+        CHECK(begin(rng)[49] == 42925);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,94 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/copy.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/join_random_access.hpp>
+#include <range/v3/view/reverse.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<std::vector<int>> vv{{}, {1, 2, 3}, {}, {}, {4}, {5, 6}, {}};
+
+    {
+        auto rng = vv | view::join_random_access;
+        has_type<int &>(*begin(rng));
+        models<SizedViewConcept>(aux::copy(rng));
+        models<RandomAccessViewConcept>(aux::copy(rng));
+        models<CommonViewConcept>(aux::copy(rng));
+        CHECK(rng.size() == 6u);
+        ::check_equal(rng, {1, 2, 3, 4, 5, 6});
+        ::check_equal(rng | view::reverse, {6, 5, 4, 3, 2, 1});
+
+        auto it = begin(rng);
+        for(int i : {5, 0, 3, 4, 2, 1})
+            CHECK(it[i] == i + 1);
+        CHECK(*(end(rng) - 3) == 4);
+        CHECK((end(rng) - begin(rng)) == 6);
+        CHECK((end(rng) - (it + 4)) == 2);
+        it += 3;
+        CHECK(*it == 4);
+        it -= 2;
+        CHECK(*it == 2);
+        // Copies start with an empty index.
+        auto rng2 = rng;
+        CHECK(begin(rng2)[4] == 5);
+    }
+
+    {
+        // A copy indexes the inner ranges as they are now, while the view it
+        // was copied from keeps the offsets it recorded.
+        std::vector<std::vector<int>> ws{{1, 2}, {3}};
+        auto rng = view::join_random_access(ws);
+        CHECK(rng.size() == 3u);
+        ws[0].push_back(0);
+        auto copy = rng;
+        CHECK(copy.size() == 4u);
+        ::check_equal(copy, {1, 2, 0, 3});
+        CHECK(rng.size() == 3u);
+    }
+
+    {
+        // Sorting and searching across segment boundaries.
+        std::vector<std::vector<int>> xs{{9, 3}, {}, {7, 1, 8}, {2}, {6, 0, 5, 4}};
+        auto rng = view::join_random_access(xs);
+        sort(rng);
+        CHECK(is_sorted(rng));
+        ::check_equal(xs | view::join, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        ::check_equal(xs[0], {0, 1});
+        ::check_equal(xs[4], {6, 7, 8, 9});
+        for(int i = 0; i < 10; ++i)
+            CHECK((lower_bound(rng, i) - begin(rng)) == i);
+        CHECK(lower_bound(rng, 10) == end(rng));
+    }
+
+    {
+        // Nothing but empty inner ranges.
+        std::vector<std::vector<int>> empty(3);
+        auto rng = empty | view::join_random_access;
+        CHECK(rng.size() == 0u);
+        CHECK(begin(rng) == end(rng));
+        std::vector<std::vector<int>> none;
+        auto rng2 = none | view::join_random_access;
+        CHECK(begin(rng2) == end(rng2));
+    }
+
+    return test_result();
+}
@@ -0,0 +1,207 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/c_str.hpp>
+#include <range/v3/view/lex.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    // Whether the whole of text is one token of lx.
+    bool matches(ranges::lexer const & lx, std::string const & text)
+    {
+        auto const m = lx.match(text.begin(), text.end());
+        return m.second >= 0 && m.first == text.end();
+    }
+
+    bool throws(std::string const & pattern)
+    {
+        try
+        {
+            ranges::lexer{pattern};
+        }
+        catch(ranges::lex_error const &)
+        {
+            return true;
+        }
+        return false;
+    }
+
+    template<typename Rng>
+    std::vector<std::string> strings(Rng && tokens)
+    {
+        std::vector<std::string> result;
+        for(auto it = ranges::begin(tokens); it != ranges::end(tokens); ++it)
+            result.emplace_back(ranges::begin(*it), ranges::end(*it));
+        return result;
+    }
+} // namespace
+
+void test_patterns()
+{
+    using ranges::lexer;
+
+    lexer const ident{"[A-Za-z_][A-Za-z0-9_]*"};
+    CHECK(matches(ident, "x"));
+    CHECK(matches(ident, "_foo42"));
+    CHECK(!matches(ident, "42foo"));
+    CHECK(!matches(ident, ""));
+
+    lexer const number{R"(-?\d+(\.\d+)?([eE][+-]?\d+)?)"};
+    CHECK(matches(number, "0"));
+    CHECK(matches(number, "-12.5e+3"));
+    CHECK(matches(number, "7E9"));
+    CHECK(!matches(number, "1."));
+    CHECK(!matches(number, ".5"));
+
+    lexer const alt{"cat|category|dog"};
+    CHECK(matches(alt, "cat"));
+    CHECK(matches(alt, "category"));
+    CHECK(!matches(alt, "cate"));
+    {
+        std::string const s = "category!";
+        auto const m = alt.match(s.begin(), s.end());
+        auto const len = m.first - s.begin();
+        CHECK(m.second == 0);
+        CHECK(len == 8);
+    }
+
+    lexer const counted{"a{2}b{1,3}c{2,}(xy){0,1}"};
+    CHECK(matches(counted, "aabcc"));
+    CHECK(matches(counted, "aabbbccccxy"));
+    CHECK(!matches(counted, "abcc"));
+    CHECK(!matches(counted, "aabbbbcc"));
+    CHECK(!matches(counted, "aabc"));
+    CHECK(!matches(counted, "aabccxyxy"));
+
+    lexer const classes{R"([^,\s]+|\x41\.[\]\-a]?)"};
+    CHECK(matches(classes, "hello"));
+    CHECK(!matches(classes, "a b"));
+    CHECK(matches(classes, "A."));
+    CHECK(matches(classes, "A.]"));
+    CHECK(matches(classes, "A.-"));
+    CHECK(!matches(classes, "A.,"));
+
+    lexer const dot{"a.c"};
+    CHECK(matches(dot, "abc"));
+    CHECK(matches(dot, "a\xff" "c"));
+    CHECK(!matches(dot, "a\nc"));
+
+    // Bytes that no pattern tells apart share a column of the table.
+    CHECK(lexer{"x*"}.states() <= 3u);
+    CHECK(lexer{}.rules() == 0u);
+
+    CHECK(throws("(ab"));
+    CHECK(throws("ab)"));
+    CHECK(throws("[ab"));
+    CHECK(throws("*a"));
+    CHECK(throws("a**"));
+    CHECK(throws("a*?"));
+    CHECK(throws("^a"));
+    CHECK(throws(R"(\bword)"));
+    CHECK(throws(R"((a)\1)"));
+    CHECK(throws("a{3,2}"));
+    CHECK(throws("a{2"));
+    CHECK(throws("[z-a]"));
+    CHECK(throws(R"(\x4g)"));
+    try
+    {
+        lexer{"ab(c"};
+        CHECK(false);
+    }
+    catch(ranges::lex_error const & e)
+    {
+        CHECK(e.position() == 4u);
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    test_patterns();
+
+    std::size_t const word = 0, number = 1, space = 2, punct = 3;
+    lexer const lx{"[A-Za-z]+", "[0-9]+", R"(\s+)", "[.,;:!?]"};
+    CHECK(lx.rules() == 4u);
+
+    {
+        std::string const text = "Hello, world 42 times!";
+        auto rng = text | view::lex(lx);
+        CPP_assert(ForwardRange<decltype(rng)>);
+        CPP_assert(CommonRange<decltype(rng)>);
+        CPP_assert(ForwardRange<decltype(rng) const>);
+        CPP_assert(View<decltype(rng)>);
+        using Token = range_value_t<decltype(rng)>;
+        CPP_assert(ContiguousRange<Token>);
+        CPP_assert(SizedRange<Token>);
+
+        check_equal(strings(rng),
+                    {"Hello", ",", " ", "world", " ", "42", " ", "times", "!"});
+        check_equal(rng | view::transform([](Token const & t) { return t.rule(); }),
+                    {word, punct, space, word, space, number, space, word, punct});
+        // The tokens are pieces of the input, not copies.
+        auto const first = *begin(rng);
+        CHECK(&*first.begin() == text.data());
+        // Iterating again gives the same tokens.
+        check_equal(strings(rng), strings(rng));
+    }
+
+    {
+        // Characters that start no token are skipped.
+        std::string const text = "@@a1#b2##";
+        check_equal(strings(view::lex(text, lexer{"[a-z][0-9]"})), {"a1", "b2"});
+        check_equal(strings(view::lex(text, lexer{"x"})), std::vector<std::string>{});
+        std::string const empty;
+        check_equal(strings(view::lex(empty, lx)), std::vector<std::string>{});
+    }
+
+    {
+        // Longest match wins, then the earliest rule.
+        lexer const kw{"if|else", "[a-z]+"};
+        std::string const text = "if iffy else";
+        auto rng = view::lex(text, kw);
+        check_equal(strings(rng), {"if", "iffy", "else"});
+        check_equal(rng | view::transform([](auto const & t) { return t.rule(); }),
+                    {0u, 1u, 0u});
+    }
+
+    {
+        // A failed partial match restarts one character later.
+        std::string const text = "aaab";
+        check_equal(strings(view::lex(text, lexer{"aaaa|ab"})), {"ab"});
+    }
+
+    {
+        // Rules that can match nothing produce no empty tokens.
+        std::string const text = "xxyx";
+        check_equal(strings(view::lex(text, lexer{"x*"})), {"xx", "x"});
+    }
+
+    {
+        // Non-contiguous input, and a non-common one.
+        std::list<char> const chars{'a', 'b', ' ', '1', '2'};
+        check_equal(strings(chars | view::lex(lx)), {"ab", " ", "12"});
+
+        char const * const sz = "one two";
+        auto rng = view::c_str(sz) | view::lex(lx);
+        CPP_assert(!CommonRange<decltype(rng)>);
+        check_equal(strings(rng), {"one", " ", "two"});
+    }
+
+    return test_result();
+}
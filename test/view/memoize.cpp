@@ -0,0 +1,97 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/algorithm/adjacent_find.hpp>
+#include <range/v3/core.hpp>
+#include <range/v3/utility/copy.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/memoize.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    int calls = 0;
+    auto square = [&calls](int i) {
+        ++calls;
+        return i * i;
+    };
+    auto even = [](int i) { return i % 2 == 0; };
+
+    {
+        auto rng = view::iota(0, 10) | view::transform(square) | view::memoize |
+                   view::filter(even);
+        models<ForwardViewConcept>(aux::copy(rng));
+        ::check_equal(rng, {0, 4, 16, 36, 64});
+        CHECK(calls == 10);
+        // Ten elements fit in the cache, so a second pass computes nothing.
+        calls = 0;
+        ::check_equal(rng, {0, 4, 16, 36, 64});
+        CHECK(calls == 0);
+        // A copy of the view starts with an empty cache.
+        auto copy = rng;
+        ::check_equal(copy, {0, 4, 16, 36, 64});
+        CHECK(calls == 10);
+
+        // Forty do not: a second pass recomputes what the cache forgot.
+        calls = 0;
+        auto big = view::iota(0, 40) | view::transform(square) | view::memoize(16);
+        int sum = 0;
+        for(int i : big)
+            sum += i;
+        CHECK(calls == 40);
+        for(int i : big)
+            sum -= i;
+        CHECK(sum == 0);
+        CHECK(calls == 80);
+    }
+
+    {
+        calls = 0;
+        auto rng = view::iota(0, 10) | view::transform(square) | view::memoize(32);
+        models<ForwardViewConcept>(aux::copy(rng));
+        models_not<BidirectionalViewConcept>(aux::copy(rng));
+        models<SizedViewConcept>(aux::copy(rng));
+        models<CommonViewConcept>(aux::copy(rng));
+        CHECK(rng.size() == 10u);
+        CPP_assert(Same<range_reference_t<decltype(rng)>, int>);
+        ::check_equal(rng, {0, 1, 4, 9, 16, 25, 36, 49, 64, 81});
+        ::check_equal(rng, {0, 1, 4, 9, 16, 25, 36, 49, 64, 81});
+        CHECK(calls == 10);
+
+        // adjacent_find reads most elements through two iterators.
+        calls = 0;
+        auto it = adjacent_find(rng, [](int a, int b) { return b - a > 10; });
+        CHECK(*it == 25);
+        CHECK(calls == 0);
+
+        // Copies start with an empty cache.
+        auto rng2 = rng;
+        ::check_equal(rng2, {0, 1, 4, 9, 16, 25, 36, 49, 64, 81});
+        CHECK(calls == 10);
+    }
+
+    {
+        // A cache of one slot still serves repeated reads of one position.
+        calls = 0;
+        auto rng = view::iota(0, 6) | view::transform(square) | view::memoize(1) |
+                   view::filter(even);
+        ::check_equal(rng, {0, 4, 16});
+        CHECK(calls == 6);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,140 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2019-present
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/utility/copy.hpp>
+#include <range/v3/view/getlines.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/par_transform.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    auto square = [](int i) { return i * i; };
+
+    {
+        std::vector<int> const v = view::iota(0, 3000) | to_vector;
+        auto const expected = v | view::transform(square) | to_vector;
+
+        auto rng = v | view::par_transform(square);
+        models<InputViewConcept>(aux::copy(rng));
+        models_not<ForwardViewConcept>(aux::copy(rng));
+        CPP_assert(Same<range_reference_t<decltype(rng)>, int &>);
+        ::check_equal(rng, expected);
+
+        for(std::size_t threads : {1u, 3u, 8u})
+            for(std::size_t window : {1u, 5u, 256u})
+                ::check_equal(view::par_transform(v, square, window, threads),
+                              expected);
+
+        std::vector<int> const empty;
+        ::check_equal(empty | view::par_transform(square, 4, 2), empty);
+    }
+
+    {
+        // Over an input range; the function may take the line by value, and
+        // then gets it moved, or by reference to the copy.
+        std::stringstream sin{"one\ntwo\nthree\nfour\n"};
+        ::check_equal(getlines(sin) |
+                          view::par_transform([](std::string s) { return s.size(); }, 2),
+                      {3u, 3u, 5u, 4u});
+        sin.clear();
+        sin.str("a\nbb\n");
+        ::check_equal(getlines(sin) | view::par_transform([](std::string & s) {
+                          return s + "?";
+                      }),
+                      {"a?", "bb?"});
+    }
+
+    {
+        // Move-only results.
+        auto boxed = view::iota(0, 50) |
+                     view::par_transform([](int i) { return std::make_unique<int>(i); },
+                                         8, 4);
+        int sum = 0;
+        RANGES_FOR(auto & p, boxed)
+            sum += *p;
+        CHECK(sum == 1225);
+    }
+
+    {
+        // The window caps how far ahead the threads get.
+        std::atomic<int> calls{0};
+        auto rng = view::ints | view::par_transform(
+                                    [&](int i) {
+                                        ++calls;
+                                        return i;
+                                    },
+                                    16, 4);
+        auto it = rng.begin();
+        CHECK(*it == 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        CHECK(calls <= 16 + 4 + 1);
+        ++it;
+        CHECK(*it == 1);
+
+        // Nor does a window that is not a power of two.
+        std::atomic<int> calls5{0};
+        auto five = view::ints | view::par_transform(
+                                     [&](int i) {
+                                         ++calls5;
+                                         return i;
+                                     },
+                                     5, 1);
+        auto it5 = five.begin();
+        CHECK(*it5 == 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        CHECK(calls5 <= 5 + 1 + 1);
+
+        ::check_equal(view::ints | view::par_transform(square, 4, 4) | view::take(5),
+                      {0, 1, 4, 9, 16});
+    }
+
+    {
+        // An exception is rethrown after the results before it.
+        auto rng = view::iota(0, 1000) | view::par_transform(
+                                             [](int i) {
+                                                 if(i == 300)
+                                                     throw std::runtime_error{"bad"};
+                                                 return i;
+                                             },
+                                             32, 4);
+        std::vector<int> seen;
+        bool thrown = false;
+        try
+        {
+            RANGES_FOR(int i, rng)
+                seen.push_back(i);
+        }
+        catch(std::runtime_error const &)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+        ::check_equal(seen, view::iota(0, 300));
+    }
+
+    return ::test_result();
+}
@@ -15,6 +15,8 @@
 #include <functional>
 #include <range/v3/core.hpp>
 #include <range/v3/functional/not_fn.hpp>
+#include <range/v3/functional/pred.hpp>
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/remove_if.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/counted.hpp>
@@ -162,5 +164,28 @@ int main()
         CHECK(rng.empty());
     }
 
+    // Collecting a view of a contiguous range with a predicate from
+    // ranges::pred picks the elements out in bulk.
+    {
+        using namespace ranges;
+        std::vector<int> is(1000);
+        for(std::size_t i = 0; i < is.size(); ++i)
+            is[i] = static_cast<int>(i * 37 % 101);
+        auto const lt50 = [](int i) { return i < 50; };
+        std::vector<int> removed, kept;
+        for(int i : is)
+            (lt50(i) ? kept : removed).push_back(i);
+
+        auto rng = is | view::remove_if(pred::lt(50));
+        ::check_equal(rng, removed);
+        ::check_equal(rng | to_vector, removed);
+        ::check_equal(is | view::filter(pred::lt(50)) | to_vector, kept);
+        ::check_equal(is | view::filter(pred::between(0, 49)) | to<std::vector>(), kept);
+        std::vector<int> const none;
+        CHECK((none | view::remove_if(pred::eq(1)) | to_vector).empty());
+        std::vector<long> ls(is.begin(), is.end());
+        ::check_equal(ls | view::filter(pred::lt(50)) | to<std::vector<long>>(), kept);
+    }
+
     return test_result();
 }
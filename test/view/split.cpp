@@ -10,6 +10,7 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <string>
+#include <vector>
 #include <cctype>
 #include <sstream>
 #include <range/v3/core.hpp>
@@ -280,6 +281,87 @@ void moar_tests()
     }
 }
 
+// Split text on a pattern through the contiguous fast path and through a
+// forward-iterator view of the same characters, and compare the pieces.
+void check_same_pieces(std::string const & text, std::string const & pattern)
+{
+    using namespace ranges;
+    auto fast = view::split(text, pattern);
+    using Piece = range_value_t<decltype(fast)>;
+    CPP_assert(ContiguousRange<Piece>);
+    CPP_assert(SizedRange<Piece>);
+
+    forward_iterator<std::string::const_iterator> first{text.begin()};
+    auto slow = view::split(view::counted(first, distance(text)), pattern);
+
+    auto i = begin(fast);
+    auto j = begin(slow);
+    for(; i != end(fast) && j != end(slow); ++i, ++j)
+        check_equal(*i, *j);
+    CHECK(i == end(fast));
+    CHECK(j == end(slow));
+}
+
+void test_contiguous()
+{
+    using namespace ranges;
+
+    {
+        std::string list{"a, b,,, c, "};
+        auto sv = view::split(list, c_str(", "));
+        auto i = sv.begin();
+        check_equal(*i, c_str("a"));
+        CHECK(&*begin(*i) == list.data());
+        check_equal(*++i, c_str("b,,"));
+        check_equal(*++i, c_str("c"));
+        CHECK(++i == sv.end());
+    }
+
+    {
+        std::string const text{"one<|>two<|><|>three<|"};
+        auto sv = view::split(text, c_str("<|>"));
+        CPP_assert(ForwardRange<decltype(sv)>);
+        CPP_assert(ContiguousRange<range_value_t<decltype(sv)>>);
+        auto i = sv.begin();
+        check_equal(*i, c_str("one"));
+        check_equal(*++i, c_str("two"));
+        check_equal(*++i, view::empty<char>);
+        check_equal(*++i, c_str("three<|"));
+        CHECK(++i == sv.end());
+    }
+
+    check_same_pieces("", ",");
+    check_same_pieces(",", ",");
+    check_same_pieces(",,a,,", ",");
+    check_same_pieces("abab", "ababab");
+    check_same_pieces("aaaaaaaaaa", "aa");
+    check_same_pieces("aaaaaaaaaa", "aaa");
+    check_same_pieces("xxabcabxabcabcabx", "abcab");
+    check_same_pieces("abcabdabcabcabdabcabcabdab", "abcabdab");
+    check_same_pieces("field-end<field-end><field-end>x<field-end", "<field-end>");
+    check_same_pieces("<field-end>", "<field-end>");
+    check_same_pieces("no separators here", "<field-end>");
+    {
+        // Every pattern shift table entry is clamped.
+        std::string const pattern(300, 'z');
+        std::string text = "a" + pattern + pattern + "b" + pattern.substr(1) + "c";
+        check_same_pieces(text, pattern);
+        check_same_pieces(text, pattern + "b");
+    }
+
+    {
+        std::vector<int> v{1, 2, 0, 3, 0, 0, 4};
+        auto sv = v | view::split(0);
+        CPP_assert(ContiguousRange<range_value_t<decltype(sv)>>);
+        auto i = sv.begin();
+        check_equal(*i, {1, 2});
+        check_equal(*++i, {3});
+        check_equal(*++i, view::empty<int>);
+        check_equal(*++i, {4});
+        CHECK(++i == sv.end());
+    }
+}
+
 int main()
 {
     using namespace ranges;
@@ -407,6 +489,7 @@ int main()
     }
 
     moar_tests();
+    test_contiguous();
 
     {   // Regression test for #1041
         auto is_escape = [](auto first, auto last) {